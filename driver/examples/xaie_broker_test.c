@@ -0,0 +1,588 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_broker_test.c
+* @{
+*
+* This file contains a test of the broker backend with several processes.
+*
+* The application forks a broker process which owns the partition with the
+* Linux backend, on top of the mock of the kernel driver in xaie_linux_mock.h,
+* and serves it with XAie_BrokerServe(). The application and the client
+* processes it forks then drive the partition through the broker backend and
+* check that:
+*	- registers written by a client are read back through the broker,
+*	- performance counters requested by two clients are distinct, as the
+*	  resource requests are served by the broker,
+*	- a transaction larger than a batch of the broker is applied as a whole
+*	  and a transaction larger than the ring is rejected,
+*	- the broker frees the slot of a client killed while waiting for a
+*	  batch, so that the ring keeps serving the other clients.
+*
+* The test is skipped if the driver is built without the broker backend
+* (-D__AIEBROKER__).
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include "xaie_linux_mock.h"
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		2
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+#define BROKER_NAME_FMT		"/xaie_broker_test_%d"
+#define BROKER_SKIP_STATUS	2
+#define BROKER_WAIT_US		10000U
+#define BROKER_WAIT_COUNT	500U
+
+/* Registers of tile (0, 1) past the memories mapped by the mock */
+#define TXN_REG_OFF		((1ULL << XAIE_ROW_SHIFT) + 0x8000U)
+/* Larger than a batch of the broker */
+#define TXN_NUM_WORDS		6000U
+/* Larger than the ring of the broker */
+#define TXN_MAX_WORDS		(17U * 4096U)
+#define REG_OFF			((1ULL << XAIE_ROW_SHIFT) + 0x32000U)
+#define POLL_TIMEOUT_US		500000U
+/* More than twice the number of slots of the broker ring */
+#define NUM_READS		64U
+
+/* Resources tracked per tile module by the mock */
+#define MOCK_NUM_MODS		3U
+#define MOCK_NUM_RSC_TYPES	8U
+#define MOCK_NUM_RSCS		4U
+
+/************************** Variable Definitions *****************************/
+static uint8_t RscMap[XAIE_NUM_COLS][XAIE_NUM_ROWS][MOCK_NUM_MODS]
+	[MOCK_NUM_RSC_TYPES];
+static volatile u8 Stop;
+
+/************************** Function Definitions *****************************/
+static int MockRscIoctl(unsigned long Request, void *Arg)
+{
+	struct aie_rsc_req_rsp *Req = (struct aie_rsc_req_rsp *)Arg;
+	struct aie_rsc *Rsc = (struct aie_rsc *)Arg;
+	uint8_t *Bits;
+
+	switch(Request) {
+	case AIE_RSC_REQ_IOCTL:
+	{
+		struct aie_rsc *Rscs = (struct aie_rsc *)(uintptr_t)Req->rscs;
+
+		if((Req->req.loc.col >= XAIE_NUM_COLS) ||
+				(Req->req.loc.row >= XAIE_NUM_ROWS) ||
+				(Req->req.mod >= MOCK_NUM_MODS) ||
+				(Req->req.type >= MOCK_NUM_RSC_TYPES) ||
+				(Req->req.num_rscs != 1U)) {
+			break;
+		}
+
+		Bits = &RscMap[Req->req.loc.col][Req->req.loc.row]
+			[Req->req.mod][Req->req.type];
+		for(uint32_t Id = 0U; Id < MOCK_NUM_RSCS; Id++) {
+			if((*Bits & (1U << Id)) == 0U) {
+				*Bits |= (uint8_t)(1U << Id);
+				Rscs[0].loc.col = (__u8)Req->req.loc.col;
+				Rscs[0].loc.row = (__u8)Req->req.loc.row;
+				Rscs[0].mod = Req->req.mod;
+				Rscs[0].type = Req->req.type;
+				Rscs[0].id = Id;
+				return 0;
+			}
+		}
+
+		errno = EBUSY;
+		return -1;
+	}
+	case AIE_RSC_RELEASE_IOCTL:
+	case AIE_RSC_FREE_IOCTL:
+		if((Rsc->loc.col >= XAIE_NUM_COLS) ||
+				(Rsc->loc.row >= XAIE_NUM_ROWS) ||
+				(Rsc->mod >= MOCK_NUM_MODS) ||
+				(Rsc->type >= MOCK_NUM_RSC_TYPES) ||
+				(Rsc->id >= MOCK_NUM_RSCS)) {
+			break;
+		}
+
+		RscMap[Rsc->loc.col][Rsc->loc.row][Rsc->mod][Rsc->type] &=
+			(uint8_t)~(1U << Rsc->id);
+		return 0;
+	default:
+		errno = ENOTTY;
+		return -1;
+	}
+
+	errno = EINVAL;
+	return -1;
+}
+
+static void StopHandler(int Sig)
+{
+	(void)Sig;
+	Stop = 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the broker process. It serves the partition with the Linux
+* backend until it receives SIGTERM.
+*
+* @param	Name: Name of the broker.
+*
+* @return	0 when stopped, BROKER_SKIP_STATUS if the driver has no broker
+*		backend, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int RunBroker(const char *Name)
+{
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	signal(SIGTERM, StopHandler);
+
+	if(MockInit(XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_COL_SHIFT) != 0) {
+		printf("Failed to setup the kernel driver mock.\n");
+		return -1;
+	}
+	Mock.Handler = MockRscIoctl;
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Broker driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = MockSetupBackend(&DevInst);
+	if(RC != XAIE_OK) {
+		return BROKER_SKIP_STATUS;
+	}
+
+	RC = XAie_BrokerServe(&DevInst, Name, &Stop);
+	if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+		return BROKER_SKIP_STATUS;
+	}
+
+	XAie_Finish(&DevInst);
+
+	return (RC == XAIE_OK) ? 0 : -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a device instance of a client of the broker. It
+* waits for the broker to serve.
+*
+* @param	DevInst: Device instance pointer.
+* @param	ConfigPtr: Configuration of the device.
+* @param	Broker: Process id of the broker.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the broker
+*		exited because the driver has no broker backend, error code on
+*		other failures.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC InitClient(XAie_DevInst *DevInst, XAie_Config *ConfigPtr,
+		pid_t Broker)
+{
+	int Status;
+
+	ConfigPtr->BackendName = "broker";
+	for(uint32_t i = 0U; i < BROKER_WAIT_COUNT; i++) {
+		memset(DevInst, 0, sizeof(*DevInst));
+		if(XAie_CfgInitialize(DevInst, ConfigPtr) == XAIE_OK) {
+			return XAIE_OK;
+		}
+
+		if(waitpid(Broker, &Status, WNOHANG) == Broker) {
+			if(WIFEXITED(Status) &&
+				(WEXITSTATUS(Status) == BROKER_SKIP_STATUS)) {
+				return XAIE_FEATURE_NOT_SUPPORTED;
+			}
+			return XAIE_ERR;
+		}
+		usleep(BROKER_WAIT_US);
+	}
+
+	return XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function forks a client which requests a performance counter of the
+* core module of tile (0, 1) and returns it through a pipe.
+*
+* @param	ConfigPtr: Configuration of the device.
+* @param	Broker: Process id of the broker.
+* @param	Fd: Write end of the pipe.
+*
+* @return	Process id of the client, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static pid_t ForkPerfcntClient(XAie_Config *ConfigPtr, pid_t Broker, int Fd)
+{
+	XAie_UserRscReq RscReq = {XAie_TileLoc(0, 1), XAIE_CORE_MOD, 1U};
+	XAie_DevInst DevInst;
+	XAie_UserRsc Rsc;
+	pid_t Pid;
+
+	Pid = fork();
+	if(Pid != 0) {
+		return Pid;
+	}
+
+	if((InitClient(&DevInst, ConfigPtr, Broker) != XAIE_OK) ||
+			(XAie_RequestPerfcnt(&DevInst, 1U, &RscReq, 1U, &Rsc) !=
+			 XAIE_OK) ||
+			(write(Fd, &Rsc.RscId, sizeof(Rsc.RscId)) !=
+			 sizeof(Rsc.RscId))) {
+		_exit(1);
+	}
+
+	XAie_Finish(&DevInst);
+	_exit(0);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that two clients get distinct performance counters of
+* the same module.
+*
+* @param	ConfigPtr: Configuration of the device.
+* @param	Broker: Process id of the broker.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC CheckRscRequests(XAie_Config *ConfigPtr, pid_t Broker)
+{
+	pid_t Clients[2U];
+	u32 RscIds[2U];
+	int Fds[2U], Status;
+	AieRC RC = XAIE_OK;
+
+	if(pipe(Fds) != 0) {
+		return XAIE_ERR;
+	}
+
+	for(uint32_t i = 0U; i < 2U; i++) {
+		Clients[i] = ForkPerfcntClient(ConfigPtr, Broker, Fds[1U]);
+	}
+	close(Fds[1U]);
+
+	for(uint32_t i = 0U; i < 2U; i++) {
+		if(read(Fds[0U], &RscIds[i], sizeof(RscIds[i])) !=
+				sizeof(RscIds[i])) {
+			RC = XAIE_ERR;
+		}
+	}
+	close(Fds[0U]);
+
+	for(uint32_t i = 0U; i < 2U; i++) {
+		if((Clients[i] < 0) || (waitpid(Clients[i], &Status, 0) < 0) ||
+				!WIFEXITED(Status) ||
+				(WEXITSTATUS(Status) != 0)) {
+			RC = XAIE_ERR;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		printf("Performance counter requests of the clients failed.\n");
+		return RC;
+	}
+
+	if(RscIds[0U] == RscIds[1U]) {
+		printf("Clients were granted the same performance counter.\n");
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that a transaction spread over several batches of the
+* broker is applied.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC CheckTransaction(XAie_DevInst *DevInst)
+{
+	u32 *Data, *ReadBack;
+	AieRC RC;
+
+	Data = (u32 *)malloc(TXN_NUM_WORDS * sizeof(*Data));
+	ReadBack = (u32 *)calloc(TXN_NUM_WORDS, sizeof(*ReadBack));
+	if((Data == NULL) || (ReadBack == NULL)) {
+		printf("Failed to allocate memory.\n");
+		free(Data);
+		free(ReadBack);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < TXN_NUM_WORDS; i++) {
+		Data[i] = 0xC0DE0000U + i;
+	}
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	RC |= XAie_BlockWrite32(DevInst, TXN_REG_OFF, Data, TXN_NUM_WORDS);
+	RC |= XAie_SubmitTransaction(DevInst, NULL);
+	RC |= XAie_BlockRead32(DevInst, TXN_REG_OFF, ReadBack, TXN_NUM_WORDS);
+	if((RC != XAIE_OK) || (memcmp(Data, ReadBack,
+					TXN_NUM_WORDS * sizeof(*Data)) != 0)) {
+		printf("Transaction of several batches was not applied.\n");
+		RC = XAIE_ERR;
+	}
+
+	free(Data);
+	free(ReadBack);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that a transaction larger than the ring of the broker
+* is rejected.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The rejected transaction stays with the device instance until
+*		it is finished, so this is the last check of the application.
+*
+*******************************************************************************/
+static AieRC CheckLargeTransaction(XAie_DevInst *DevInst)
+{
+	u32 *Data;
+	AieRC RC;
+
+	Data = (u32 *)calloc(TXN_MAX_WORDS, sizeof(*Data));
+	if(Data == NULL) {
+		printf("Failed to allocate memory.\n");
+		return XAIE_ERR;
+	}
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	RC |= XAie_BlockWrite32(DevInst, TXN_REG_OFF, Data, TXN_MAX_WORDS);
+	if((RC != XAIE_OK) ||
+			(XAie_SubmitTransaction(DevInst, NULL) == XAIE_OK)) {
+		printf("Transaction larger than the ring was not rejected.\n");
+		RC = XAIE_ERR;
+	}
+	free(Data);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function kills a client while the broker executes its poll and checks
+* that the ring keeps serving the application.
+*
+* @param	DevInst: Device instance pointer of the application.
+* @param	ConfigPtr: Configuration of the device.
+* @param	Broker: Process id of the broker.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC CheckDeadClient(XAie_DevInst *DevInst, XAie_Config *ConfigPtr,
+		pid_t Broker)
+{
+	XAie_DevInst ClientInst;
+	int Fds[2U], Status;
+	pid_t Client;
+	u8 Ready = 1U;
+	u32 Value;
+	AieRC RC = XAIE_OK;
+
+	if(pipe(Fds) != 0) {
+		return XAIE_ERR;
+	}
+
+	Client = fork();
+	if(Client == 0) {
+		close(Fds[0U]);
+		if((InitClient(&ClientInst, ConfigPtr, Broker) != XAIE_OK) ||
+				(write(Fds[1U], &Ready, sizeof(Ready)) !=
+				 sizeof(Ready))) {
+			_exit(1);
+		}
+
+		/* Never matches, the client is killed while it waits */
+		(void)XAie_MaskPoll(&ClientInst, REG_OFF, 0x1U, 0x1U,
+				POLL_TIMEOUT_US);
+		_exit(0);
+	}
+	close(Fds[1U]);
+
+	if((Client < 0) || (read(Fds[0U], &Ready, sizeof(Ready)) !=
+				sizeof(Ready))) {
+		close(Fds[0U]);
+		printf("Failed to start the client.\n");
+		return XAIE_ERR;
+	}
+	close(Fds[0U]);
+
+	usleep(BROKER_WAIT_US);
+	kill(Client, SIGKILL);
+	waitpid(Client, &Status, 0);
+
+	for(u32 i = 0U; (i < NUM_READS) && (RC == XAIE_OK); i++) {
+		RC = XAie_Write32(DevInst, REG_OFF + 4U, i);
+		RC |= XAie_Read32(DevInst, REG_OFF + 4U, &Value);
+		if((RC == XAIE_OK) && (Value != i)) {
+			RC = XAIE_ERR;
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		printf("Broker did not recover from a killed client.\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the broker backend test.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	char Name[64U];
+	int Status;
+	pid_t Broker;
+	u32 Value = 0U;
+	AieRC RC;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	snprintf(Name, sizeof(Name), BROKER_NAME_FMT, (int)getpid());
+	setenv("XAIE_BROKER_NAME", Name, 1);
+
+	fflush(stdout);
+	Broker = fork();
+	if(Broker < 0) {
+		printf("Failed to fork the broker.\n");
+		return -1;
+	}
+
+	if(Broker == 0) {
+		_exit(RunBroker(Name));
+	}
+
+	RC = InitClient(&DevInst, &ConfigPtr, Broker);
+	if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+		printf("Broker backend is not available, skipping.\n");
+		return 0;
+	} else if(RC != XAIE_OK) {
+		printf("Failed to attach to the broker.\n");
+		kill(Broker, SIGTERM);
+		return -1;
+	}
+
+	RC = XAie_Write32(&DevInst, REG_OFF, 0x12345678U);
+	RC |= XAie_Read32(&DevInst, REG_OFF, &Value);
+	if((RC != XAIE_OK) || (Value != 0x12345678U)) {
+		printf("Register write through the broker failed.\n");
+		RC = XAIE_ERR;
+	}
+
+	if(RC == XAIE_OK) {
+		RC = CheckRscRequests(&ConfigPtr, Broker);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = CheckTransaction(&DevInst);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = CheckDeadClient(&DevInst, &ConfigPtr, Broker);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = CheckLargeTransaction(&DevInst);
+	}
+
+	XAie_Finish(&DevInst);
+
+	kill(Broker, SIGTERM);
+	if((waitpid(Broker, &Status, 0) != Broker) || !WIFEXITED(Status) ||
+			(WEXITSTATUS(Status) != 0)) {
+		printf("Broker did not stop cleanly.\n");
+		RC = XAIE_ERR;
+	}
+
+	if(RC != XAIE_OK) {
+		return -1;
+	}
+
+	printf("Broker backend test success.\n");
+
+	return 0;
+}
+
+/** @} */
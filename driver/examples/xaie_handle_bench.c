@@ -0,0 +1,238 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_handle_bench.c
+* @{
+*
+* This file contains a microbenchmark of the lock, DMA channel and performance
+* counter handles against the matching per call APIs.
+*
+* Both access an in-memory backend standing in for the registers of a one
+* column AIE-ML partition. The application first checks that each handle
+* function writes the same registers, or polls the same register, as the per
+* call API, then reports the ns/op of both. Build the application with
+* optimizations for meaningful numbers, e.g.
+* make CFLAGS="-O2 -Wall -Wextra".
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xaie_mem_backend.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		10U
+#define XAIE_COL_SHIFT		25U
+#define XAIE_ROW_SHIFT		20U
+#define XAIE_SHIM_ROW		0U
+#define XAIE_MEM_TILE_ROW_START	1U
+#define XAIE_MEM_TILE_NUM_ROWS	1U
+#define XAIE_AIE_TILE_ROW_START	2U
+#define XAIE_AIE_TILE_NUM_ROWS	8U
+
+/* The partition starts on a shim NoC column */
+#define PART_START_COL		2U
+#define REG_SPACE_SIZE		(XAIE_NUM_ROWS << XAIE_ROW_SHIFT)
+#define NUM_ITERATIONS		1000000U
+#define NUM_RUNS		7U
+
+/*
+ * Runs an API NUM_RUNS times NUM_ITERATIONS times, the loop index i can be
+ * used in its arguments. Stores the ns/op of the fastest run in Ns and ORs the
+ * return codes in RC.
+ */
+#define BENCH_LOOP(Ns, Call)						\
+	do {								\
+		uint64_t Best = UINT64_MAX;				\
+		for(u32 Run = 0U; Run < NUM_RUNS; Run++) {		\
+			uint64_t Start = MemTimeNs();			\
+			for(u32 i = 0U; i < NUM_ITERATIONS; i++) {	\
+				RC |= (Call);				\
+			}						\
+			Start = MemTimeNs() - Start;			\
+			Best = (Start < Best) ? Start : Best;		\
+		}							\
+		(Ns) = (double)Best / NUM_ITERATIONS;			\
+	} while(0)
+
+/*
+ * Runs the per call API and the handle function on cleared registers and
+ * fails if they do not leave the same register values.
+ */
+#define CHECK_SAME_WRITE(Name, ApiCall, HandleCall)			\
+	do {								\
+		memset(MemRegs, 0, REG_SPACE_SIZE);			\
+		RC = (ApiCall);						\
+		memcpy(Ref, MemRegs, REG_SPACE_SIZE);			\
+		memset(MemRegs, 0, REG_SPACE_SIZE);			\
+		RC |= (HandleCall);					\
+		if((RC != XAIE_OK) ||					\
+				(memcmp(Ref, MemRegs, REG_SPACE_SIZE) != 0)) { \
+			printf("%s: handle differs from the API.\n",	\
+					(Name));			\
+			return -1;					\
+		}							\
+	} while(0)
+
+/*
+ * Runs the per call API and the handle function and fails if they do not
+ * poll the same register. Leaves the polled register set to Value, so that
+ * the following polls succeed.
+ */
+#define CHECK_SAME_POLL(Name, ApiCall, HandleCall, Value)		\
+	do {								\
+		u64 ApiPoll;						\
+		memset(MemRegs, 0, REG_SPACE_SIZE);			\
+		MemLastPoll = UINT64_MAX;				\
+		(void)(ApiCall);					\
+		ApiPoll = MemLastPoll;					\
+		MemLastPoll = UINT64_MAX;				\
+		(void)(HandleCall);					\
+		if((ApiPoll == UINT64_MAX) || (ApiPoll != MemLastPoll)) { \
+			printf("%s: handle differs from the API.\n",	\
+					(Name));			\
+			return -1;					\
+		}							\
+		MemRegs[ApiPoll / 4U] = (Value);			\
+	} while(0)
+
+/************************** Function Definitions *****************************/
+static void Report(const char *Name, double ApiNs, double HandleNs)
+{
+	printf("%-16s %6.1f -> %5.1f ns/op\n", Name, ApiNs, HandleNs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the handle microbenchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	u32 *Ref;
+	u32 ApiVal, HandleVal;
+	double ApiNs, HandleNs;
+	XAie_LocType Tile = XAie_TileLoc(0, XAIE_AIE_TILE_ROW_START);
+	XAie_Lock Lock = XAie_LockInit(3, 1);
+	XAie_LockHandle LockHandle;
+	XAie_DmaChannelHandle ChHandle;
+	XAie_PerfCounterHandle PcHandle;
+
+	Ref = (u32 *)malloc(REG_SPACE_SIZE);
+	if((Ref == NULL) || (MemBackendInit(REG_SPACE_SIZE) != 0)) {
+		printf("Failed to initialize the benchmark.\n");
+		return -1;
+	}
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			PART_START_COL + 1U, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	ConfigPtr.BackendName = MEM_BACKEND_NAME;
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+	XAie_SetupPartitionConfig(&DevInst, XAIE_BASE_ADDR, PART_START_COL,
+			1U);
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_LockHandleInit(&DevInst, &LockHandle, Tile, Lock.LockId,
+			Lock.LockVal, Lock.LockVal);
+	RC |= XAie_DmaChannelHandleInit(&DevInst, &ChHandle, Tile, 0U,
+			DMA_S2MM);
+	RC |= XAie_PerfCounterHandleInit(&DevInst, &PcHandle, Tile,
+			XAIE_CORE_MOD, 1U);
+	if(RC != XAIE_OK) {
+		printf("Handle initialization failed.\n");
+		return -1;
+	}
+
+	CHECK_SAME_POLL("Lock acquire",
+			XAie_LockAcquire(&DevInst, Tile, Lock, 0U),
+			XAie_LockHandleAcquire(&LockHandle, 0U),
+			XAIE_LOCK_REQ_RESULT_SUCCESS);
+	BENCH_LOOP(ApiNs, XAie_LockAcquire(&DevInst, Tile, Lock, 0U));
+	BENCH_LOOP(HandleNs, XAie_LockHandleAcquire(&LockHandle, 0U));
+	Report("Lock acquire", ApiNs, HandleNs);
+
+	CHECK_SAME_POLL("Lock release",
+			XAie_LockRelease(&DevInst, Tile, Lock, 0U),
+			XAie_LockHandleRelease(&LockHandle, 0U),
+			XAIE_LOCK_REQ_RESULT_SUCCESS);
+	BENCH_LOOP(ApiNs, XAie_LockRelease(&DevInst, Tile, Lock, 0U));
+	BENCH_LOOP(HandleNs, XAie_LockHandleRelease(&LockHandle, 0U));
+	Report("Lock release", ApiNs, HandleNs);
+
+	CHECK_SAME_WRITE("Push BD",
+			XAie_DmaChannelPushBdToQueue(&DevInst, Tile, 0U,
+				DMA_S2MM, 5U),
+			XAie_DmaChannelHandlePushBd(&ChHandle, 5U));
+	BENCH_LOOP(ApiNs, XAie_DmaChannelPushBdToQueue(&DevInst, Tile, 0U,
+				DMA_S2MM, (u8)(i & 7U)));
+	BENCH_LOOP(HandleNs, XAie_DmaChannelHandlePushBd(&ChHandle,
+				(u8)(i & 7U)));
+	Report("Push BD", ApiNs, HandleNs);
+
+	CHECK_SAME_POLL("Wait for done",
+			XAie_DmaWaitForDone(&DevInst, Tile, 0U, DMA_S2MM, 0U),
+			XAie_DmaChannelHandleWaitForDone(&ChHandle, 0U), 0U);
+	BENCH_LOOP(ApiNs, XAie_DmaWaitForDone(&DevInst, Tile, 0U, DMA_S2MM,
+				0U));
+	BENCH_LOOP(HandleNs, XAie_DmaChannelHandleWaitForDone(&ChHandle, 0U));
+	Report("Wait for done", ApiNs, HandleNs);
+
+	CHECK_SAME_WRITE("Counter set",
+			XAie_PerfCounterSet(&DevInst, Tile, XAIE_CORE_MOD, 1U,
+				0x1234U),
+			XAie_PerfCounterHandleSet(&PcHandle, 0x1234U));
+	BENCH_LOOP(ApiNs, XAie_PerfCounterSet(&DevInst, Tile, XAIE_CORE_MOD,
+				1U, i));
+	BENCH_LOOP(HandleNs, XAie_PerfCounterHandleSet(&PcHandle, i));
+	Report("Counter set", ApiNs, HandleNs);
+
+	/* The counter was set by the handle, both have to read it back */
+	RC = XAie_PerfCounterHandleSet(&PcHandle, 0x5678U);
+	RC |= XAie_PerfCounterGet(&DevInst, Tile, XAIE_CORE_MOD, 1U, &ApiVal);
+	RC |= XAie_PerfCounterHandleGet(&PcHandle, &HandleVal);
+	if((RC != XAIE_OK) || (ApiVal != 0x5678U) || (HandleVal != ApiVal)) {
+		printf("Counter get: handle differs from the API.\n");
+		return -1;
+	}
+	BENCH_LOOP(ApiNs, XAie_PerfCounterGet(&DevInst, Tile, XAIE_CORE_MOD,
+				1U, &ApiVal));
+	BENCH_LOOP(HandleNs, XAie_PerfCounterHandleGet(&PcHandle,
+				&HandleVal));
+	Report("Counter get", ApiNs, HandleNs);
+
+	if(RC != XAIE_OK) {
+		printf("Benchmarked APIs failed.\n");
+		return -1;
+	}
+
+	XAie_Finish(&DevInst);
+	free(Ref);
+	free(MemRegs);
+
+	printf("Handle benchmark success.\n");
+
+	return 0;
+}
+
+/** @} */
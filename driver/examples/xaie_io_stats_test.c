@@ -0,0 +1,370 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_stats_test.c
+* @{
+*
+* This file contains a test of the IO operation statistics on the Linux backend
+* with the mock of the kernel driver in xaie_linux_mock.h.
+*
+* The application checks that the operations are attributed to the public API
+* called, that the statistics of the exited threads are kept, that a reset
+* concurrent with threads issuing operations does not lose or tear the
+* statistics, and that a caller array which is too small is reported. It then
+* compares the time of a configuration with the statistics disabled and with
+* the default sampling, and checks that the statistics add less than 2%. The
+* driver has to be built with XAIE_FEATURE_IO_STATS_ENABLE, the application
+* exits early otherwise.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <stdlib.h>
+#include "xaie_linux_mock.h"
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		2
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+#define NUM_THREADS		4U
+#define NUM_ITERATIONS		200U
+#define NUM_RESETS		1000U
+#define NUM_OVERHEAD_RUNS	1000U
+#define NUM_OVERHEAD_TRIES	3U
+#define MAX_OVERHEAD_PERCENT	2U
+#define DEFAULT_PERIOD		256U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function enables a circuit switched connection on all the AIE tiles of
+* the partition.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC ConfigTiles(XAie_DevInst *DevInst)
+{
+	AieRC RC = XAIE_OK;
+
+	for(uint8_t Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		for(uint8_t Row = XAIE_AIE_TILE_ROW_START; Row < XAIE_NUM_ROWS;
+				Row++) {
+			RC |= XAie_StrmConnCctEnable(DevInst,
+					XAie_TileLoc(Col, Row),
+					SOUTH, 0U, NORTH, 0U);
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function enables a circuit switched connection on all the AIE tiles of
+* the partition a number of times.
+*
+* @param	Arg: Device instance pointer.
+*
+* @return	NULL on success, non NULL on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void *RunConfig(void *Arg)
+{
+	XAie_DevInst *DevInst = (XAie_DevInst *)Arg;
+	AieRC RC = XAIE_OK;
+
+	for(uint32_t i = 0U; i < NUM_ITERATIONS; i++) {
+		RC |= ConfigTiles(DevInst);
+	}
+
+	return (RC == XAIE_OK) ? NULL : Arg;
+}
+
+static uint64_t NumOps(const XAie_IoStats *Stats)
+{
+	uint64_t Count = 0U;
+
+	for(uint32_t Op = 0U; Op < XAIE_IO_STATS_OP_MAX; Op++) {
+		Count += Stats->Ops[Op].Count;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the configuration in a number of threads and returns the
+* number of operations recorded.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Reset: Reset the statistics while the threads are running.
+*
+* @return	Number of operations, 0 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static uint64_t RunThreads(XAie_DevInst *DevInst, uint8_t Reset)
+{
+	pthread_t Threads[NUM_THREADS];
+	uint8_t Failed = 0U;
+	XAie_IoStats Stats;
+
+	XAie_ResetIoStats();
+	for(uint32_t i = 0U; i < NUM_THREADS; i++) {
+		if(pthread_create(&Threads[i], NULL, RunConfig, DevInst) != 0) {
+			printf("Failed to create thread.\n");
+			return 0U;
+		}
+	}
+
+	for(uint32_t i = 0U; (Reset != 0U) && (i < NUM_RESETS); i++) {
+		XAie_ResetIoStats();
+	}
+
+	for(uint32_t i = 0U; i < NUM_THREADS; i++) {
+		void *Ret;
+
+		pthread_join(Threads[i], &Ret);
+		if(Ret != NULL) {
+			Failed = 1U;
+		}
+	}
+
+	if((Failed != 0U) || (XAie_GetIoStats(&Stats) != XAIE_OK)) {
+		printf("Configuration failed.\n");
+		return 0U;
+	}
+
+	return NumOps(&Stats);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function times the configuration of the tiles with the statistics
+* disabled and with the default sampling. The runs alternate to be equally
+* affected by the noise of the system and the shortest run of each is
+* returned.
+*
+* @param	DevInst: Device instance pointer.
+* @param	DisabledNs: Pointer to return the time with the statistics
+*		disabled.
+* @param	EnabledNs: Pointer to return the time with the default
+*		sampling.
+*
+* @return	0 on success, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int TimeConfig(XAie_DevInst *DevInst, uint64_t *DisabledNs,
+		uint64_t *EnabledNs)
+{
+	*DisabledNs = UINT64_MAX;
+	*EnabledNs = UINT64_MAX;
+
+	for(uint32_t i = 0U; i < 2U * NUM_OVERHEAD_RUNS; i++) {
+		uint64_t *MinNs = ((i & 1U) != 0U) ? EnabledNs : DisabledNs;
+		uint64_t Start;
+
+		XAie_SetIoStatsSampling(((i & 1U) != 0U) ? DEFAULT_PERIOD : 0U,
+				XAIE_DISABLE);
+		Start = MockTimeNs();
+		if(ConfigTiles(DevInst) != XAIE_OK) {
+			return -1;
+		}
+		Start = MockTimeNs() - Start;
+		if(Start < *MinNs) {
+			*MinNs = Start;
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the IO statistics test.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	XAie_IoStats Stats;
+	XAie_IoCallerStats *Callers;
+	uint64_t Count, CallerCount = 0U, DisabledNs, EnabledNs;
+	u32 NumCallers = 0U;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	if(XAie_ResetIoStats() == XAIE_FEATURE_NOT_SUPPORTED) {
+		printf("IO statistics are not enabled, skipping.\n");
+		return 0;
+	}
+
+	if(MockInit(XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_COL_SHIFT) != 0) {
+		printf("Failed to setup the kernel driver mock.\n");
+		return -1;
+	}
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = MockSetupBackend(&DevInst);
+	if(RC != XAIE_OK) {
+		printf("Linux backend is not available, skipping.\n");
+		return 0;
+	}
+
+	/* Operations of the calling thread are attributed to the API */
+	XAie_SetIoStatsSampling(1U, XAIE_ENABLE);
+	XAie_ResetIoStats();
+	if(RunConfig(&DevInst) != NULL) {
+		printf("Configuration failed.\n");
+		return -1;
+	}
+	XAie_GetIoStats(&Stats);
+	Count = NumOps(&Stats);
+
+	RC = XAie_GetIoCallerStats(NULL, &NumCallers);
+	if((RC != XAIE_INSUFFICIENT_BUFFER_SIZE) ||
+			(NumCallers != Stats.NumCallers) || (NumCallers == 0U)) {
+		printf("Number of callers is not reported.\n");
+		return -1;
+	}
+
+	Callers = (XAie_IoCallerStats *)calloc(NumCallers, sizeof(*Callers));
+	if(Callers == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+
+	RC = XAie_GetIoCallerStats(Callers, &NumCallers);
+	if(RC != XAIE_OK) {
+		printf("Failed to get the caller statistics.\n");
+		return -1;
+	}
+
+	for(u32 i = 0U; i < NumCallers; i++) {
+		printf("%-32s %8lu ops %10lu ns\n",
+				(Callers[i].ApiName != NULL) ?
+				Callers[i].ApiName : "(unknown)",
+				(unsigned long)Callers[i].Count,
+				(unsigned long)Callers[i].TotalNs);
+		CallerCount += Callers[i].Count;
+	}
+
+	if((Count == 0U) || (CallerCount + Stats.NumLost != Count) ||
+			(Callers[0].ApiName == NULL) ||
+			(strcmp(Callers[0].ApiName, "XAie_StrmConnCctEnable")
+			 != 0) || (Callers[0].Count != Count)) {
+		printf("Operations are not attributed to the public API.\n");
+		return -1;
+	}
+	free(Callers);
+
+	/* Statistics of the exited threads are kept */
+	if(RunThreads(&DevInst, 0U) != NUM_THREADS * Count) {
+		printf("Operations of the exited threads are lost.\n");
+		return -1;
+	}
+
+	/* Concurrent resets leave consistent statistics */
+	RunThreads(&DevInst, 1U);
+	XAie_GetIoStats(&Stats);
+	for(uint32_t Op = 0U; Op < XAIE_IO_STATS_OP_MAX; Op++) {
+		uint64_t HistCount = 0U;
+
+		for(uint32_t i = 0U; i < XAIE_IO_STATS_HIST_BUCKETS; i++) {
+			HistCount += Stats.Ops[Op].Hist[i];
+		}
+
+		if((HistCount != Stats.Ops[Op].NumTimed) ||
+				(Stats.Ops[Op].NumTimed != Stats.Ops[Op].Count)) {
+			printf("Statistics are torn by a concurrent reset.\n");
+			return -1;
+		}
+	}
+
+	/*
+	 * The default sampling adds less than 2% to the configuration. The
+	 * measure is repeated if it was disturbed by the system.
+	 */
+	for(uint32_t i = 0U; i < NUM_OVERHEAD_TRIES; i++) {
+		XAie_ResetIoStats();
+		if(TimeConfig(&DevInst, &DisabledNs, &EnabledNs) != 0) {
+			printf("Configuration failed.\n");
+			return -1;
+		}
+		XAie_GetIoStats(&Stats);
+		printf("Configuration: %10lu ns disabled %10lu ns enabled\n",
+				(unsigned long)DisabledNs,
+				(unsigned long)EnabledNs);
+		if(NumOps(&Stats) * NUM_ITERATIONS !=
+				NUM_OVERHEAD_RUNS * Count) {
+			printf("Operations are not counted.\n");
+			return -1;
+		}
+
+		if(EnabledNs * 100U <=
+				DisabledNs * (100U + MAX_OVERHEAD_PERCENT)) {
+			break;
+		}
+	}
+
+	if(EnabledNs * 100U > DisabledNs * (100U + MAX_OVERHEAD_PERCENT)) {
+		printf("Statistics overhead is above %u%%.\n",
+				MAX_OVERHEAD_PERCENT);
+		return -1;
+	}
+
+	XAie_Finish(&DevInst);
+
+	printf("IO statistics test success.\n");
+
+	return 0;
+}
+
+/** @} */
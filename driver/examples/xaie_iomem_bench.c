@@ -0,0 +1,189 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_iomem_bench.c
+* @{
+*
+* This file contains a microbenchmark of the copy and fill routines used by the
+* IO backends for the AI engine memories mapped to the user space.
+*
+* The routines run on ordinary host memory here. The application first checks
+* them against a word by word reference for every combination of destination
+* misalignment and a range of sizes, including the words around the
+* destination. Then it reports the throughput of the routines and of the word
+* by word loops they replace for a 64KB transfer. The implementation used is
+* the one selected for the host cpu.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <xaiengine.h>
+#include <xaiengine/xaie_io_memops.h>
+
+/************************** Constant Definitions *****************************/
+#define GUARD_WORDS		16U
+#define MAX_CHECK_WORDS		256U
+#define BENCH_WORDS		(64U * 1024U / 4U)
+#define NUM_ITERATIONS		2000U
+#define FILL_PATTERN		0xA5A5A5A5U
+#define GUARD_PATTERN		0xDEADBEEFU
+
+/************************** Function Definitions *****************************/
+static uint64_t TimeNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (uint64_t)Ts.tv_sec * 1000000000ULL + (uint64_t)Ts.tv_nsec;
+}
+
+static void ScalarCopy32(volatile u32 *Dest, const u32 *Src, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		Dest[i] = Src[i];
+	}
+}
+
+static void ScalarSet32(volatile u32 *Dest, u32 Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		Dest[i] = Data;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the copy and fill routines against the word by word
+* reference for all the destination misalignments within 32 bytes.
+*
+* @param	None.
+*
+* @return	0 on success, -1 on mismatch.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int CheckRoutines(void)
+{
+	static u32 Dst[MAX_CHECK_WORDS + 2U * GUARD_WORDS]
+		__attribute__((aligned(64)));
+	static u32 Ref[MAX_CHECK_WORDS + 2U * GUARD_WORDS]
+		__attribute__((aligned(64)));
+	static u32 Src[MAX_CHECK_WORDS];
+
+	for(u32 i = 0U; i < MAX_CHECK_WORDS; i++) {
+		Src[i] = i * 0x01010101U + 1U;
+	}
+
+	for(u32 Offset = 0U; Offset < 8U; Offset++) {
+		for(u32 Size = 0U; Size <= MAX_CHECK_WORDS - 8U; Size++) {
+			for(u32 i = 0U; i < sizeof(Dst) / sizeof(Dst[0]); i++) {
+				Dst[i] = GUARD_PATTERN;
+				Ref[i] = GUARD_PATTERN;
+			}
+
+			_XAie_IOMem_Copy32(&Dst[GUARD_WORDS + Offset], Src,
+					Size);
+			ScalarCopy32(&Ref[GUARD_WORDS + Offset], Src, Size);
+			if(memcmp(Dst, Ref, sizeof(Dst)) != 0) {
+				printf("Copy mismatch, offset %u size %u\n",
+						Offset, Size);
+				return -1;
+			}
+
+			_XAie_IOMem_Set32(&Dst[GUARD_WORDS + Offset],
+					FILL_PATTERN, Size);
+			ScalarSet32(&Ref[GUARD_WORDS + Offset], FILL_PATTERN,
+					Size);
+			if(memcmp(Dst, Ref, sizeof(Dst)) != 0) {
+				printf("Fill mismatch, offset %u size %u\n",
+						Offset, Size);
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void Report(const char *Name, uint64_t Ns)
+{
+	double Bytes = (double)BENCH_WORDS * 4.0 * NUM_ITERATIONS;
+
+	printf("%-14s %8.2f GB/s\n", Name, Bytes / (double)Ns);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the copy and fill microbenchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	u32 *Src, *Dst;
+	uint64_t Start;
+
+	if(CheckRoutines() != 0) {
+		return -1;
+	}
+
+	Src = (u32 *)aligned_alloc(64U, BENCH_WORDS * sizeof(u32));
+	Dst = (u32 *)aligned_alloc(64U, BENCH_WORDS * sizeof(u32));
+	if((Src == NULL) || (Dst == NULL)) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+	memset(Src, 0x5A, BENCH_WORDS * sizeof(u32));
+	memset(Dst, 0, BENCH_WORDS * sizeof(u32));
+
+	Start = TimeNs();
+	for(u32 i = 0U; i < NUM_ITERATIONS; i++) {
+		ScalarCopy32(Dst, Src, BENCH_WORDS);
+	}
+	Report("Scalar copy", TimeNs() - Start);
+
+	Start = TimeNs();
+	for(u32 i = 0U; i < NUM_ITERATIONS; i++) {
+		_XAie_IOMem_Copy32(Dst, Src, BENCH_WORDS);
+	}
+	Report("IOMem copy", TimeNs() - Start);
+
+	Start = TimeNs();
+	for(u32 i = 0U; i < NUM_ITERATIONS; i++) {
+		ScalarSet32(Dst, 0U, BENCH_WORDS);
+	}
+	Report("Scalar fill", TimeNs() - Start);
+
+	Start = TimeNs();
+	for(u32 i = 0U; i < NUM_ITERATIONS; i++) {
+		_XAie_IOMem_Set32(Dst, 0U, BENCH_WORDS);
+	}
+	Report("IOMem fill", TimeNs() - Start);
+
+	free(Src);
+	free(Dst);
+
+	printf("IO memory copy and fill benchmark success.\n");
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,339 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_linux_mock.h
+* @{
+*
+* This file contains a mock of the AI engine kernel driver for the examples
+* which exercise the Linux IO backend without hardware.
+*
+* The mock overrides open() and ioctl() of the application. Opening /dev/aie0
+* returns a memory file, requesting a partition returns another memory file
+* which backs the registers of the partition, and the memories of the AIE
+* tiles are backed by memory files as well. Hence the read only mappings done
+* by the backend work unmodified. Register write, transaction and resource
+* ioctls update the backing memory and are counted. Every mocked ioctl also
+* issues one real system call so that the cost of crossing into the kernel is
+* part of the measured time. All other file descriptors are passed to the
+* kernel.
+*
+* The examples including this file have to be linked against a driver built
+* with the Linux backend (-D__AIELINUX__). They exit early if the backend
+* cannot be initialized.
+*
+******************************************************************************/
+#ifndef XAIE_LINUX_MOCK_H
+#define XAIE_LINUX_MOCK_H
+
+/***************************** Include Files *********************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <xaiengine.h>
+#include <xaiengine/xaie_helper.h>
+#include <xaiengine/xaie_io.h>
+#include <xaiengine/xlnx-ai-engine.h>
+
+/************************** Constant Definitions *****************************/
+#define MOCK_DEV_PATH		"/dev/aie0"
+#define MOCK_NUM_MEMS		2U
+#define MOCK_PROG_MEM_OFF	0x20000U
+#define MOCK_PROG_MEM_SIZE	(16U * 1024U)
+#define MOCK_DATA_MEM_OFF	0x0U
+#define MOCK_DATA_MEM_SIZE	(32U * 1024U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	int DevFd;		/* File descriptor returned for /dev/aie0 */
+	int PartFd;		/* File descriptor of the partition */
+	int MemFd[MOCK_NUM_MEMS];
+	unsigned char *Regs;	/* Writable mapping of the registers */
+	uint64_t RegSize;
+	uint32_t NumCols;
+	uint32_t NumRows;
+	uint64_t NumIoctls;	/* Number of partition ioctls */
+	uint64_t NumRegIoctls;	/* Number of register access ioctls */
+	uint64_t NumTxnCmds;	/* Number of commands in transactions */
+	/* Optional handler for the ioctls not handled by the mock */
+	int (*Handler)(unsigned long Request, void *Arg);
+} XAie_LinuxMock;
+
+/************************** Variable Definitions *****************************/
+static XAie_LinuxMock Mock = {.DevFd = -1, .PartFd = -1};
+
+/************************** Function Definitions *****************************/
+static int _MockMemFd(const char *Name, uint64_t Size)
+{
+	int Fd = (int)syscall(SYS_memfd_create, Name, 0U);
+
+	if(Fd < 0) {
+		return -1;
+	}
+
+	if(ftruncate(Fd, (off_t)Size) < 0) {
+		close(Fd);
+		return -1;
+	}
+
+	return Fd;
+}
+
+static inline uint64_t MockTimeNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (uint64_t)Ts.tv_sec * 1000000000ULL + (uint64_t)Ts.tv_nsec;
+}
+
+static inline void MockResetCounters(void)
+{
+	Mock.NumIoctls = 0U;
+	Mock.NumRegIoctls = 0U;
+	Mock.NumTxnCmds = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares the mock for a partition. It has to be called before
+* the Linux backend is initialized.
+*
+* @param	NumCols: Number of columns of the partition.
+* @param	NumRows: Number of rows of the partition.
+* @param	ColShift: Column shift of the device.
+*
+* @return	0 on success, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int MockInit(uint32_t NumCols, uint32_t NumRows, uint8_t ColShift)
+{
+	Mock.NumCols = NumCols;
+	Mock.NumRows = NumRows;
+	Mock.RegSize = (uint64_t)NumCols << ColShift;
+
+	Mock.PartFd = _MockMemFd("aie-mock-regs", Mock.RegSize);
+	if(Mock.PartFd < 0) {
+		return -1;
+	}
+
+	Mock.Regs = (unsigned char *)mmap(NULL, Mock.RegSize,
+			PROT_READ | PROT_WRITE, MAP_SHARED, Mock.PartFd, 0);
+	if(Mock.Regs == MAP_FAILED) {
+		close(Mock.PartFd);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function switches the device instance to the Linux backend unless it is
+* already the default backend of the driver.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code if the driver is built without the
+*		Linux backend.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC MockSetupBackend(XAie_DevInst *DevInst)
+{
+	if(DevInst->Backend->Type == XAIE_IO_BACKEND_LINUX) {
+		return XAIE_OK;
+	}
+
+	return XAie_SetIOBackend(DevInst, XAIE_IO_BACKEND_LINUX);
+}
+
+static void _MockWrite(uint64_t RegOff, uint32_t Mask, uint32_t Value)
+{
+	volatile uint32_t *Reg = (volatile uint32_t *)(Mock.Regs + RegOff);
+
+	if(RegOff + sizeof(uint32_t) > Mock.RegSize) {
+		return;
+	}
+
+	if(Mask == 0U) {
+		*Reg = Value;
+	} else {
+		*Reg = (*Reg & ~Mask) | (Value & Mask);
+	}
+}
+
+static int _MockGetMem(struct aie_mem_args *Args)
+{
+	const uint64_t Offset[MOCK_NUM_MEMS] = {MOCK_PROG_MEM_OFF,
+		MOCK_DATA_MEM_OFF};
+	const uint64_t Size[MOCK_NUM_MEMS] = {MOCK_PROG_MEM_SIZE,
+		MOCK_DATA_MEM_SIZE};
+
+	if(Args->num_mems == 0U) {
+		Args->num_mems = MOCK_NUM_MEMS;
+		return 0;
+	}
+
+	for(uint32_t i = 0U; i < MOCK_NUM_MEMS; i++) {
+		struct aie_mem *Mem = &Args->mems[i];
+
+		Mock.MemFd[i] = _MockMemFd("aie-mock-mem",
+				Size[i] * Mock.NumCols * Mock.NumRows);
+		if(Mock.MemFd[i] < 0) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		Mem->range.start.col = 0U;
+		Mem->range.start.row = 0U;
+		Mem->range.size.col = Mock.NumCols;
+		Mem->range.size.row = Mock.NumRows;
+		Mem->offset = Offset[i];
+		Mem->size = Size[i];
+		Mem->fd = Mock.MemFd[i];
+	}
+
+	return 0;
+}
+
+static int _MockRegAccess(struct aie_reg_args *Args)
+{
+	uint32_t *Data = (uint32_t *)(uintptr_t)Args->dataptr;
+
+	Mock.NumRegIoctls++;
+	switch(Args->op) {
+	case AIE_REG_WRITE:
+		_MockWrite(Args->offset, Args->mask, Args->val);
+		break;
+	case AIE_REG_BLOCKWRITE:
+		for(uint32_t i = 0U; i < Args->len; i++) {
+			_MockWrite(Args->offset + i * 4U, 0U, Data[i]);
+		}
+		break;
+	case AIE_REG_BLOCKSET:
+		for(uint32_t i = 0U; i < Args->len; i++) {
+			_MockWrite(Args->offset + i * 4U, 0U, Args->val);
+		}
+		break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int _MockTxn(struct aie_txn_inst *Args)
+{
+	XAie_TxnCmd *Cmds = (XAie_TxnCmd *)(uintptr_t)Args->cmdsptr;
+
+	for(uint32_t i = 0U; i < Args->num_cmds; i++) {
+		XAie_TxnCmd *Cmd = &Cmds[i];
+		uint32_t *Data = (uint32_t *)(uintptr_t)Cmd->DataPtr;
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			_MockWrite(Cmd->RegOff, Cmd->Mask, Cmd->Value);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			for(uint32_t j = 0U; j < Cmd->Size; j++) {
+				_MockWrite(Cmd->RegOff + j * 4U, 0U, Data[j]);
+			}
+			break;
+		case XAIE_IO_BLOCKSET:
+			for(uint32_t j = 0U; j < Cmd->Size; j++) {
+				_MockWrite(Cmd->RegOff + j * 4U, 0U,
+						Cmd->Value);
+			}
+			break;
+		default:
+			errno = EINVAL;
+			return -1;
+		}
+	}
+	Mock.NumTxnCmds += Args->num_cmds;
+
+	return 0;
+}
+
+int open(const char *Path, int Flags, ...)
+{
+	mode_t Mode = 0U;
+
+	if((Flags & O_CREAT) != 0) {
+		va_list Ap;
+
+		va_start(Ap, Flags);
+		Mode = (mode_t)va_arg(Ap, int);
+		va_end(Ap);
+	}
+
+	if(strcmp(Path, MOCK_DEV_PATH) == 0) {
+		Mock.DevFd = _MockMemFd("aie-mock-dev", 0U);
+		return Mock.DevFd;
+	}
+
+	return (int)syscall(SYS_openat, AT_FDCWD, Path, Flags, Mode);
+}
+
+int ioctl(int Fd, unsigned long Request, ...)
+{
+	va_list Ap;
+	void *Arg;
+
+	va_start(Ap, Request);
+	Arg = va_arg(Ap, void *);
+	va_end(Ap);
+
+	if((Fd < 0) || ((Fd != Mock.DevFd) && (Fd != Mock.PartFd))) {
+		return (int)syscall(SYS_ioctl, Fd, Request, Arg);
+	}
+
+	/* Account for the cost of entering the kernel */
+	(void)syscall(SYS_getppid);
+
+	if(Fd == Mock.DevFd) {
+		if(Request == AIE_REQUEST_PART_IOCTL) {
+			return Mock.PartFd;
+		}
+		errno = ENOTTY;
+		return -1;
+	}
+
+	Mock.NumIoctls++;
+	switch(Request) {
+	case AIE_GET_MEM_IOCTL:
+		return _MockGetMem((struct aie_mem_args *)Arg);
+	case AIE_REG_IOCTL:
+		return _MockRegAccess((struct aie_reg_args *)Arg);
+	case AIE_TRANSACTION_IOCTL:
+		return _MockTxn((struct aie_txn_inst *)Arg);
+	default:
+		if(Mock.Handler != NULL) {
+			return Mock.Handler(Request, Arg);
+		}
+		errno = ENOTTY;
+		return -1;
+	}
+}
+
+#endif /* XAIE_LINUX_MOCK_H */
+
+/** @} */
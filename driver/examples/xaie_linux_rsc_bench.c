@@ -0,0 +1,306 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_linux_rsc_bench.c
+* @{
+*
+* This file contains a benchmark of the resource requests of the Linux backend
+* against the mock of the kernel driver in xaie_linux_mock.h.
+*
+* The application requests and releases a performance counter of the core
+* module of every AIE tile of a 400 tile partition and reports the number of
+* ioctls and the time taken per request and release cycle.
+*
+* The kernel driver grants one resource request per ioctl, so the driver
+* batches the requests in user space. The application also checks that a
+* request which fails on one tile leaves no counter granted on the others.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include "xaie_linux_mock.h"
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		50
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+#define NUM_TILES		(XAIE_NUM_COLS * XAIE_AIE_TILE_NUM_ROWS)
+#define NUM_ITERATIONS		100U
+
+/* Resources tracked per tile module by the mock */
+#define MOCK_NUM_MODS		3U
+#define MOCK_NUM_RSC_TYPES	8U
+#define MOCK_NUM_RSCS		4U
+
+/************************** Variable Definitions *****************************/
+static uint8_t RscMap[XAIE_NUM_COLS][XAIE_NUM_ROWS][MOCK_NUM_MODS]
+	[MOCK_NUM_RSC_TYPES];
+
+/************************** Function Definitions *****************************/
+static uint8_t *MockRscBits(uint32_t Col, uint32_t Row, uint32_t Mod,
+		uint32_t Type)
+{
+	if((Col >= XAIE_NUM_COLS) || (Row >= XAIE_NUM_ROWS) ||
+			(Mod >= MOCK_NUM_MODS) || (Type >= MOCK_NUM_RSC_TYPES)) {
+		return NULL;
+	}
+
+	return &RscMap[Col][Row][Mod][Type];
+}
+
+static int MockRscReq(struct aie_rsc_req_rsp *Req)
+{
+	struct aie_rsc *Rscs = (struct aie_rsc *)(uintptr_t)Req->rscs;
+	uint8_t *Bits = MockRscBits(Req->req.loc.col, Req->req.loc.row,
+			Req->req.mod, Req->req.type);
+	uint32_t Granted = 0U;
+
+	if(Bits == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	for(uint32_t Id = 0U; (Id < MOCK_NUM_RSCS) &&
+			(Granted < Req->req.num_rscs); Id++) {
+		if((*Bits & (1U << Id)) == 0U) {
+			Rscs[Granted].loc.col = (__u8)Req->req.loc.col;
+			Rscs[Granted].loc.row = (__u8)Req->req.loc.row;
+			Rscs[Granted].mod = Req->req.mod;
+			Rscs[Granted].type = Req->req.type;
+			Rscs[Granted].id = Id;
+			Granted++;
+		}
+	}
+
+	if(Granted < Req->req.num_rscs) {
+		errno = EBUSY;
+		return -1;
+	}
+
+	for(uint32_t i = 0U; i < Granted; i++) {
+		*Bits |= (uint8_t)(1U << Rscs[i].id);
+	}
+
+	return 0;
+}
+
+static int MockRscPut(struct aie_rsc *Rsc)
+{
+	uint8_t *Bits = MockRscBits(Rsc->loc.col, Rsc->loc.row, Rsc->mod,
+			Rsc->type);
+
+	if((Bits == NULL) || (Rsc->id >= MOCK_NUM_RSCS)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*Bits &= (uint8_t)~(1U << Rsc->id);
+
+	return 0;
+}
+
+static int MockRscIoctl(unsigned long Request, void *Arg)
+{
+	switch(Request) {
+	case AIE_RSC_REQ_IOCTL:
+		return MockRscReq((struct aie_rsc_req_rsp *)Arg);
+	case AIE_RSC_RELEASE_IOCTL:
+	case AIE_RSC_FREE_IOCTL:
+		return MockRscPut((struct aie_rsc *)Arg);
+	default:
+		break;
+	}
+
+	errno = ENOTTY;
+	return -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function requests and releases a performance counter on every AIE tile
+* of the partition and reports the cost of a cycle.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Name: Name of the run to report.
+* @param	Rscs: Array to return the granted counters of the last cycle.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC RunCycles(XAie_DevInst *DevInst, const char *Name,
+		XAie_UserRsc *Rscs)
+{
+	AieRC RC = XAIE_OK;
+	XAie_UserRscReq RscReq[NUM_TILES];
+	uint64_t Start, Ns;
+	uint32_t Idx = 0U;
+
+	for(uint8_t Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		for(uint8_t Row = XAIE_AIE_TILE_ROW_START;
+				Row < XAIE_NUM_ROWS; Row++) {
+			RscReq[Idx].Loc = XAie_TileLoc(Col, Row);
+			RscReq[Idx].Mod = XAIE_CORE_MOD;
+			RscReq[Idx].NumRscPerTile = 1U;
+			Idx++;
+		}
+	}
+
+	MockResetCounters();
+	Start = MockTimeNs();
+	for(uint32_t i = 0U; (i < NUM_ITERATIONS) && (RC == XAIE_OK); i++) {
+		RC = XAie_RequestPerfcnt(DevInst, NUM_TILES, RscReq,
+				NUM_TILES, Rscs);
+		if(RC == XAIE_OK) {
+			RC = XAie_ReleasePerfcnt(DevInst, NUM_TILES, Rscs);
+		}
+	}
+	Ns = MockTimeNs() - Start;
+	if(RC != XAIE_OK) {
+		printf("%s: resource requests failed.\n", Name);
+		return RC;
+	}
+
+	printf("%-10s %6lu ioctls %10lu ns per cycle of %u tiles\n", Name,
+			(unsigned long)(Mock.NumIoctls / NUM_ITERATIONS),
+			(unsigned long)(Ns / NUM_ITERATIONS), NUM_TILES);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function exhausts the counters of the last AIE tile of the partition and
+* checks that a request of a counter on every AIE tile fails without leaving a
+* counter granted on any other tile.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Rscs: Array to return the granted counters.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC CheckRollback(XAie_DevInst *DevInst, XAie_UserRsc *Rscs)
+{
+	XAie_UserRscReq RscReq[NUM_TILES];
+	uint32_t Idx = 0U;
+	AieRC RC;
+
+	for(uint8_t Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+		for(uint8_t Row = XAIE_AIE_TILE_ROW_START;
+				Row < XAIE_NUM_ROWS; Row++) {
+			RscReq[Idx].Loc = XAie_TileLoc(Col, Row);
+			RscReq[Idx].Mod = XAIE_CORE_MOD;
+			RscReq[Idx].NumRscPerTile = 1U;
+			Idx++;
+		}
+	}
+
+	memset(RscMap[XAIE_NUM_COLS - 1U][XAIE_NUM_ROWS - 1U], 0xFF,
+			sizeof(RscMap[0][0]));
+	RC = XAie_RequestPerfcnt(DevInst, NUM_TILES, RscReq, NUM_TILES, Rscs);
+	memset(RscMap[XAIE_NUM_COLS - 1U][XAIE_NUM_ROWS - 1U], 0,
+			sizeof(RscMap[0][0]));
+	if(RC == XAIE_OK) {
+		printf("Request of an exhausted counter succeeded.\n");
+		return XAIE_ERR;
+	}
+
+	for(uint32_t i = 0U; i < sizeof(RscMap); i++) {
+		if(((uint8_t *)RscMap)[i] != 0U) {
+			printf("Failed request left counters granted.\n");
+			return XAIE_ERR;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the resource request benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	XAie_UserRsc *Rscs;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	if(MockInit(XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_COL_SHIFT) != 0) {
+		printf("Failed to setup the kernel driver mock.\n");
+		return -1;
+	}
+	Mock.Handler = MockRscIoctl;
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = MockSetupBackend(&DevInst);
+	if(RC != XAIE_OK) {
+		printf("Linux backend is not available, skipping.\n");
+		return 0;
+	}
+
+	Rscs = (XAie_UserRsc *)calloc(NUM_TILES, sizeof(*Rscs));
+	if(Rscs == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+
+	RC = RunCycles(&DevInst, "Requests", Rscs);
+	if(RC != XAIE_OK) {
+		return -1;
+	}
+
+	RC = CheckRollback(&DevInst, Rscs);
+	if(RC != XAIE_OK) {
+		return -1;
+	}
+	free(Rscs);
+
+	XAie_Finish(&DevInst);
+
+	printf("Resource request benchmark success.\n");
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,218 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_linux_wc_bench.c
+* @{
+*
+* This file contains a benchmark of the write combining mode of the Linux
+* backend against the mock of the kernel driver in xaie_linux_mock.h.
+*
+* The application configures and clears circuit switched stream connections on
+* all the AIE tiles of a partition, once with every register write issued as a
+* separate ioctl and once in write combining mode. It reports the number of
+* ioctls and the time taken by both runs, and checks that both runs leave the
+* same register contents. Finally, it checks that the writes queued by a thread
+* which exits without a fence reach the registers.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <stdlib.h>
+#include "xaie_linux_mock.h"
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		2
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+#define NUM_ITERATIONS		500U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function toggles a circuit switched connection on all the AIE tiles of
+* the partition. The connections are left enabled.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC RunConfig(XAie_DevInst *DevInst)
+{
+	AieRC RC = XAIE_OK;
+
+	for(uint32_t i = 0U; i < NUM_ITERATIONS; i++) {
+		for(uint8_t Col = 0U; Col < XAIE_NUM_COLS; Col++) {
+			for(uint8_t Row = XAIE_AIE_TILE_ROW_START;
+					Row < XAIE_NUM_ROWS; Row++) {
+				XAie_LocType Loc = XAie_TileLoc(Col, Row);
+
+				RC |= XAie_StrmConnCctDisable(DevInst, Loc,
+						SOUTH, 0U, NORTH, 0U);
+				RC |= XAie_StrmConnCctEnable(DevInst, Loc,
+						SOUTH, 0U, NORTH, 0U);
+			}
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the entry point of the thread which queues register writes and exits
+* without flushing them.
+*
+* @param	Arg: Device instance pointer.
+*
+* @return	NULL.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void *ExitThread(void *Arg)
+{
+	XAie_DevInst *DevInst = (XAie_DevInst *)Arg;
+
+	(void)RunConfig(DevInst);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the write combining benchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	uint64_t Start, DirectNs, WcNs, DirectIoctls, WcIoctls, WcCmds;
+	unsigned char *Golden;
+	pthread_t Thread;
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	if(MockInit(XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_COL_SHIFT) != 0) {
+		printf("Failed to setup the kernel driver mock.\n");
+		return -1;
+	}
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = MockSetupBackend(&DevInst);
+	if(RC != XAIE_OK) {
+		printf("Linux backend is not available, skipping.\n");
+		return 0;
+	}
+
+	MockResetCounters();
+	Start = MockTimeNs();
+	RC = RunConfig(&DevInst);
+	DirectNs = MockTimeNs() - Start;
+	DirectIoctls = Mock.NumIoctls;
+	if(RC != XAIE_OK) {
+		printf("Register writes failed.\n");
+		return -1;
+	}
+
+	Golden = (unsigned char *)malloc(Mock.RegSize);
+	if(Golden == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+	memcpy(Golden, Mock.Regs, Mock.RegSize);
+	memset(Mock.Regs, 0, Mock.RegSize);
+
+	RC = XAie_ConfigWriteCombine(&DevInst, XAIE_ENABLE);
+	if(RC != XAIE_OK) {
+		printf("Failed to enable write combining.\n");
+		return -1;
+	}
+
+	MockResetCounters();
+	Start = MockTimeNs();
+	RC = RunConfig(&DevInst);
+	RC |= XAie_WriteFence(&DevInst);
+	WcNs = MockTimeNs() - Start;
+	WcIoctls = Mock.NumIoctls;
+	WcCmds = Mock.NumTxnCmds;
+	if(RC != XAIE_OK) {
+		printf("Combined register writes failed.\n");
+		return -1;
+	}
+
+	if(memcmp(Golden, Mock.Regs, Mock.RegSize) != 0) {
+		printf("Register contents differ with write combining.\n");
+		return -1;
+	}
+
+	memset(Mock.Regs, 0, Mock.RegSize);
+	if(pthread_create(&Thread, NULL, ExitThread, &DevInst) != 0) {
+		printf("Failed to create thread.\n");
+		return -1;
+	}
+	pthread_join(Thread, NULL);
+
+	if(memcmp(Golden, Mock.Regs, Mock.RegSize) != 0) {
+		printf("Writes of the exited thread were not flushed.\n");
+		return -1;
+	}
+	free(Golden);
+
+	RC = XAie_ConfigWriteCombine(&DevInst, XAIE_DISABLE);
+	if(RC != XAIE_OK) {
+		printf("Failed to disable write combining.\n");
+		return -1;
+	}
+
+	printf("Direct writes:   %8lu ioctls %10lu ns\n",
+			(unsigned long)DirectIoctls, (unsigned long)DirectNs);
+	printf("Write combining: %8lu ioctls %10lu ns (%lu commands)\n",
+			(unsigned long)WcIoctls, (unsigned long)WcNs,
+			(unsigned long)WcCmds);
+
+	XAie_Finish(&DevInst);
+
+	printf("Write combining benchmark success.\n");
+
+	return 0;
+}
+
+/** @} */
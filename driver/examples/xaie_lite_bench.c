@@ -0,0 +1,256 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_lite_bench.c
+* @{
+*
+* This file contains a microbenchmark of the lite data plane APIs, the lock
+* acquire and release, the BD address and length updates and the DMA queue
+* push, against the matching APIs of the driver.
+*
+* The lite APIs are built for AIE-ML. Both access the same host memory which
+* stands in for the registers of a one column partition: the lite APIs
+* directly, the driver through an in-memory backend. The application first
+* checks that each lite API accesses the same registers as the driver API,
+* then reports the ns/op of both. The BD addresses are checked against BDs
+* written by the driver, as the lite API encodes them like XAie_DmaWriteBd().
+* The lite APIs are only inlined into a tight sequence with optimizations, e.g.
+* make CFLAGS="-O2 -Wall -Wextra".
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#define XAIE_FEATURE_LITE
+#define XAIE_DEV_SINGLE_GEN	XAIE_DEV_GEN_AIEML
+
+#include "xaie_mem_backend.h"
+
+/************************** Constant Definitions *****************************/
+/* The partition starts on a shim NoC column */
+#define PART_START_COL		2U
+#define REG_SPACE_SIZE		(XAIE_NUM_ROWS << XAIE_ROW_SHIFT)
+#define NUM_ITERATIONS		2000000U
+
+/************************** Function Definitions *****************************/
+/*
+ * Runs an API NUM_ITERATIONS times, the loop index i can be used in its
+ * arguments. Stores the elapsed time in Ns and ORs the return codes in RC.
+ */
+#define BENCH_LOOP(Ns, Call)						\
+	do {								\
+		uint64_t Start = MemTimeNs();				\
+		for(u32 i = 0U; i < NUM_ITERATIONS; i++) {		\
+			RC |= (Call);					\
+		}							\
+		(Ns) = MemTimeNs() - Start;				\
+	} while(0)
+
+/*
+ * Runs the driver API and the lite API on cleared registers and fails if they
+ * do not leave the same register values.
+ */
+#define CHECK_SAME(Name, FullCall, LiteCall)				\
+	do {								\
+		memset(MemRegs, 0, REG_SPACE_SIZE);			\
+		RC = (FullCall);					\
+		memcpy(Ref, MemRegs, REG_SPACE_SIZE);			\
+		memset(MemRegs, 0, REG_SPACE_SIZE);			\
+		RC |= (LiteCall);					\
+		if((RC != XAIE_OK) ||					\
+				(memcmp(Ref, MemRegs, REG_SPACE_SIZE) != 0)) { \
+			printf("%s: lite API differs from the driver.\n", \
+					(Name));			\
+			return -1;					\
+		}							\
+	} while(0)
+
+/*****************************************************************************/
+/**
+*
+* This function checks the address encoding of the lite BD address update. The
+* lite API encodes the address like XAie_DmaWriteBd(), so the reference is a
+* BD written by the driver with the address, and the lite API updates the same
+* BD written with a null address.
+*
+* @param	DevInst: Device instance of the driver.
+* @param	LiteInst: Device instance of the lite APIs.
+* @param	Loc: Location of the tile.
+* @param	Addr: Buffer address.
+* @param	Ref: Buffer of REG_SPACE_SIZE bytes for the reference.
+*
+* @return	0 if the registers match, -1 otherwise.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int CheckBdAddr(XAie_DevInst *DevInst, XAie_DevInst *LiteInst,
+		XAie_LocType Loc, u64 Addr, u32 *Ref)
+{
+	AieRC RC;
+	XAie_DmaDesc Desc;
+
+	memset(MemRegs, 0, REG_SPACE_SIZE);
+	RC = XAie_DmaDescInit(DevInst, &Desc, Loc);
+	RC |= XAie_DmaSetAddrLen(&Desc, Addr, 0x100U);
+	RC |= XAie_DmaWriteBd(DevInst, &Desc, Loc, 5U);
+	memcpy(Ref, MemRegs, REG_SPACE_SIZE);
+
+	memset(MemRegs, 0, REG_SPACE_SIZE);
+	RC |= XAie_DmaSetAddrLen(&Desc, 0U, 0x100U);
+	RC |= XAie_DmaWriteBd(DevInst, &Desc, Loc, 5U);
+	RC |= XAie_LDmaUpdateBdAddr(LiteInst, Loc, Addr, 5U);
+	if((RC != XAIE_OK) || (memcmp(Ref, MemRegs, REG_SPACE_SIZE) != 0)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+static void Report(const char *Name, uint64_t FullNs, uint64_t LiteNs)
+{
+	printf("%-16s %7.1f -> %5.1f ns/op\n", Name,
+			(double)FullNs / NUM_ITERATIONS,
+			(double)LiteNs / NUM_ITERATIONS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the lite data plane microbenchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	u32 *Ref;
+	uint64_t FullNs, LiteNs;
+	XAie_LocType Tile = XAie_TileLoc(0, XAIE_AIE_TILE_ROW_START);
+	XAie_LocType Shim = XAie_TileLoc(0, XAIE_SHIM_ROW);
+	XAie_Lock Lock = XAie_LockInit(3, 1);
+
+	Ref = (u32 *)malloc(REG_SPACE_SIZE);
+	if((Ref == NULL) || (MemBackendInit(REG_SPACE_SIZE) != 0)) {
+		printf("Failed to initialize the benchmark.\n");
+		return -1;
+	}
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			PART_START_COL + 1U, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	ConfigPtr.BackendName = MEM_BACKEND_NAME;
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+	XAie_LDeclareDevInst(LiteInst, (u64)(uintptr_t)MemRegs, PART_START_COL,
+			1U);
+
+	XAie_SetupPartitionConfig(&DevInst, XAIE_BASE_ADDR, PART_START_COL,
+			1U);
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	/*
+	 * The lock requests succeed once the register polled by the driver
+	 * holds the success bit. A lite API polling another register would
+	 * time out.
+	 */
+	memset(MemRegs, 0, REG_SPACE_SIZE);
+	(void)XAie_LockAcquire(&DevInst, Tile, Lock, 0U);
+	MemRegs[MemLastPoll / 4U] = XAIE_LOCK_RESULT_SUCCESS;
+	RC = XAie_LockAcquire(&DevInst, Tile, Lock, 0U);
+	RC |= XAie_LLockAcquire(&LiteInst, Tile, Lock, 0U);
+	if(RC != XAIE_OK) {
+		printf("Lock acquire: lite API differs from the driver.\n");
+		return -1;
+	}
+
+	BENCH_LOOP(FullNs, XAie_LockAcquire(&DevInst, Tile, Lock, 0U));
+	BENCH_LOOP(LiteNs, XAie_LLockAcquire(&LiteInst, Tile, Lock, 0U));
+	Report("Lock acquire", FullNs, LiteNs);
+
+	memset(MemRegs, 0, REG_SPACE_SIZE);
+	(void)XAie_LockRelease(&DevInst, Tile, Lock, 0U);
+	MemRegs[MemLastPoll / 4U] = XAIE_LOCK_RESULT_SUCCESS;
+	RC = XAie_LockRelease(&DevInst, Tile, Lock, 0U);
+	RC |= XAie_LLockRelease(&LiteInst, Tile, Lock, 0U);
+	if(RC != XAIE_OK) {
+		printf("Lock release: lite API differs from the driver.\n");
+		return -1;
+	}
+
+	BENCH_LOOP(FullNs, XAie_LockRelease(&DevInst, Tile, Lock, 0U));
+	BENCH_LOOP(LiteNs, XAie_LLockRelease(&LiteInst, Tile, Lock, 0U));
+	Report("Lock release", FullNs, LiteNs);
+
+	if(CheckBdAddr(&DevInst, &LiteInst, Tile, 0x4A40U, Ref) != 0) {
+		printf("BD addr (tile): lite API differs from the driver.\n");
+		return -1;
+	}
+	BENCH_LOOP(FullNs, XAie_DmaUpdateBdAddr(&DevInst, Tile,
+				(i & 0xFFU) * 16U, (u8)(i & 7U)));
+	BENCH_LOOP(LiteNs, XAie_LDmaUpdateBdAddr(&LiteInst, Tile,
+				(i & 0xFFU) * 16U, (u8)(i & 7U)));
+	Report("BD addr (tile)", FullNs, LiteNs);
+
+	if(CheckBdAddr(&DevInst, &LiteInst, Shim, 0x1234567880ULL, Ref) != 0) {
+		printf("BD addr (shim): lite API differs from the driver.\n");
+		return -1;
+	}
+	BENCH_LOOP(FullNs, XAie_DmaUpdateBdAddr(&DevInst, Shim,
+				0x100000000ULL + (i & 0xFFU) * 16U,
+				(u8)(i & 7U)));
+	BENCH_LOOP(LiteNs, XAie_LDmaUpdateBdAddr(&LiteInst, Shim,
+				0x100000000ULL + (i & 0xFFU) * 16U,
+				(u8)(i & 7U)));
+	Report("BD addr (shim)", FullNs, LiteNs);
+
+	CHECK_SAME("BD len",
+			XAie_DmaUpdateBdLen(&DevInst, Tile, 0x400U, 5U),
+			XAie_LDmaUpdateBdLen(&LiteInst, Tile, 0x400U, 5U));
+	BENCH_LOOP(FullNs, XAie_DmaUpdateBdLen(&DevInst, Tile,
+				((i & 0xFFU) + 1U) * 4U, (u8)(i & 7U)));
+	BENCH_LOOP(LiteNs, XAie_LDmaUpdateBdLen(&LiteInst, Tile,
+				((i & 0xFFU) + 1U) * 4U, (u8)(i & 7U)));
+	Report("BD len", FullNs, LiteNs);
+
+	CHECK_SAME("Queue push",
+			XAie_DmaChannelPushBdToQueue(&DevInst, Tile, 1U,
+				DMA_MM2S, 5U),
+			XAie_LDmaChannelPushBdToQueue(&LiteInst, Tile, 1U,
+				DMA_MM2S, 5U));
+	BENCH_LOOP(FullNs, XAie_DmaChannelPushBdToQueue(&DevInst, Tile, 0U,
+				DMA_S2MM, (u8)(i & 7U)));
+	BENCH_LOOP(LiteNs, XAie_LDmaChannelPushBdToQueue(&LiteInst, Tile, 0U,
+				DMA_S2MM, (u8)(i & 7U)));
+	Report("Queue push", FullNs, LiteNs);
+
+	if(RC != XAIE_OK) {
+		printf("Benchmarked APIs failed.\n");
+		return -1;
+	}
+
+	XAie_Finish(&DevInst);
+	free(Ref);
+	free(MemRegs);
+
+	printf("Lite data plane benchmark success.\n");
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,206 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mem_backend.h
+* @{
+*
+* This file contains an IO backend which backs the registers of the partition
+* with host memory, for the benchmarks of the driver APIs which do not depend
+* on a kernel driver.
+*
+* The register accesses read and write the memory, mask polls succeed if the
+* register already holds the value and record the polled register. Shim DMA
+* BDs are written to the memory, the other backend operations are not
+* supported.
+*
+******************************************************************************/
+#ifndef XAIE_MEM_BACKEND_H
+#define XAIE_MEM_BACKEND_H
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <xaiengine.h>
+#include <xaiengine/xaie_io.h>
+
+/************************** Constant Definitions *****************************/
+#define MEM_BACKEND_NAME	"memio"
+
+/************************** Variable Definitions *****************************/
+static u32 *MemRegs;		/* Registers of the partition */
+static u64 MemLastPoll;		/* Offset of the last polled register */
+
+/************************** Function Definitions *****************************/
+static AieRC MemIO_Init(XAie_DevInst *DevInst)
+{
+	DevInst->IOInst = MemRegs;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Finish(void *IOInst)
+{
+	(void)IOInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	((u32 *)IOInst)[RegOff / 4U] = Value;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	*Data = ((u32 *)IOInst)[RegOff / 4U];
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask, u32 Value)
+{
+	u32 *Reg = &((u32 *)IOInst)[RegOff / 4U];
+
+	*Reg = (*Reg & ~Mask) | (Value & Mask);
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	(void)TimeOutUs;
+	MemLastPoll = RegOff;
+	return ((((u32 *)IOInst)[RegOff / 4U] & Mask) == Value) ?
+		XAIE_OK : XAIE_ERR;
+}
+
+static AieRC MemIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
+		u32 Size)
+{
+	memcpy(&((u32 *)IOInst)[RegOff / 4U], Data, Size * sizeof(u32));
+	return XAIE_OK;
+}
+
+static AieRC MemIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		((u32 *)IOInst)[RegOff / 4U + i] = Data;
+	}
+	return XAIE_OK;
+}
+
+static AieRC MemIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	(void)IOInst; (void)Col; (void)Row; (void)Command;
+	(void)CmdWd0; (void)CmdWd1; (void)CmdStr;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	XAie_ShimDmaBdArgs *BdArgs = (XAie_ShimDmaBdArgs *)Arg;
+
+	(void)DevInst;
+	if(Op != XAIE_BACKEND_OP_CONFIG_SHIMDMABD) {
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	for(u8 i = 0U; i < BdArgs->NumBdWords; i++) {
+		MemIO_Write32(IOInst, BdArgs->Addr + i * 4U,
+				BdArgs->BdWords[i]);
+	}
+
+	return XAIE_OK;
+}
+
+static XAie_MemInst *MemIO_MemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	(void)DevInst; (void)Size; (void)Cache;
+	return NULL;
+}
+
+static AieRC MemIO_MemOp(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst; (void)MemHandle;
+	return XAIE_OK;
+}
+
+static u64 MemIO_GetTid(void)
+{
+	return 0U;
+}
+
+static const XAie_BackendOps MemIOOps = {
+	.Init = MemIO_Init,
+	.Finish = MemIO_Finish,
+	.Write32 = MemIO_Write32,
+	.Read32 = MemIO_Read32,
+	.MaskWrite32 = MemIO_MaskWrite32,
+	.MaskPoll = MemIO_MaskPoll,
+	.BlockWrite32 = MemIO_BlockWrite32,
+	.BlockSet32 = MemIO_BlockSet32,
+	.CmdWrite = MemIO_CmdWrite,
+	.RunOp = MemIO_RunOp,
+	.MemAllocate = MemIO_MemAllocate,
+	.MemFree = MemIO_MemOp,
+	.MemSyncForCPU = MemIO_MemOp,
+	.MemSyncForDev = MemIO_MemOp,
+	.MemAttach = MemIO_MemAttach,
+	.MemDetach = MemIO_MemOp,
+	.GetTid = MemIO_GetTid,
+};
+
+static inline uint64_t MemTimeNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (uint64_t)Ts.tv_sec * 1000000000ULL + (uint64_t)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates the registers and registers the backend under the
+* name MEM_BACKEND_NAME.
+*
+* @param	Size: Size of the register space of the partition in bytes.
+*
+* @return	0 on success, -1 on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int MemBackendInit(u64 Size)
+{
+	MemRegs = (u32 *)calloc(1U, Size);
+	if(MemRegs == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+
+	if(XAie_RegisterBackend(MEM_BACKEND_NAME, &MemIOOps) != XAIE_OK) {
+		printf("Failed to register the backend.\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+#endif /* XAIE_MEM_BACKEND_H */
+/** @} */
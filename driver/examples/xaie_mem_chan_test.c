@@ -0,0 +1,504 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mem_chan_test.c
+* @{
+*
+* This file contains a test of the host to tile memory channel with an
+* in-memory backend.
+*
+* The application registers a backend which keeps the register space of the
+* partition in host memory and emulates the semaphore locks of an AIE-ML tile
+* on the lock request registers. A thread plays the tile program: it acquires
+* the consumer lock, checks the buffer against the sequence written by the
+* host and releases the producer lock, as described in xaie_mem_chan.h. The
+* application streams a number of buffers through the channel, synchronizes
+* with the tile and checks the statistics. It then checks that a write which
+* finds no free buffer times out.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <xaiengine.h>
+#include <xaiengine/xaie_helper.h>
+#include <xaiengine/xaie_io.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		6
+#define XAIE_NUM_COLS		1
+#define XAIE_COL_SHIFT		25
+#define XAIE_ROW_SHIFT		20
+#define XAIE_SHIM_ROW		0
+#define XAIE_MEM_TILE_ROW_START	1
+#define XAIE_MEM_TILE_NUM_ROWS	1
+#define XAIE_AIE_TILE_ROW_START	2
+#define XAIE_AIE_TILE_NUM_ROWS	4
+
+#define REG_SPACE_SIZE		(XAIE_NUM_COLS << XAIE_COL_SHIFT)
+#define CHAN_COL		0U
+#define CHAN_ROW		2U
+#define PROD_LOCK		0U
+#define CONS_LOCK		1U
+#define NUM_BUFS		2U
+#define BUF_WORDS		64U
+#define NUM_XFERS		64U
+#define TIMEOUT_US		1000000U
+#define MAX_LOCKS		64U
+
+/************************** Variable Definitions *****************************/
+static u32 *Regs;
+static pthread_mutex_t LockMutex = PTHREAD_MUTEX_INITIALIZER;
+static int LockVal[MAX_LOCKS];
+static const XAie_LockMod *TileLockMod;
+static u64 TileAddr;
+static u64 TileMemAddr;
+static const u32 BufAddr[NUM_BUFS] = {0x1000U, 0x2000U};
+
+/************************** Function Definitions *****************************/
+static uint64_t TimeNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (uint64_t)Ts.tv_sec * 1000000000ULL + (uint64_t)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function performs a lock request on the emulated tile. An acquire with
+* a negative value succeeds if the lock is at least the opposite of the value
+* and decrements it, an acquire with a non negative value succeeds if the lock
+* is equal to the value. A release adds the value within the range of the
+* lock.
+*
+* @param	LockId: Lock to request.
+* @param	Val: Value of the request.
+* @param	IsAcquire: 1 for an acquire, 0 for a release.
+*
+* @return	1 if the request succeeded, 0 otherwise.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int TileLockReq(u32 LockId, int Val, u8 IsAcquire)
+{
+	int Done = 0;
+
+	pthread_mutex_lock(&LockMutex);
+	if(IsAcquire != 0U) {
+		if((Val < 0) && (LockVal[LockId] >= -Val)) {
+			LockVal[LockId] += Val;
+			Done = 1;
+		} else if(LockVal[LockId] == Val) {
+			Done = 1;
+		}
+	} else if(LockVal[LockId] + Val <= TileLockMod->LockValUpperBound) {
+		LockVal[LockId] += Val;
+		Done = 1;
+	}
+	pthread_mutex_unlock(&LockMutex);
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function decodes the lock request registers of the channel tile and
+* performs the request.
+*
+* @param	RegOff: Register offset.
+* @param	Done: Pointer to return the result of the request.
+*
+* @return	1 if the offset is a lock request of the tile, 0 otherwise.
+*
+* @note		None.
+*
+*******************************************************************************/
+static int TileLockDecode(u64 RegOff, int *Done)
+{
+	u64 Start = TileAddr + TileLockMod->BaseAddr;
+	u64 Off, Rem;
+	int Val;
+
+	if((RegOff < Start) || (RegOff >= Start +
+				(u64)TileLockMod->NumLocks *
+				TileLockMod->LockIdOff)) {
+		return 0;
+	}
+
+	Off = RegOff - Start;
+	Rem = Off % TileLockMod->LockIdOff;
+	Val = (int)((Rem % TileLockMod->RelAcqOff) / TileLockMod->LockValOff);
+	/* The value is a 7 bit signed field */
+	if(Val >= 64) {
+		Val -= 128;
+	}
+
+	*Done = TileLockReq((u32)(Off / TileLockMod->LockIdOff), Val,
+			Rem >= TileLockMod->RelAcqOff);
+
+	return 1;
+}
+
+static AieRC MemIO_Init(XAie_DevInst *DevInst)
+{
+	DevInst->IOInst = Regs;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Finish(void *IOInst)
+{
+	(void)IOInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	u64 SetVal = TileAddr + TileLockMod->LockSetValBase;
+
+	if((RegOff >= SetVal) && (RegOff < SetVal +
+				(u64)TileLockMod->NumLocks *
+				TileLockMod->LockSetValOff)) {
+		pthread_mutex_lock(&LockMutex);
+		LockVal[(RegOff - SetVal) / TileLockMod->LockSetValOff] =
+			(int)((Value & TileLockMod->LockInit->Mask) >>
+					TileLockMod->LockInit->Lsb);
+		pthread_mutex_unlock(&LockMutex);
+	}
+
+	((u32 *)IOInst)[RegOff / 4U] = Value;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	*Data = ((u32 *)IOInst)[RegOff / 4U];
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask, u32 Value)
+{
+	u32 *Reg = &((u32 *)IOInst)[RegOff / 4U];
+
+	*Reg = (*Reg & ~Mask) | (Value & Mask);
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function polls a register. A lock request is repeated until it succeeds
+* or the timeout expires.
+*
+* @param	IOInst: IO instance pointer.
+* @param	RegOff: Register offset.
+* @param	Mask: Mask of the poll.
+* @param	Value: Value to poll for.
+* @param	TimeOutUs: Timeout in usecs.
+*
+* @return	XAIE_OK on success, XAIE_ERR on timeout.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC MemIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	uint64_t End = TimeNs() + (uint64_t)TimeOutUs * 1000U;
+	int Done;
+
+	if(TileLockDecode(RegOff, &Done) == 0) {
+		return ((((u32 *)IOInst)[RegOff / 4U] & Mask) == Value) ?
+			XAIE_OK : XAIE_ERR;
+	}
+
+	while((Done == 0) && (TimeNs() < End)) {
+		usleep(1U);
+		TileLockDecode(RegOff, &Done);
+	}
+
+	return (Done != 0) ? XAIE_OK : XAIE_ERR;
+}
+
+static AieRC MemIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
+		u32 Size)
+{
+	memcpy(&((u32 *)IOInst)[RegOff / 4U], Data, Size * sizeof(u32));
+	return XAIE_OK;
+}
+
+static AieRC MemIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		((u32 *)IOInst)[RegOff / 4U + i] = Data;
+	}
+	return XAIE_OK;
+}
+
+static AieRC MemIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	(void)IOInst; (void)Col; (void)Row; (void)Command;
+	(void)CmdWd0; (void)CmdWd1; (void)CmdStr;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	(void)IOInst; (void)DevInst; (void)Op; (void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+static XAie_MemInst *MemIO_MemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	(void)DevInst; (void)Size; (void)Cache;
+	return NULL;
+}
+
+static AieRC MemIO_MemOp(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst; (void)MemHandle;
+	return XAIE_OK;
+}
+
+static u64 MemIO_GetTid(void)
+{
+	return 0U;
+}
+
+static const XAie_BackendOps MemIOOps = {
+	.Init = MemIO_Init,
+	.Finish = MemIO_Finish,
+	.Write32 = MemIO_Write32,
+	.Read32 = MemIO_Read32,
+	.MaskWrite32 = MemIO_MaskWrite32,
+	.MaskPoll = MemIO_MaskPoll,
+	.BlockWrite32 = MemIO_BlockWrite32,
+	.BlockSet32 = MemIO_BlockSet32,
+	.CmdWrite = MemIO_CmdWrite,
+	.RunOp = MemIO_RunOp,
+	.MemAllocate = MemIO_MemAllocate,
+	.MemFree = MemIO_MemOp,
+	.MemSyncForCPU = MemIO_MemOp,
+	.MemSyncForDev = MemIO_MemOp,
+	.MemAttach = MemIO_MemAttach,
+	.MemDetach = MemIO_MemOp,
+	.GetTid = MemIO_GetTid,
+};
+
+/*****************************************************************************/
+/**
+*
+* This function plays the tile program. It consumes the buffers in round robin
+* order, checks that each buffer holds the next chunk of the sequence written
+* by the host and frees it. Every other buffer is held for a while so that the
+* host finds the ring full.
+*
+* @param	Arg: Unused.
+*
+* @return	NULL on success, non NULL if a buffer is out of order.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void *RunTile(void *Arg)
+{
+	const u32 *Buf;
+
+	(void)Arg;
+	for(u32 i = 0U; i < NUM_XFERS; i++) {
+		while(TileLockReq(CONS_LOCK, -1, 1U) == 0) {
+			sched_yield();
+		}
+
+		Buf = &Regs[(TileAddr + TileMemAddr + BufAddr[i % NUM_BUFS]) /
+			4U];
+		for(u32 j = 0U; j < BUF_WORDS; j++) {
+			if(Buf[j] != i * BUF_WORDS + j) {
+				printf("Buffer %u is out of order.\n", i);
+				return Regs;
+			}
+		}
+
+		if((i % 2U) == 0U) {
+			usleep(100U);
+		}
+
+		TileLockReq(PROD_LOCK, 1, 0U);
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the memory channel test.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	pthread_t Tile;
+	void *Ret;
+	XAie_MemChan *Chan;
+	XAie_MemChanStats Stats;
+	XAie_MemChanCfg Cfg;
+	u32 Data[BUF_WORDS];
+
+	Regs = (u32 *)calloc(1U, REG_SPACE_SIZE);
+	if(Regs == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+
+	RC = XAie_RegisterBackend("memchan", &MemIOOps);
+	if(RC != XAIE_OK) {
+		printf("Failed to register the backend.\n");
+		return -1;
+	}
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	ConfigPtr.BackendName = "memchan";
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	TileLockMod = _XAie_GetDevMod(&DevInst)
+		[XAIEGBL_TILE_TYPE_AIETILE].LockMod;
+	TileMemAddr = _XAie_GetDevMod(&DevInst)
+		[XAIEGBL_TILE_TYPE_AIETILE].MemMod->MemAddr;
+	TileAddr = _XAie_GetTileAddr(&DevInst, CHAN_ROW, CHAN_COL);
+	if(TileLockMod->NumLocks > MAX_LOCKS) {
+		printf("Too many locks to emulate.\n");
+		return -1;
+	}
+
+	memset(&Cfg, 0, sizeof(Cfg));
+	Cfg.Loc = XAie_TileLoc(CHAN_COL, CHAN_ROW);
+	memcpy(Cfg.BufAddr, BufAddr, sizeof(BufAddr));
+	Cfg.BufSize = BUF_WORDS * sizeof(u32);
+	Cfg.NumBufs = NUM_BUFS;
+	Cfg.ProdLockId = PROD_LOCK;
+	Cfg.ConsLockId = CONS_LOCK;
+	Cfg.SpinCount = 16U;
+
+	/* Poison the locks, the channel shall initialize them */
+	LockVal[PROD_LOCK] = 5;
+	LockVal[CONS_LOCK] = 5;
+	RC = XAie_MemChanCreate(&DevInst, &Cfg, &Chan);
+	if((RC != XAIE_OK) || (LockVal[PROD_LOCK] != (int)NUM_BUFS) ||
+			(LockVal[CONS_LOCK] != 0)) {
+		printf("Failed to create the channel.\n");
+		return -1;
+	}
+
+	if(pthread_create(&Tile, NULL, RunTile, NULL) != 0) {
+		printf("Failed to create thread.\n");
+		return -1;
+	}
+
+	for(u32 i = 0U; (i < NUM_XFERS) && (RC == XAIE_OK); i++) {
+		for(u32 j = 0U; j < BUF_WORDS; j++) {
+			Data[j] = i * BUF_WORDS + j;
+		}
+
+		RC = XAie_MemChanWrite(Chan, Data, sizeof(Data), TIMEOUT_US);
+	}
+	if(RC == XAIE_OK) {
+		RC = XAie_MemChanSync(Chan, TIMEOUT_US);
+	}
+
+	pthread_join(Tile, &Ret);
+	if((RC != XAIE_OK) || (Ret != NULL)) {
+		printf("Failed to stream the buffers.\n");
+		return -1;
+	}
+
+	XAie_MemChanGetStats(Chan, &Stats);
+	printf("%lu transfers, %lu bytes, %lu stalls, %lu ns stalled, "
+			"%lu ns min, %lu ns max\n",
+			(unsigned long)Stats.NumXfers,
+			(unsigned long)Stats.Bytes,
+			(unsigned long)Stats.NumStalls,
+			(unsigned long)Stats.StallNs,
+			(unsigned long)Stats.MinNs,
+			(unsigned long)Stats.MaxNs);
+	if((Stats.NumXfers != NUM_XFERS) ||
+			(Stats.Bytes != NUM_XFERS * sizeof(Data)) ||
+			(Stats.NumTimeOuts != 0U) || (Stats.NumStalls == 0U) ||
+			(Stats.MinNs > Stats.MaxNs) ||
+			(Stats.TotalNs < Stats.StallNs) ||
+			(LockVal[PROD_LOCK] != (int)NUM_BUFS) ||
+			(LockVal[CONS_LOCK] != 0)) {
+		printf("Statistics or locks do not match the transfers.\n");
+		return -1;
+	}
+
+	/* Without the tile, the ring fills up and the next write times out */
+	XAie_MemChanResetStats(Chan);
+	for(u32 i = 0U; (i < NUM_BUFS) && (RC == XAIE_OK); i++) {
+		RC = XAie_MemChanWrite(Chan, Data, sizeof(Data), 0U);
+	}
+	if(RC == XAIE_OK) {
+		RC = XAie_MemChanWrite(Chan, Data, sizeof(Data), 0U);
+	}
+
+	XAie_MemChanGetStats(Chan, &Stats);
+	if((RC != XAIE_LOCK_RESULT_FAILED) || (Stats.NumXfers != NUM_BUFS) ||
+			(Stats.NumTimeOuts != 1U) ||
+			(LockVal[CONS_LOCK] != (int)NUM_BUFS)) {
+		printf("Write to a full channel did not time out.\n");
+		return -1;
+	}
+
+	XAie_MemChanDestroy(Chan);
+	XAie_Finish(&DevInst);
+	free(Regs);
+
+	printf("Memory channel test success.\n");
+
+	return 0;
+}
+
+/** @} */
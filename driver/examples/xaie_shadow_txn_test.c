@@ -0,0 +1,401 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow_txn_test.c
+* @{
+*
+* This file contains a test of the shadow register cache with a backend which
+* submits transactions.
+*
+* The application registers an in-memory backend which executes submitted
+* transactions and then overwrites the block write payloads of the
+* transactions owned by the driver, as the payloads would look once they are
+* released and reused. It applies a configuration through a transaction and
+* checks that the cache holds the written values, i.e. that a delta of the
+* same configuration only writes the BD words holding the valid bit, which the
+* hardware clears. It then checks that a failed transaction invalidates the
+* cache, and that a delta always writes the core control register.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xaiengine.h>
+#include <xaiengine/xaie_helper.h>
+#include <xaiengine/xaie_io.h>
+
+/************************** Constant Definitions *****************************/
+/* AIE Device parameters */
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		9
+#define XAIE_NUM_COLS		1
+#define XAIE_COL_SHIFT		23
+#define XAIE_ROW_SHIFT		18
+#define XAIE_SHIM_ROW		0
+#define XAIE_RES_TILE_ROW_START	0
+#define XAIE_RES_TILE_NUM_ROWS	0
+#define XAIE_AIE_TILE_ROW_START	1
+#define XAIE_AIE_TILE_NUM_ROWS	8
+
+#define REG_SPACE_SIZE		(XAIE_NUM_COLS << XAIE_COL_SHIFT)
+/* Buffer descriptors of the DMA of tile (0, 1) */
+#define CFG_REG_OFF		((1ULL << XAIE_ROW_SHIFT) + 0x1D000U)
+#define CFG_NUM_WORDS		16U
+/* The words holding the valid bit of the two BDs are always written */
+#define CFG_VALID_WORD0		6U
+#define CFG_VALID_WORD1		14U
+#define CFG_NUM_VOLATILE	2U
+#define CORE_CTRL_OFF		((1ULL << XAIE_ROW_SHIFT) + 0x32000U)
+#define POISON			0xA5A5A5A5U
+
+/************************** Variable Definitions *****************************/
+static u32 *Regs;
+static u8 FailSubmit;
+
+/************************** Function Definitions *****************************/
+static AieRC MemIO_Init(XAie_DevInst *DevInst)
+{
+	DevInst->IOInst = Regs;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Finish(void *IOInst)
+{
+	(void)IOInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	((u32 *)IOInst)[RegOff / 4U] = Value;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	*Data = ((u32 *)IOInst)[RegOff / 4U];
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask, u32 Value)
+{
+	u32 *Reg = &((u32 *)IOInst)[RegOff / 4U];
+
+	*Reg = (*Reg & ~Mask) | (Value & Mask);
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
+		u32 TimeOutUs)
+{
+	(void)TimeOutUs;
+	return ((((u32 *)IOInst)[RegOff / 4U] & Mask) == Value) ?
+		XAIE_OK : XAIE_ERR;
+}
+
+static AieRC MemIO_BlockWrite32(void *IOInst, u64 RegOff, const u32 *Data,
+		u32 Size)
+{
+	memcpy(&((u32 *)IOInst)[RegOff / 4U], Data, Size * sizeof(u32));
+	return XAIE_OK;
+}
+
+static AieRC MemIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		((u32 *)IOInst)[RegOff / 4U + i] = Data;
+	}
+	return XAIE_OK;
+}
+
+static AieRC MemIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	(void)IOInst; (void)Col; (void)Row; (void)Command;
+	(void)CmdWd0; (void)CmdWd1; (void)CmdStr;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	(void)IOInst; (void)DevInst; (void)Op; (void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+static XAie_MemInst *MemIO_MemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	(void)DevInst; (void)Size; (void)Cache;
+	return NULL;
+}
+
+static AieRC MemIO_MemOp(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_OK;
+}
+
+static AieRC MemIO_MemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst; (void)MemHandle;
+	return XAIE_OK;
+}
+
+static u64 MemIO_GetTid(void)
+{
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function executes a transaction and overwrites the block write payloads
+* of the transactions which are not exported. If FailSubmit is set, only the
+* first half of the commands is executed and an error is returned.
+*
+* @param	IOInst: IO instance pointer.
+* @param	TxnInst: Transaction instance.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the submission fails.
+*
+* @note		None.
+*
+*******************************************************************************/
+static AieRC MemIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	u32 NumCmds = TxnInst->NumCmds;
+
+	if(FailSubmit != 0U) {
+		NumCmds /= 2U;
+	}
+
+	for(u32 i = 0U; i < NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			MemIO_MaskWrite32(IOInst, Cmd->RegOff,
+					(Cmd->Mask == 0U) ? ~0U : Cmd->Mask,
+					Cmd->Value);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			MemIO_BlockWrite32(IOInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			MemIO_BlockSet32(IOInst, Cmd->RegOff, Cmd->Value,
+					Cmd->Size);
+			break;
+		default:
+			return XAIE_ERR;
+		}
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if((Cmd->Opcode == XAIE_IO_BLOCKWRITE) &&
+				!(TxnInst->Flags & XAIE_TXN_INSTANCE_EXPORTED)) {
+			u32 *Data = (u32 *)(uintptr_t)Cmd->DataPtr;
+
+			for(u32 j = 0U; j < Cmd->Size; j++) {
+				Data[j] = POISON;
+			}
+		}
+	}
+
+	return (FailSubmit != 0U) ? XAIE_ERR : XAIE_OK;
+}
+
+static const XAie_BackendOps MemIOOps = {
+	.Init = MemIO_Init,
+	.Finish = MemIO_Finish,
+	.Write32 = MemIO_Write32,
+	.Read32 = MemIO_Read32,
+	.MaskWrite32 = MemIO_MaskWrite32,
+	.MaskPoll = MemIO_MaskPoll,
+	.BlockWrite32 = MemIO_BlockWrite32,
+	.BlockSet32 = MemIO_BlockSet32,
+	.CmdWrite = MemIO_CmdWrite,
+	.RunOp = MemIO_RunOp,
+	.MemAllocate = MemIO_MemAllocate,
+	.MemFree = MemIO_MemOp,
+	.MemSyncForCPU = MemIO_MemOp,
+	.MemSyncForDev = MemIO_MemOp,
+	.MemAttach = MemIO_MemAttach,
+	.MemDetach = MemIO_MemOp,
+	.GetTid = MemIO_GetTid,
+	.SubmitTxn = MemIO_SubmitTxn,
+};
+
+/*****************************************************************************/
+/**
+*
+* This function applies a configuration of consecutive registers through a
+* transaction of the calling thread.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Data: Values of the registers.
+* @param	Export: Export the transaction instead of submitting it.
+* @param	TxnInst: Pointer to return the exported transaction instance.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The values are written as two block writes.
+*
+*******************************************************************************/
+static AieRC ApplyConfig(XAie_DevInst *DevInst, const u32 *Data, u8 Export,
+		XAie_TxnInst **TxnInst)
+{
+	AieRC RC;
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	RC |= XAie_BlockWrite32(DevInst, CFG_REG_OFF, Data,
+			CFG_NUM_WORDS / 2U);
+	RC |= XAie_BlockWrite32(DevInst, CFG_REG_OFF + CFG_NUM_WORDS * 2U,
+			&Data[CFG_NUM_WORDS / 2U], CFG_NUM_WORDS / 2U);
+	if(RC != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	if(Export != 0U) {
+		*TxnInst = XAie_ExportTransactionInstance(DevInst);
+		return (*TxnInst != NULL) ? XAIE_OK : XAIE_ERR;
+	}
+
+	return XAie_SubmitTransaction(DevInst, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the shadow register cache test.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	XAie_TxnInst *Cfg, *CoreCfg;
+	u32 Data[CFG_NUM_WORDS], Other[CFG_NUM_WORDS];
+	u32 NumWr;
+
+	for(u32 i = 0U; i < CFG_NUM_WORDS; i++) {
+		Data[i] = 0x1000U + i;
+		Other[i] = 0x2000U + i;
+	}
+
+	Regs = (u32 *)calloc(1U, REG_SPACE_SIZE);
+	if(Regs == NULL) {
+		printf("Failed to allocate memory.\n");
+		return -1;
+	}
+
+	RC = XAie_RegisterBackend("memtxn", &MemIOOps);
+	if(RC != XAIE_OK) {
+		printf("Failed to register the backend.\n");
+		return -1;
+	}
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIE, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			XAIE_NUM_COLS, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_RES_TILE_ROW_START, XAIE_RES_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	ConfigPtr.BackendName = "memtxn";
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	RC = XAie_ConfigShadowRegs(&DevInst, XAIE_ENABLE);
+	RC |= ApplyConfig(&DevInst, Data, 1U, &Cfg);
+	if(RC != XAIE_OK) {
+		printf("Failed to record the configuration.\n");
+		return -1;
+	}
+
+	/*
+	 * The cache holds the values, not the released payloads. The valid
+	 * bits cleared by the hardware are written again.
+	 */
+	RC = ApplyConfig(&DevInst, Data, 0U, NULL);
+	Regs[CFG_REG_OFF / 4U + CFG_VALID_WORD0] = 0U;
+	Regs[CFG_REG_OFF / 4U + CFG_VALID_WORD1] = 0U;
+	RC |= XAie_SubmitTransactionDelta(&DevInst, Cfg, &NumWr);
+	if((RC != XAIE_OK) || (NumWr != CFG_NUM_VOLATILE) ||
+			(memcmp(&Regs[CFG_REG_OFF / 4U], Data,
+				    sizeof(Data)) != 0)) {
+		printf("Shadow registers do not match the configuration, %u "
+				"registers written.\n", NumWr);
+		return -1;
+	}
+
+	/* A failed transaction invalidates the cache */
+	FailSubmit = 1U;
+	RC = ApplyConfig(&DevInst, Other, 0U, NULL);
+	FailSubmit = 0U;
+	if(RC == XAIE_OK) {
+		printf("Failed transaction was not reported.\n");
+		return -1;
+	}
+
+	RC = XAie_SubmitTransactionDelta(&DevInst, Cfg, &NumWr);
+	if((RC != XAIE_OK) || (NumWr != CFG_NUM_WORDS) ||
+			(memcmp(&Regs[CFG_REG_OFF / 4U], Data,
+				    sizeof(Data)) != 0)) {
+		printf("Shadow registers were not invalidated, %u registers "
+				"written.\n", NumWr);
+		return -1;
+	}
+
+	/* Writes to the core control are never dropped */
+	RC = XAie_StartTransaction(&DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	RC |= XAie_Write32(&DevInst, CORE_CTRL_OFF, 1U);
+	CoreCfg = XAie_ExportTransactionInstance(&DevInst);
+	RC |= XAie_SubmitTransaction(&DevInst, NULL);
+	if((RC != XAIE_OK) || (CoreCfg == NULL)) {
+		printf("Failed to record the core control.\n");
+		return -1;
+	}
+
+	Regs[CORE_CTRL_OFF / 4U] = 0U;
+	RC = XAie_SubmitTransactionDelta(&DevInst, CoreCfg, &NumWr);
+	if((RC != XAIE_OK) || (NumWr != 1U) ||
+			(Regs[CORE_CTRL_OFF / 4U] != 1U)) {
+		printf("Core control was not written, %u registers "
+				"written.\n", NumWr);
+		return -1;
+	}
+
+	XAie_FreeTransactionInstance(CoreCfg);
+	XAie_FreeTransactionInstance(Cfg);
+	XAie_Finish(&DevInst);
+	free(Regs);
+
+	printf("Shadow register transaction test success.\n");
+
+	return 0;
+}
+
+/** @} */
@@ -0,0 +1,148 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_single_gen_bench.c
+* @{
+*
+* This file contains a microbenchmark of the per call cost of the driver APIs
+* which look up the module properties of a tile on every call. It reports the
+* ns/op of each API against an in-memory backend standing in for the registers
+* of a one column AIE-ML partition.
+*
+* The application measures the library it is linked with. To compare a multi
+* generation build with a single generation build, build the driver twice and
+* run the application against each library, e.g.
+*	make -f Makefile.Linux CFLAGS="-O2 -D__AIELINUX__"
+*	make -f Makefile.Linux CFLAGS="-O2 -D__AIELINUX__ \
+*		-DXAIE_DEV_SINGLE_GEN=XAIE_DEV_GEN_AIEML"
+* and compare the text size of both libraries with size(1).
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xaie_mem_backend.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_BASE_ADDR		0x20000000000
+#define XAIE_NUM_ROWS		10U
+#define XAIE_COL_SHIFT		25U
+#define XAIE_ROW_SHIFT		20U
+#define XAIE_SHIM_ROW		0U
+#define XAIE_MEM_TILE_ROW_START	1U
+#define XAIE_MEM_TILE_NUM_ROWS	1U
+#define XAIE_AIE_TILE_ROW_START	2U
+#define XAIE_AIE_TILE_NUM_ROWS	8U
+
+/* The partition starts on a shim NoC column */
+#define PART_START_COL		2U
+#define REG_SPACE_SIZE		(XAIE_NUM_ROWS << XAIE_ROW_SHIFT)
+#define NUM_ITERATIONS		1000000U
+#define NUM_RUNS		7U
+
+/*
+ * Runs an API NUM_RUNS times NUM_ITERATIONS times, the loop index i can be
+ * used in its arguments. Reports the ns/op of the fastest run, which is the
+ * least disturbed by the rest of the system, and ORs the return codes in RC.
+ */
+#define BENCH(Name, Call)						\
+	do {								\
+		uint64_t Best = UINT64_MAX;				\
+		for(u32 Run = 0U; Run < NUM_RUNS; Run++) {		\
+			uint64_t Start = MemTimeNs();			\
+			for(u32 i = 0U; i < NUM_ITERATIONS; i++) {	\
+				RC |= (Call);				\
+			}						\
+			Start = MemTimeNs() - Start;			\
+			Best = (Start < Best) ? Start : Best;		\
+		}							\
+		printf("%-24s %6.1f ns/op\n", (Name),			\
+				(double)Best / NUM_ITERATIONS);		\
+	} while(0)
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the main entry point for the single generation microbenchmark.
+*
+* @param	None.
+*
+* @return	0 on success and error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+int main()
+{
+	AieRC RC;
+	u32 CounterVal;
+	u64 TimerVal;
+	XAie_LocType Tile = XAie_TileLoc(0, XAIE_AIE_TILE_ROW_START);
+	XAie_Lock Lock = XAie_LockInit(3, 1);
+
+	if(MemBackendInit(REG_SPACE_SIZE) != 0) {
+		return -1;
+	}
+
+	XAie_SetupConfig(ConfigPtr, XAIE_DEV_GEN_AIEML, XAIE_BASE_ADDR,
+			XAIE_COL_SHIFT, XAIE_ROW_SHIFT,
+			PART_START_COL + 1U, XAIE_NUM_ROWS, XAIE_SHIM_ROW,
+			XAIE_MEM_TILE_ROW_START, XAIE_MEM_TILE_NUM_ROWS,
+			XAIE_AIE_TILE_ROW_START, XAIE_AIE_TILE_NUM_ROWS);
+	ConfigPtr.BackendName = MEM_BACKEND_NAME;
+
+	XAie_InstDeclare(DevInst, &ConfigPtr);
+	XAie_SetupPartitionConfig(&DevInst, XAIE_BASE_ADDR, PART_START_COL,
+			1U);
+	RC = XAie_CfgInitialize(&DevInst, &ConfigPtr);
+	if(RC != XAIE_OK) {
+		printf("Driver initialization failed.\n");
+		return -1;
+	}
+
+	/* The lock requests succeed once the polled register is set */
+	(void)XAie_LockAcquire(&DevInst, Tile, Lock, 0U);
+	MemRegs[MemLastPoll / 4U] = XAIE_LOCK_REQ_RESULT_SUCCESS;
+	(void)XAie_LockRelease(&DevInst, Tile, Lock, 0U);
+	MemRegs[MemLastPoll / 4U] = XAIE_LOCK_REQ_RESULT_SUCCESS;
+
+	RC = XAIE_OK;
+	BENCH("XAie_LockAcquire", XAie_LockAcquire(&DevInst, Tile, Lock, 0U));
+	BENCH("XAie_LockRelease", XAie_LockRelease(&DevInst, Tile, Lock, 0U));
+	BENCH("XAie_DmaUpdateBdLen", XAie_DmaUpdateBdLen(&DevInst, Tile,
+				((i & 0xFFU) + 1U) * 4U, (u8)(i & 7U)));
+	BENCH("XAie_DmaUpdateBdAddr", XAie_DmaUpdateBdAddr(&DevInst, Tile,
+				(i & 0xFFU) * 16U, (u8)(i & 7U)));
+	BENCH("XAie_DmaChannelPushBd", XAie_DmaChannelPushBdToQueue(&DevInst,
+				Tile, 0U, DMA_S2MM, (u8)(i & 7U)));
+	BENCH("XAie_PerfCounterGet", XAie_PerfCounterGet(&DevInst, Tile,
+				XAIE_CORE_MOD, (u8)(i & 3U), &CounterVal));
+	BENCH("XAie_EventGenerate", XAie_EventGenerate(&DevInst, Tile,
+				XAIE_CORE_MOD, XAIE_EVENT_USER_EVENT_0_CORE));
+	BENCH("XAie_ReadTimer", XAie_ReadTimer(&DevInst, Tile,
+				XAIE_CORE_MOD, &TimerVal));
+	BENCH("XAie_CoreEnable", XAie_CoreEnable(&DevInst, Tile));
+	BENCH("XAie_StrmConnCctEnable", XAie_StrmConnCctEnable(&DevInst, Tile,
+				SOUTH, (u8)(i & 3U), NORTH, (u8)(i & 3U)));
+	BENCH("XAie_TraceStartEvent", XAie_TraceStartEvent(&DevInst, Tile,
+				XAIE_CORE_MOD, XAIE_EVENT_USER_EVENT_0_CORE));
+
+	if(RC != XAIE_OK) {
+		printf("Benchmarked APIs failed.\n");
+		return -1;
+	}
+
+	XAie_Finish(&DevInst);
+	free(MemRegs);
+
+	printf("Success\n");
+
+	return 0;
+}
+
+/** @} */
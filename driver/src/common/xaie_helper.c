@@ -36,15 +36,26 @@
 #include <string.h>
 
 #include "xaie_helper.h"
+#include "xaie_io_stats.h"
 
 /************************** Constant Definitions *****************************/
 #define XAIE_DEFAULT_NUM_CMDS 1024U
 
-#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
 #define XAIE_TXN_INST_EXPORTED_MASK XAIE_TXN_INSTANCE_EXPORTED
 #define XAIE_TXN_AUTO_FLUSH_MASK XAIE_TRANSACTION_ENABLE_AUTO_FLUSH
 
 /************************** Variable Definitions *****************************/
+/*
+ * Nonzero while the calling thread runs a backend operation with the lazy tile
+ * power up enabled. Per thread, so that the IO operations of the other threads
+ * still ungate their tiles meanwhile.
+ */
+#ifdef __linux__
+static _Thread_local u32 _XAie_PmLazyHold;
+#else
+static u32 _XAie_PmLazyHold;
+#endif
+
 /***************************** Macro Definitions *****************************/
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
@@ -114,7 +125,7 @@ AieRC _XAie_CheckModule(XAie_DevInst *DevInst,
 {
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_AIETILE && Module > XAIE_CORE_MOD) {
 		XAIE_ERROR("Invalid Module\n");
 		return XAIE_INVALID_ARGS;
@@ -320,11 +331,11 @@ u32 _XAie_GetFatalGroupErrors(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u8 TileType;
 	const XAie_EvntMod *EvntMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	return EvntMod->DefaultGroupErrorMask;
@@ -577,21 +588,120 @@ AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* These APIs record a register write executed by the backend in the shadow
+* register cache, if it is enabled.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset
+* @param        Mask: Mask of the written bits, 0 for a full register write
+* @param        Data: Written block, NULL for a block set
+* @param        Value: Written value
+* @param        Size: Number of 32-bit words of the block
+* @param        RC: Return code of the backend operation
+*
+* @return       RC.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline AieRC _XAie_ShadowWr(XAie_DevInst *DevInst, u64 RegOff,
+		u32 Mask, u32 Value, AieRC RC)
+{
+	if((RC == XAIE_OK) && (DevInst->ShadowRegs != NULL)) {
+		_XAie_ShadowUpdate(DevInst, RegOff, Mask, Value);
+	}
+
+	return RC;
+}
+
+static inline AieRC _XAie_ShadowBlkWr(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size, AieRC RC)
+{
+	if((RC == XAIE_OK) && (DevInst->ShadowRegs != NULL)) {
+		_XAie_ShadowUpdateBlock(DevInst, RegOff, Data, Value, Size);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API keeps the shadow register cache consistent with the registers
+* written by a backend operation. Operations which reset or power gate tiles
+* clear the cache, invalidate the elf load records and free the stream switch
+* ports.
+*
+* @param        DevInst: Device instance pointer
+* @param        Op: Backend operation
+* @param        Arg: Argument of the operation
+* @param        RC: Return code of the backend operation
+*
+* @return       RC.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline AieRC _XAie_ShadowRunOp(XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg, AieRC RC)
+{
+	if((DevInst->ShadowRegs == NULL) && (DevInst->ElfLoadRecs == NULL) &&
+			(DevInst->StrmPortMap == NULL)) {
+		return RC;
+	}
+
+	switch(Op) {
+	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+	{
+		XAie_ShimDmaBdArgs *BdArgs = (XAie_ShimDmaBdArgs *)Arg;
+
+		if((RC == XAIE_OK) && (DevInst->ShadowRegs != NULL)) {
+			_XAie_ShadowUpdateBlock(DevInst, BdArgs->Addr,
+					BdArgs->BdWords, 0U,
+					BdArgs->NumBdWords);
+		}
+		break;
+	}
+	case XAIE_BACKEND_OP_REQUEST_TILES:
+		/*
+		 * With the lazy power up, the tiles are ungated before they
+		 * are accessed. Nothing was written to the tiles while they
+		 * were gated, so the cached state remains valid.
+		 */
+		if(DevInst->PmLazy != NULL) {
+			break;
+		}
+		/* fall through */
+	case XAIE_BACKEND_OP_RST_PART:
+	case XAIE_BACKEND_OP_ASSERT_SHIMRST:
+	case XAIE_BACKEND_OP_RELEASE_TILES:
+	case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+	case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+		_XAie_ShadowInvalidate(DevInst);
+		_XAie_ElfLoadRecsInvalidate(DevInst);
+		_XAie_StrmPortMapReset(DevInst);
+		break;
+	default:
+		break;
+	}
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * This API decodes the command type and executes the IO operation.
 *
 * @param        DevInst: Device instance pointer
 * @param        Cmd: Pointer to the transaction command structure
-* @param	Flags: Transaction instance flags
 *
 * @return       XAIE_OK on success and XAIE_ERR on failure.
 *
-* @note         Internal only.
+* @note         Internal only. The payload of the command is not freed.
 *
 ******************************************************************************/
-static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
-		u32 Flags)
+static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd)
 {
 	AieRC RC;
 	const XAie_Backend *Backend = DevInst->Backend;
@@ -600,13 +710,15 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 	{
 		case XAIE_IO_WRITE:
 			if(!Cmd->Mask) {
-				RC = Backend->Ops.Write32((void*)DevInst->IOInst,
-						Cmd->RegOff, Cmd->Value);
+				RC = XAIE_IO_STATS(XAIE_IO_STATS_WRITE32, 4U,
+					Backend->Ops.Write32((void*)DevInst->IOInst,
+							Cmd->RegOff, Cmd->Value));
 			} else {
 
-				RC = Backend->Ops.MaskWrite32((void*)DevInst->IOInst,
-							Cmd->RegOff, Cmd->Mask,
-							Cmd->Value);
+				RC = XAIE_IO_STATS(XAIE_IO_STATS_MASKWRITE32, 4U,
+					Backend->Ops.MaskWrite32((void*)DevInst->IOInst,
+								Cmd->RegOff, Cmd->Mask,
+								Cmd->Value));
 			}
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Wr failed. Addr: 0x%lx, Mask: 0x%x,"
@@ -614,31 +726,36 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 						Cmd->Mask, Cmd->Value);
 				return RC;
 			}
+			_XAie_ShadowWr(DevInst, Cmd->RegOff, Cmd->Mask,
+					Cmd->Value, RC);
 			break;
 		case XAIE_IO_BLOCKWRITE:
-			RC = Backend->Ops.BlockWrite32((void *)DevInst->IOInst,
-					Cmd->RegOff,
-					(u32 *)(uintptr_t)Cmd->DataPtr,
-					Cmd->Size);
+			RC = XAIE_IO_STATS(XAIE_IO_STATS_BLOCKWRITE32, Cmd->Size * 4U,
+				Backend->Ops.BlockWrite32((void *)DevInst->IOInst,
+						Cmd->RegOff,
+						(u32 *)(uintptr_t)Cmd->DataPtr,
+						Cmd->Size));
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
 						Cmd->RegOff);
 				return RC;
 			}
-
-			if(!(Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
-				free((void *)Cmd->DataPtr);
-			}
+			_XAie_ShadowBlkWr(DevInst, Cmd->RegOff,
+					(u32 *)(uintptr_t)Cmd->DataPtr, 0U,
+					Cmd->Size, RC);
 			break;
 		case XAIE_IO_BLOCKSET:
-			RC = Backend->Ops.BlockSet32((void *)DevInst->IOInst,
-					Cmd->RegOff, Cmd->Value,
-					Cmd->Size);
+			RC = XAIE_IO_STATS(XAIE_IO_STATS_BLOCKSET32, Cmd->Size * 4U,
+				Backend->Ops.BlockSet32((void *)DevInst->IOInst,
+						Cmd->RegOff, Cmd->Value,
+						Cmd->Size));
 			if(RC != XAIE_OK) {
 				XAIE_ERROR("Block Wr failed. Addr: 0x%lx\n",
 						Cmd->RegOff);
 				return RC;
 			}
+			_XAie_ShadowBlkWr(DevInst, Cmd->RegOff, NULL,
+					Cmd->Value, Cmd->Size, RC);
 			break;
 		default:
 			XAIE_ERROR("Invalid transaction opcode\n");
@@ -648,6 +765,36 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API frees the block write payloads of the commands of a transaction
+* instance which is not exported to the user and empties its command buffer.
+* The commands cannot be executed again once their payloads are freed.
+*
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+void _XAie_Txn_FreePayloads(XAie_TxnInst *TxnInst)
+{
+	if(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK) {
+		return;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		if(Cmd->Opcode == XAIE_IO_BLOCKWRITE) {
+			free((void *)(uintptr_t)Cmd->DataPtr);
+			Cmd->DataPtr = 0U;
+		}
+	}
+	TxnInst->NumCmds = 0U;
+}
+
 /*****************************************************************************/
 /**
 * This API executes all the commands in the command buffer and resets the number
@@ -658,31 +805,51 @@ static AieRC _XAie_ExecuteCmd(XAie_DevInst *DevInst, XAie_TxnCmd *Cmd,
 *
 * @return       XAIE_OK on success and XAIE_ERR on failure
 *
-* @note         Internal only. This API does not allocate, reallocate or free
-*		any buffer.
+* @note         Internal only. The driver owns the commands and their
+*		payloads. Backends only read them during SubmitTxn. The block
+*		write payloads of a transaction which is not exported are freed
+*		here, after the backend operations return.
 *
 ******************************************************************************/
 static AieRC _XAie_Txn_FlushCmdBuf(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 {
-	AieRC RC;
+	AieRC RC = XAIE_OK;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	/* Keep ordering with the transactions submitted asynchronously */
+	_XAie_TxnAsyncDrain(DevInst);
+
 	XAIE_DBG("Flushing %d commands from transaction buffer\n",
 			TxnInst->NumCmds);
 
 	if(Backend->Ops.SubmitTxn != NULL) {
-		return Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst);
-	}
+		/*
+		 * Record the transaction in the shadow register cache before
+		 * it is submitted, so that the cache never reads the commands
+		 * once the backend has processed them. A failed transaction
+		 * may be partially applied, the cache is invalidated then.
+		 */
+		if(DevInst->ShadowRegs != NULL) {
+			_XAie_ShadowUpdateTxn(DevInst, TxnInst);
+		}
 
-	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
-		RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i],
-				TxnInst->Flags);
-		if (RC != XAIE_OK) {
-			 return RC;
+		RC = XAIE_IO_STATS(XAIE_IO_STATS_SUBMITTXN, 0U,
+			Backend->Ops.SubmitTxn(DevInst->IOInst, TxnInst));
+		if(RC != XAIE_OK) {
+			_XAie_ShadowInvalidate(DevInst);
+		}
+	} else {
+		for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+			RC = _XAie_ExecuteCmd(DevInst, &TxnInst->CmdBuf[i]);
+			if (RC != XAIE_OK) {
+				break;
+			}
 		}
 	}
 
-	return XAIE_OK;
+	_XAie_Txn_FreePayloads(TxnInst);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -743,6 +910,123 @@ AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API removes the transaction instance of the calling thread from the
+* transaction list of the device instance. The caller owns the instance after
+* it is removed.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       Pointer to the transaction instance on success and NULL on
+*		failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst)
+{
+	XAie_TxnInst *Inst;
+	const XAie_Backend *Backend = DevInst->Backend;
+	u64 Tid = Backend->Ops.GetTid();
+
+	Inst = _XAie_GetTxnInst(DevInst, Tid);
+	if(Inst == NULL) {
+		XAIE_ERROR("Failed to get the correct transaction instance\n");
+		return NULL;
+	}
+
+	if(_XAie_RemoveTxnInstFromList(DevInst, Tid) != XAIE_OK) {
+		return NULL;
+	}
+
+	return Inst;
+}
+
+/*****************************************************************************/
+/**
+* This API executes all the commands of a transaction instance which is not
+* part of the transaction list of the device instance. The instance is freed
+* after the execution unless it is exported to the user.
+*
+* @param        DevInst: Device instance pointer
+* @param        TxnInst: Pointer to the transaction instance
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+AieRC _XAie_TxnExecute(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	AieRC RC;
+
+	RC = _XAie_Txn_FlushCmdBuf(DevInst, TxnInst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Flushing the buffer failed\n");
+	}
+
+	if(!(TxnInst->Flags & XAIE_TXN_INST_EXPORTED_MASK)) {
+		free(TxnInst->CmdBuf);
+		free(TxnInst);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API waits for the asynchronously submitted transactions of the device
+* instance before an IO operation is issued to the backend. IO operations
+* recorded to the transaction of the calling thread do not wait.
+*
+* @param        DevInst: Device instance pointer
+*
+* @return       None.
+*
+* @note         Internal only.
+*
+******************************************************************************/
+static inline void _XAie_TxnAsyncSync(XAie_DevInst *DevInst)
+{
+	const XAie_Backend *Backend = DevInst->Backend;
+
+	if(DevInst->TxnQueue == NULL) {
+		return;
+	}
+
+	if((DevInst->TxnList.Next != NULL) &&
+			(_XAie_GetTxnInst(DevInst, Backend->Ops.GetTid()) !=
+			 NULL)) {
+		return;
+	}
+
+	_XAie_TxnAsyncDrain(DevInst);
+}
+
+/*****************************************************************************/
+/**
+* This API ungates the tile targeted by an IO operation if the lazy tile power
+* up is enabled and the tile is not in use yet.
+*
+* @param        DevInst: Device instance pointer
+* @param        RegOff: Register offset of the IO operation
+*
+* @return       XAIE_OK on success and error code on failure.
+*
+* @note         Internal only. The IO operations issued by the backend
+*		operations, e.g. to request the tiles, do not ungate tiles.
+*
+******************************************************************************/
+static inline AieRC _XAie_PmLazyCheck(XAie_DevInst *DevInst, u64 RegOff)
+{
+	if((DevInst->PmLazy == NULL) || (_XAie_PmLazyHold != 0U)) {
+		return XAIE_OK;
+	}
+
+	return _XAie_PmLazyUngate(DevInst, RegOff);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -898,6 +1182,13 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -905,7 +1196,9 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Mask writing "
 					"to register\n");
-			return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+			return _XAie_ShadowWr(DevInst, RegOff, 0U, Value,
+				XAIE_IO_STATS(XAIE_IO_STATS_WRITE32, 4U,
+					Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value)));
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -923,7 +1216,9 @@ AieRC XAie_Write32(XAie_DevInst *DevInst, u64 RegOff, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value);
+	return _XAie_ShadowWr(DevInst, RegOff, 0U, Value,
+		XAIE_IO_STATS(XAIE_IO_STATS_WRITE32, 4U,
+			Backend->Ops.Write32((void*)(DevInst->IOInst), RegOff, Value)));
 }
 
 AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
@@ -933,6 +1228,13 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -940,7 +1242,8 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Reading "
 					"from register\n");
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return XAIE_IO_STATS(XAIE_IO_STATS_READ32, 4U,
+				Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data));
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -955,16 +1258,19 @@ AieRC XAie_Read32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data)
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return XAIE_IO_STATS(XAIE_IO_STATS_READ32, 4U,
+				Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data));
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+			return XAIE_IO_STATS(XAIE_IO_STATS_READ32, 4U,
+				Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data));
 		} else {
 			XAIE_ERROR("Read operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data);
+	return XAIE_IO_STATS(XAIE_IO_STATS_READ32, 4U,
+		Backend->Ops.Read32((void*)(DevInst->IOInst), RegOff, Data));
 }
 
 AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
@@ -974,6 +1280,13 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -981,8 +1294,10 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing "
 					"to register\n");
-			return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
-					Value);
+			return _XAie_ShadowWr(DevInst, RegOff, Mask, Value,
+				XAIE_IO_STATS(XAIE_IO_STATS_MASKWRITE32, 4U,
+					Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+							Value)));
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1000,8 +1315,10 @@ AieRC XAie_MaskWrite32(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
-			Value);
+	return _XAie_ShadowWr(DevInst, RegOff, Mask, Value,
+		XAIE_IO_STATS(XAIE_IO_STATS_MASKWRITE32, 4U,
+			Backend->Ops.MaskWrite32((void *)(DevInst->IOInst), RegOff, Mask,
+					Value)));
 }
 
 AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
@@ -1012,6 +1329,13 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -1019,8 +1343,9 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Polling "
 					"from register\n");
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return XAIE_IO_STATS(XAIE_IO_STATS_MASKPOLL, 0U,
+				Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
+						Value, TimeOutUs));
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1035,19 +1360,22 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return XAIE_IO_STATS(XAIE_IO_STATS_MASKPOLL, 0U,
+				Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
+						Value, TimeOutUs));
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-					Value, TimeOutUs);
+			return XAIE_IO_STATS(XAIE_IO_STATS_MASKPOLL, 0U,
+				Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
+						Value, TimeOutUs));
 		} else {
 			XAIE_ERROR("MaskPoll operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
-			Value, TimeOutUs);
+	return XAIE_IO_STATS(XAIE_IO_STATS_MASKPOLL, 0U,
+		Backend->Ops.MaskPoll((void*)(DevInst->IOInst), RegOff, Mask,
+				Value, TimeOutUs));
 }
 
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32 Size)
@@ -1058,6 +1386,13 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -1065,8 +1400,10 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block write "
 					"to register\n");
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
-					Data, Size);
+			return _XAie_ShadowBlkWr(DevInst, RegOff, Data, 0U, Size,
+				XAIE_IO_STATS(XAIE_IO_STATS_BLOCKWRITE32, Size * 4U,
+					Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+							Data, Size)));
 		}
 
 		if(TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
@@ -1082,8 +1419,10 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
-					Data, Size);
+			return _XAie_ShadowBlkWr(DevInst, RegOff, Data, 0U, Size,
+				XAIE_IO_STATS(XAIE_IO_STATS_BLOCKWRITE32, Size * 4U,
+					Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+							Data, Size)));
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1109,8 +1448,10 @@ AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data, u32
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
-			Data, Size);
+	return _XAie_ShadowBlkWr(DevInst, RegOff, Data, 0U, Size,
+		XAIE_IO_STATS(XAIE_IO_STATS_BLOCKWRITE32, Size * 4U,
+			Backend->Ops.BlockWrite32((void *)(DevInst->IOInst), RegOff,
+					Data, Size)));
 }
 
 AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
@@ -1120,6 +1461,13 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -1127,8 +1475,10 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Block set "
 					"to register\n");
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-					Size);
+			return _XAie_ShadowBlkWr(DevInst, RegOff, NULL, Data, Size,
+				XAIE_IO_STATS(XAIE_IO_STATS_BLOCKSET32, Size * 4U,
+					Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+							Size)));
 		}
 
 		if(TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) {
@@ -1144,8 +1494,10 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-					Size);
+			return _XAie_ShadowBlkWr(DevInst, RegOff, NULL, Data, Size,
+				XAIE_IO_STATS(XAIE_IO_STATS_BLOCKSET32, Size * 4U,
+					Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+							Size)));
 		}
 
 		if(TxnInst->NumCmds + 1U == TxnInst->MaxCmds) {
@@ -1164,8 +1516,10 @@ AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size)
 
 		return XAIE_OK;
 	}
-	return Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
-			Size);
+	return _XAie_ShadowBlkWr(DevInst, RegOff, NULL, Data, Size,
+		XAIE_IO_STATS(XAIE_IO_STATS_BLOCKSET32, Size * 4U,
+			Backend->Ops.BlockSet32((void *)(DevInst->IOInst), RegOff, Data,
+					Size)));
 }
 
 AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
@@ -1176,6 +1530,13 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, _XAie_GetTileAddr(DevInst, Row, Col));
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
@@ -1183,8 +1544,9 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Writing cmd "
 					"to register\n");
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			return XAIE_IO_STATS(XAIE_IO_STATS_CMDWRITE, 0U,
+				Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+						Command, CmdWd0, CmdWd1, CmdStr));
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1199,35 +1561,43 @@ AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			return XAIE_IO_STATS(XAIE_IO_STATS_CMDWRITE, 0U,
+				Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+						Command, CmdWd0, CmdWd1, CmdStr));
 		} else if(TxnInst->NumCmds == 0U) {
-			return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-					Command, CmdWd0, CmdWd1, CmdStr);
+			return XAIE_IO_STATS(XAIE_IO_STATS_CMDWRITE, 0U,
+				Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+						Command, CmdWd0, CmdWd1, CmdStr));
 		} else {
 			XAIE_ERROR("Cmd Write operation is not supported "
 					"when auto flush is disabled\n");
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
-			Command, CmdWd0, CmdWd1, CmdStr);
+	return XAIE_IO_STATS(XAIE_IO_STATS_CMDWRITE, 0U,
+		Backend->Ops.CmdWrite((void *)(DevInst->IOInst), Col, Row,
+				Command, CmdWd0, CmdWd1, CmdStr));
 }
 
-AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
+static AieRC _XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op,
+		void *Arg)
 {
 	AieRC RC;
 	u64 Tid;
 	XAie_TxnInst *TxnInst;
 	const XAie_Backend *Backend = DevInst->Backend;
 
+	_XAie_TxnAsyncSync(DevInst);
+
 	if(DevInst->TxnList.Next != NULL) {
 		Tid = Backend->Ops.GetTid();
 		TxnInst = _XAie_GetTxnInst(DevInst, Tid);
 		if(TxnInst == NULL) {
 			XAIE_DBG("Could not find transaction instance "
 					"associated with thread. Running Op.\n");
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_ShadowRunOp(DevInst, Op, Arg,
+				XAIE_IO_STATS(XAIE_IO_STATS_RUNOP, 0U,
+					Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg)));
 		}
 
 		if((TxnInst->Flags & XAIE_TXN_AUTO_FLUSH_MASK) &&
@@ -1240,9 +1610,13 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 			}
 
 			TxnInst->NumCmds = 0;
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_ShadowRunOp(DevInst, Op, Arg,
+				XAIE_IO_STATS(XAIE_IO_STATS_RUNOP, 0U,
+					Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg)));
 		} else if(TxnInst->NumCmds == 0) {
-			return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+			return _XAie_ShadowRunOp(DevInst, Op, Arg,
+				XAIE_IO_STATS(XAIE_IO_STATS_RUNOP, 0U,
+					Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg)));
 		} else if((Op == XAIE_BACKEND_OP_CONFIG_SHIMDMABD) &&
 				(Backend->Type != XAIE_IO_BACKEND_LINUX)) {
 			/*
@@ -1266,7 +1640,62 @@ AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
 			return XAIE_ERR;
 		}
 	}
-	return Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg);
+	return _XAie_ShadowRunOp(DevInst, Op, Arg,
+		XAIE_IO_STATS(XAIE_IO_STATS_RUNOP, 0U,
+			Backend->Ops.RunOp(DevInst->IOInst, DevInst, Op, Arg)));
+}
+
+AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg)
+{
+	AieRC RC;
+
+	if(DevInst->PmLazy == NULL) {
+		return _XAie_RunOp(DevInst, Op, Arg);
+	}
+
+	/* The IO operations of the backend operation do not ungate tiles */
+	_XAie_PmLazyHold++;
+	RC = _XAie_RunOp(DevInst, Op, Arg);
+	_XAie_PmLazyHold--;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a block of registers with a single backend operation.
+*
+* @param	DevInst: Device instance pointer
+* @param	RegOff: Offset of the first register.
+* @param	Data: Buffer to return the register values.
+* @param	Size: Number of 32-bit registers to read.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		cannot read a block, error code on failure.
+*
+* @note		Internal only. The registers shall be in the same tile. The
+*		caller falls back to XAie_Read32() if the operation is not
+*		supported.
+*
+******************************************************************************/
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size)
+{
+	AieRC RC;
+	XAie_BackendBlockRdReq Req;
+
+	_XAie_TxnAsyncSync(DevInst);
+
+	RC = _XAie_PmLazyCheck(DevInst, RegOff);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	Req.RegOff = RegOff;
+	Req.Data = Data;
+	Req.Size = Size;
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_BLOCK_READ32, (void *)&Req);
 }
 
 /** @} */
@@ -83,6 +83,29 @@
 /* Generate value with a set bit at given Index */
 #define BIT(Index)		(1 << (Index))
 
+/* Transaction instance flag to indicate that it is exported to the user */
+#define XAIE_TXN_INSTANCE_EXPORTED	0b10U
+
+/*
+ * Single generation builds resolve the module tables and the device ops at
+ * build time instead of loading them from the device instance.
+ */
+#if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
+#include "xaie_device_aieml.h"
+#define XAIE_DEV_SINGLE_MOD		AieMlMod
+#define XAIE_DEV_SINGLE_DEVOPS		AieMlDevOps
+#define XAIE_DEV_SINGLE_GET_TTYPE	_XAieMl_GetTTypefromLoc
+#elif XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIE
+#include "xaie_device_aie.h"
+#define XAIE_DEV_SINGLE_MOD		AieMod
+#define XAIE_DEV_SINGLE_DEVOPS		AieDevOps
+#define XAIE_DEV_SINGLE_GET_TTYPE	_XAie_GetTTypefromLoc
+#else
+#ifdef XAIE_DEV_SINGLE_GEN
+#error "Unsupported device defined."
+#endif
+#endif
+
 /**************************** Type Definitions *******************************/
 typedef enum {
 	XAIE_IO_WRITE,
@@ -99,7 +122,60 @@ struct XAie_TxnCmd {
 	u32 Size;
 };
 
+/************************** Variable Definitions *****************************/
+extern const XAie_TileMod AieMod[XAIEGBL_TILE_TYPE_MAX];
+extern const XAie_TileMod AieMlMod[XAIEGBL_TILE_TYPE_MAX];
+
+extern const XAie_DeviceOps AieDevOps;
+extern const XAie_DeviceOps AieMlDevOps;
+
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the tile type of a tile location.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @return	TileType (AIETILE/MEMTILE/SHIMPL/SHIMNOC on success and MAX on
+*		error)
+*
+* @note		Internal API only. Single generation builds call the device
+*		specific function directly.
+*
+******************************************************************************/
+static inline u8 _XAie_DevGetTTypefromLoc(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+#ifdef XAIE_DEV_SINGLE_GEN
+	return XAIE_DEV_SINGLE_GET_TTYPE(DevInst, Loc);
+#else
+	return DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the module properties of the device, indexed by tile type.
+*
+* @param	DevInst: Device Instance
+* @return	Pointer to the module properties of the device.
+*
+* @note		Internal API only. Single generation builds use the constant
+*		module table of the device directly.
+*
+******************************************************************************/
+static inline const XAie_TileMod *_XAie_GetDevMod(XAie_DevInst *DevInst)
+{
+#ifdef XAIE_DEV_SINGLE_GEN
+	(void)DevInst;
+	return XAIE_DEV_SINGLE_MOD;
+#else
+	return DevInst->DevProp.DevMod;
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -168,14 +244,33 @@ AieRC XAie_MaskPoll(XAie_DevInst *DevInst, u64 RegOff, u32 Mask, u32 Value,
 AieRC XAie_BlockWrite32(XAie_DevInst *DevInst, u64 RegOff, const u32 *Data,
 			u32 Size);
 AieRC XAie_BlockSet32(XAie_DevInst *DevInst, u64 RegOff, u32 Data, u32 Size);
+AieRC XAie_BlockRead32(XAie_DevInst *DevInst, u64 RegOff, u32 *Data, u32 Size);
 AieRC XAie_CmdWrite(XAie_DevInst *DevInst, u8 Col, u8 Row, u8 Command,
 		u32 CmdWd0, u32 CmdWd1, const char *CmdStr);
 AieRC XAie_RunOp(XAie_DevInst *DevInst, XAie_BackendOpCode Op, void *Arg);
 AieRC _XAie_Txn_Start(XAie_DevInst *DevInst, u32 Flags);
 AieRC _XAie_Txn_Submit(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+void _XAie_Txn_FreePayloads(XAie_TxnInst *TxnInst);
 XAie_TxnInst* _XAie_TxnExport(XAie_DevInst *DevInst);
 AieRC _XAie_TxnFree(XAie_TxnInst *Inst);
 void _XAie_TxnResourceCleanup(XAie_DevInst *DevInst);
+XAie_TxnInst* _XAie_TxnDetach(XAie_DevInst *DevInst);
+AieRC _XAie_TxnExecute(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+void _XAie_TxnAsyncDrain(XAie_DevInst *DevInst);
+void _XAie_TxnAsyncFinish(XAie_DevInst *DevInst);
+void _XAie_ShadowUpdate(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value);
+void _XAie_ShadowUpdateBlock(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size);
+void _XAie_ShadowUpdateTxn(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst);
+void _XAie_ShadowFree(XAie_DevInst *DevInst);
+void _XAie_ElfLoadRecsInvalidate(XAie_DevInst *DevInst);
+void _XAie_ElfLoadRecsFree(XAie_DevInst *DevInst);
+void _XAie_StrmPortMapReset(XAie_DevInst *DevInst);
+void _XAie_StrmPortMapFree(XAie_DevInst *DevInst);
+AieRC _XAie_PmLazyUngate(XAie_DevInst *DevInst, u64 RegOff);
+void _XAie_PmLazyFree(XAie_DevInst *DevInst);
 u32 _XAie_GetNumRows(XAie_DevInst *DevInst, u8 TileType);
 u32 _XAie_GetStartRow(XAie_DevInst *DevInst, u8 TileType);
 
@@ -0,0 +1,838 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow.c
+* @{
+*
+* This file contains routines for the shadow register cache. When enabled, the
+* cache records the last value written by the driver to each register. A
+* configuration recorded as an exported transaction can then be applied with
+* XAie_SubmitTransactionDelta(), which only writes the registers whose value
+* differs from the cache.
+*
+* The cache only knows the writes issued by the driver. The registers updated
+* by the hardware or with side effects on write, i.e. the locks, the DMA start
+* queues and channel controls, the core control and the BD word holding the
+* valid bit, are identified from the module properties and always written.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_helper.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_SHADOW_INIT_BITS	10U
+#define XAIE_SHADOW_EMPTY	(~0ULL)
+
+/* Flag of the target registers whose final value depends on the hardware */
+#define XAIE_SHADOW_TARGET_UNKNOWN	0x80000000U
+/* Flag of the target registers with side effects, written by every command */
+#define XAIE_SHADOW_TARGET_VOLATILE	0x40000000U
+#define XAIE_SHADOW_TARGET_FLAGS	(XAIE_SHADOW_TARGET_UNKNOWN | \
+		XAIE_SHADOW_TARGET_VOLATILE)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 RegOff;	/* XAIE_SHADOW_EMPTY for an empty entry */
+	u32 Value;
+	u32 LastCmd;	/* Target configurations only, see below */
+} XAie_ShadowEntry;
+
+/*
+ * Open addressing hash table of the register values, indexed by the register
+ * offset. Entries are never removed individually.
+ */
+struct XAie_ShadowRegs {
+	u32 Bits;		/* Log2 of the number of entries */
+	u32 NumUsed;		/* Number of used entries */
+	XAie_ShadowEntry *Entries;
+};
+
+/************************** Function Definitions *****************************/
+static inline u32 _XAie_ShadowHash(u64 RegOff, u32 Bits)
+{
+	return (u32)(((RegOff >> 2U) * 0x9E3779B97F4A7C15ULL) >> (64U - Bits));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API finds the entry of a register in the shadow register cache.
+*
+* @param	Shadow: Shadow register cache.
+* @param	RegOff: Register offset.
+*
+* @return	Entry of the register, or the empty entry where it shall be
+*		inserted.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_ShadowEntry *_XAie_ShadowFind(struct XAie_ShadowRegs *Shadow,
+		u64 RegOff)
+{
+	u32 Mask = (1U << Shadow->Bits) - 1U;
+	u32 Idx = _XAie_ShadowHash(RegOff, Shadow->Bits);
+
+	while((Shadow->Entries[Idx].RegOff != RegOff) &&
+			(Shadow->Entries[Idx].RegOff != XAIE_SHADOW_EMPTY)) {
+		Idx = (Idx + 1U) & Mask;
+	}
+
+	return &Shadow->Entries[Idx];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates the entries of the shadow register cache.
+*
+* @param	Shadow: Shadow register cache.
+* @param	Bits: Log2 of the number of entries.
+*
+* @return	XAIE_OK on success, XAIE_ERR on allocation failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_ShadowAlloc(struct XAie_ShadowRegs *Shadow, u32 Bits)
+{
+	XAie_ShadowEntry *Entries;
+
+	Entries = (XAie_ShadowEntry *)malloc(sizeof(*Entries) << Bits);
+	if(Entries == NULL) {
+		XAIE_ERROR("Memory allocation for shadow registers failed\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < (1U << Bits); i++) {
+		Entries[i].RegOff = XAIE_SHADOW_EMPTY;
+	}
+
+	Shadow->Bits = Bits;
+	Shadow->NumUsed = 0U;
+	Shadow->Entries = Entries;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stores the value of a register in the shadow register cache. The
+* cache is doubled when it is three quarters full.
+*
+* @param	Shadow: Shadow register cache.
+* @param	RegOff: Register offset.
+* @param	Value: Register value.
+*
+* @return	None.
+*
+* @note		Internal only. If the cache cannot grow, it is cleared so that
+*		it never holds a wrong value.
+*
+*******************************************************************************/
+static void _XAie_ShadowStore(struct XAie_ShadowRegs *Shadow, u64 RegOff,
+		u32 Value)
+{
+	XAie_ShadowEntry *Entry = _XAie_ShadowFind(Shadow, RegOff);
+
+	if(Entry->RegOff == XAIE_SHADOW_EMPTY) {
+		if((Shadow->NumUsed + 1U) * 4U > (3U << Shadow->Bits)) {
+			XAie_ShadowEntry *Old = Shadow->Entries;
+			u32 OldSize = 1U << Shadow->Bits;
+
+			if(_XAie_ShadowAlloc(Shadow, Shadow->Bits + 1U) !=
+					XAIE_OK) {
+				for(u32 i = 0U; i < OldSize; i++) {
+					Old[i].RegOff = XAIE_SHADOW_EMPTY;
+				}
+				Shadow->NumUsed = 0U;
+				return;
+			}
+
+			for(u32 i = 0U; i < OldSize; i++) {
+				if(Old[i].RegOff != XAIE_SHADOW_EMPTY) {
+					*_XAie_ShadowFind(Shadow,
+						Old[i].RegOff) = Old[i];
+					Shadow->NumUsed++;
+				}
+			}
+			free(Old);
+
+			Entry = _XAie_ShadowFind(Shadow, RegOff);
+		}
+
+		Entry->RegOff = RegOff;
+		Shadow->NumUsed++;
+	}
+
+	Entry->Value = Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API looks up the value of a register in the shadow register cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset.
+* @param	Value: Pointer to return the register value.
+*
+* @return	XAIE_ENABLE if the value is known, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_ShadowLookup(XAie_DevInst *DevInst, u64 RegOff, u32 *Value)
+{
+	XAie_ShadowEntry *Entry;
+
+	if(DevInst->ShadowRegs == NULL) {
+		return XAIE_DISABLE;
+	}
+
+	Entry = _XAie_ShadowFind(DevInst->ShadowRegs, RegOff);
+	if(Entry->RegOff == XAIE_SHADOW_EMPTY) {
+		return XAIE_DISABLE;
+	}
+
+	*Value = Entry->Value;
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records a register write in the shadow register cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset.
+* @param	Mask: Mask of the written bits, 0 for a full register write.
+* @param	Value: Written value.
+*
+* @return	None.
+*
+* @note		Internal only. A masked write to a register whose value is not
+*		known leaves the register unknown.
+*
+*******************************************************************************/
+void _XAie_ShadowUpdate(XAie_DevInst *DevInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	struct XAie_ShadowRegs *Shadow = DevInst->ShadowRegs;
+	XAie_ShadowEntry *Entry;
+
+	if(Mask == 0U) {
+		_XAie_ShadowStore(Shadow, RegOff, Value);
+		return;
+	}
+
+	Entry = _XAie_ShadowFind(Shadow, RegOff);
+	if(Entry->RegOff != XAIE_SHADOW_EMPTY) {
+		Entry->Value = (Entry->Value & ~Mask) | Value;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records a block write in the shadow register cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Offset of the first register.
+* @param	Data: Written values, NULL to write Value to all registers.
+* @param	Value: Written value if Data is NULL.
+* @param	Size: Number of registers.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_ShadowUpdateBlock(XAie_DevInst *DevInst, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		_XAie_ShadowStore(DevInst->ShadowRegs, RegOff + i * 4U,
+				(Data != NULL) ? Data[i] : Value);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the commands of a transaction submitted to the backend in
+* the shadow register cache.
+*
+* @param	DevInst: Device instance pointer.
+* @param	TxnInst: Transaction instance to be submitted.
+*
+* @return	None.
+*
+* @note		Internal only. Called before the transaction is submitted, the
+*		block write payloads are not accessed afterwards.
+*
+*******************************************************************************/
+void _XAie_ShadowUpdateTxn(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst)
+{
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			_XAie_ShadowUpdate(DevInst, Cmd->RegOff, Cmd->Mask,
+					Cmd->Value);
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			_XAie_ShadowUpdateBlock(DevInst, Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					0U, Cmd->Size);
+			break;
+		case XAIE_IO_BLOCKSET:
+			_XAie_ShadowUpdateBlock(DevInst, Cmd->RegOff, NULL,
+					Cmd->Value, Cmd->Size);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the shadow register cache. It is called when the registers
+* may have been changed without the knowledge of the cache, e.g. after a
+* partition reset.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_ShadowInvalidate(XAie_DevInst *DevInst)
+{
+	struct XAie_ShadowRegs *Shadow = DevInst->ShadowRegs;
+
+	if(Shadow == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < (1U << Shadow->Bits); i++) {
+		Shadow->Entries[i].RegOff = XAIE_SHADOW_EMPTY;
+	}
+	Shadow->NumUsed = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the shadow register cache.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_ShadowFree(XAie_DevInst *DevInst)
+{
+	if(DevInst->ShadowRegs == NULL) {
+		return;
+	}
+
+	free(DevInst->ShadowRegs->Entries);
+	free(DevInst->ShadowRegs);
+	DevInst->ShadowRegs = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the shadow register cache of the device
+* instance. When enabled, the values written to the registers by the driver
+* are recorded in the cache.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Enable - XAIE_ENABLE to enable, XAIE_DISABLE to disable.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The cache starts empty, registers written before it is enabled
+*		are unknown. Disabling the cache frees it.
+*
+******************************************************************************/
+AieRC XAie_ConfigShadowRegs(XAie_DevInst *DevInst, u8 Enable)
+{
+	struct XAie_ShadowRegs *Shadow;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_ShadowFree(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->ShadowRegs != NULL) {
+		return XAIE_OK;
+	}
+
+	Shadow = (struct XAie_ShadowRegs *)malloc(sizeof(*Shadow));
+	if(Shadow == NULL) {
+		XAIE_ERROR("Memory allocation for shadow registers failed\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_ShadowAlloc(Shadow, XAIE_SHADOW_INIT_BITS);
+	if(RC != XAIE_OK) {
+		free(Shadow);
+		return RC;
+	}
+
+	DevInst->ShadowRegs = Shadow;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the shadow register cache of the device instance. All the
+* registers become unknown and are written by the next delta submission.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Use this API after the registers are changed outside of the
+*		driver.
+*
+******************************************************************************/
+AieRC XAie_InvalidateShadowRegs(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_ShadowInvalidate(DevInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if an offset lies on a register of a strided array.
+*
+* @param	Off: Offset of the register in the tile.
+* @param	Base: Offset of the first register of the array.
+* @param	Stride: Offset between the registers.
+* @param	Num: Number of registers.
+*
+* @return	XAIE_ENABLE if the offset is one of the registers, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u8 _XAie_ShadowInArray(u32 Off, u32 Base, u32 Stride, u32 Num)
+{
+	return (Stride != 0U) && (Off >= Base) && ((Off - Base) % Stride == 0U) &&
+		((Off - Base) / Stride < Num);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a register is updated by the hardware or has side effects
+* on write, based on the module properties of the tile it belongs to. These
+* registers are the lock requests and values, the DMA start queues and channel
+* controls, the core control and the BD word holding the valid bit.
+*
+* @param	DevInst: Device instance pointer.
+* @param	RegOff: Register offset.
+*
+* @return	XAIE_ENABLE if the register has side effects, XAIE_DISABLE
+*		otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_ShadowIsVolatile(XAie_DevInst *DevInst, u64 RegOff)
+{
+	const XAie_TileMod *Mod;
+	const XAie_LockMod *LockMod;
+	const XAie_DmaMod *DmaMod;
+	const XAie_CoreMod *CoreMod;
+	XAie_LocType Loc;
+	u32 Off;
+	u8 RowBits, TileType;
+
+	RowBits = DevInst->DevProp.ColShift - DevInst->DevProp.RowShift;
+	Loc.Col = (u8)(RegOff >> DevInst->DevProp.ColShift);
+	Loc.Row = (u8)((RegOff >> DevInst->DevProp.RowShift) &
+			((1U << RowBits) - 1U));
+	if((Loc.Row >= DevInst->NumRows) || (Loc.Col >= DevInst->NumCols)) {
+		return XAIE_DISABLE;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return XAIE_DISABLE;
+	}
+
+	Mod = &_XAie_GetDevMod(DevInst)[TileType];
+	Off = (u32)(RegOff & ((1ULL << DevInst->DevProp.RowShift) - 1U));
+
+	/* Lock requests span LockIdOff bytes per lock */
+	LockMod = Mod->LockMod;
+	if((LockMod != NULL) && (((Off >= LockMod->BaseAddr) &&
+				(Off - LockMod->BaseAddr <
+				 LockMod->NumLocks * LockMod->LockIdOff)) ||
+			_XAie_ShadowInArray(Off, LockMod->LockSetValBase,
+				LockMod->LockSetValOff, LockMod->NumLocks))) {
+		return XAIE_ENABLE;
+	}
+
+	DmaMod = Mod->DmaMod;
+	if((DmaMod != NULL) && (_XAie_ShadowInArray(Off,
+				DmaMod->StartQueueBase, DmaMod->ChIdxOffset,
+				DmaMod->NumChannels * 2U) ||
+			_XAie_ShadowInArray(Off, DmaMod->ChCtrlBase,
+				DmaMod->ChIdxOffset, DmaMod->NumChannels * 2U) ||
+			((DmaMod->BdProp->BdEn != NULL) &&
+			 _XAie_ShadowInArray(Off, DmaMod->BaseAddr +
+				DmaMod->BdProp->BdEn->ValidBd.Idx * 4U,
+				DmaMod->IdxOffset, DmaMod->NumBds)))) {
+		return XAIE_ENABLE;
+	}
+
+	CoreMod = Mod->CoreMod;
+	if((CoreMod != NULL) && (Off == CoreMod->CoreCtrl->RegOff)) {
+		return XAIE_ENABLE;
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records a register write of a target configuration. The target
+* holds the final value of each register written by the configuration and the
+* index of the last command writing it.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Target: Target configuration.
+* @param	RegOff: Register offset.
+* @param	Mask: Mask of the written bits, 0 for a full register write.
+* @param	Value: Written value.
+* @param	CmdIdx: Index of the command plus one.
+*
+* @return	None.
+*
+* @note		Internal only. The target is sized so that it never grows.
+*
+*******************************************************************************/
+static void _XAie_ShadowTargetWr(XAie_DevInst *DevInst,
+		struct XAie_ShadowRegs *Target, u64 RegOff, u32 Mask, u32 Value,
+		u32 CmdIdx)
+{
+	XAie_ShadowEntry *Entry = _XAie_ShadowFind(Target, RegOff);
+
+	if(Entry->RegOff == XAIE_SHADOW_EMPTY) {
+		Entry->RegOff = RegOff;
+		Entry->LastCmd = 0U;
+		Target->NumUsed++;
+		if(!_XAie_ShadowLookup(DevInst, RegOff, &Entry->Value)) {
+			Entry->Value = 0U;
+			Entry->LastCmd = XAIE_SHADOW_TARGET_UNKNOWN;
+		}
+		if(_XAie_ShadowIsVolatile(DevInst, RegOff)) {
+			Entry->LastCmd |= XAIE_SHADOW_TARGET_VOLATILE;
+		}
+	}
+
+	if(Mask == 0U) {
+		Entry->Value = Value;
+		Entry->LastCmd = (Entry->LastCmd & XAIE_SHADOW_TARGET_VOLATILE) |
+			CmdIdx;
+	} else {
+		Entry->Value = (Entry->Value & ~Mask) | Value;
+		Entry->LastCmd = (Entry->LastCmd & XAIE_SHADOW_TARGET_FLAGS) |
+			CmdIdx;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a register of a target configuration has to be written by
+* a command.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Target: Target configuration.
+* @param	RegOff: Register offset.
+* @param	CmdIdx: Index of the command plus one.
+*
+* @return	XAIE_ENABLE if the command has to write the final value of the
+*		register, or its own value for a register with side effects.
+*		XAIE_DISABLE otherwise.
+*
+* @note		Internal only. Registers whose final value is unknown are
+*		handled by the caller.
+*
+*******************************************************************************/
+static u8 _XAie_ShadowTargetIsDelta(XAie_DevInst *DevInst,
+		struct XAie_ShadowRegs *Target, u64 RegOff, u32 CmdIdx)
+{
+	XAie_ShadowEntry *Entry = _XAie_ShadowFind(Target, RegOff);
+	u32 Cur;
+
+	if(Entry->LastCmd & XAIE_SHADOW_TARGET_VOLATILE) {
+		return XAIE_ENABLE;
+	}
+
+	/* Only the last command writing the register writes it */
+	if(Entry->LastCmd != CmdIdx) {
+		return XAIE_DISABLE;
+	}
+
+	if(_XAie_ShadowLookup(DevInst, RegOff, &Cur) && (Cur == Entry->Value)) {
+		return XAIE_DISABLE;
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the registers of a block which differ from the shadow
+* register cache. Consecutive differing registers are written with one block
+* write.
+*
+* @param	DevInst: Device instance pointer.
+* @param	Target: Target configuration.
+* @param	CmdIdx: Index of the command plus one.
+* @param	RegOff: Offset of the first register.
+* @param	Data: Target values, NULL to set all registers to Value.
+* @param	Value: Target value if Data is NULL.
+* @param	Size: Number of registers.
+* @param	NumWr: Pointer to the number of written registers to update.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_ShadowDeltaBlock(XAie_DevInst *DevInst,
+		struct XAie_ShadowRegs *Target, u32 CmdIdx, u64 RegOff,
+		const u32 *Data, u32 Value, u32 Size, u32 *NumWr)
+{
+	AieRC RC;
+	u32 Start = 0U;
+
+	while(Start < Size) {
+		u32 End;
+
+		while((Start < Size) && !_XAie_ShadowTargetIsDelta(DevInst,
+					Target, RegOff + Start * 4U, CmdIdx)) {
+			Start++;
+		}
+
+		End = Start;
+		while((End < Size) && _XAie_ShadowTargetIsDelta(DevInst,
+					Target, RegOff + End * 4U, CmdIdx)) {
+			End++;
+		}
+
+		if(End == Start) {
+			break;
+		}
+
+		if(End - Start == 1U) {
+			RC = XAie_Write32(DevInst, RegOff + Start * 4U,
+					(Data != NULL) ? Data[Start] : Value);
+		} else if(Data != NULL) {
+			RC = XAie_BlockWrite32(DevInst, RegOff + Start * 4U,
+					&Data[Start], End - Start);
+		} else {
+			RC = XAie_BlockSet32(DevInst, RegOff + Start * 4U,
+					Value, End - Start);
+		}
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		*NumWr += End - Start;
+		Start = End;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API applies a configuration recorded as a transaction, writing only the
+* registers whose final value differs from the shadow register cache. Each
+* register is written once, with its final value, at the position of the last
+* command of the configuration writing it. The writes are submitted as one
+* transaction.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnInst - Exported transaction instance of the configuration.
+*		The instance is not freed and can be applied again.
+* @param	NumWr - Pointer to return the number of written registers. Can
+*		be NULL.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		If the shadow register cache is disabled, all the registers of
+*		the configuration are written. The registers with side effects
+*		are written by every command, as recorded. Masked writes to
+*		registers whose value is not known are kept as masked writes. The calling thread
+*		shall not have a transaction in progress. On failure, the cache
+*		is cleared.
+*
+******************************************************************************/
+AieRC XAie_SubmitTransactionDelta(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 *NumWr)
+{
+	struct XAie_ShadowRegs Target;
+	AieRC RC = XAIE_OK, TxnRC;
+	u64 NumWords = 0U;
+	u32 Bits = XAIE_SHADOW_INIT_BITS;
+	u32 Written = 0U;
+
+	if((DevInst == XAIE_NULL) || (TxnInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(!(TxnInst->Flags & XAIE_TXN_INSTANCE_EXPORTED)) {
+		XAIE_ERROR("Transaction instance was not exported.\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Compute the final value of each register of the configuration */
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		NumWords += (TxnInst->CmdBuf[i].Opcode == XAIE_IO_WRITE) ?
+			1U : TxnInst->CmdBuf[i].Size;
+	}
+	while(((u64)1U << Bits) < NumWords * 2U) {
+		Bits++;
+	}
+
+	RC = _XAie_ShadowAlloc(&Target, Bits);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		const u32 *Data = (const u32 *)(uintptr_t)Cmd->DataPtr;
+
+		if(Cmd->Opcode == XAIE_IO_WRITE) {
+			_XAie_ShadowTargetWr(DevInst, &Target, Cmd->RegOff,
+					Cmd->Mask, Cmd->Value, i + 1U);
+			continue;
+		}
+
+		for(u32 j = 0U; j < Cmd->Size; j++) {
+			_XAie_ShadowTargetWr(DevInst, &Target,
+					Cmd->RegOff + j * 4U, 0U,
+					(Cmd->Opcode == XAIE_IO_BLOCKWRITE) ?
+					Data[j] : Cmd->Value, i + 1U);
+		}
+	}
+
+	RC = _XAie_Txn_Start(DevInst, 0U);
+	if(RC != XAIE_OK) {
+		free(Target.Entries);
+		return RC;
+	}
+
+	for(u32 i = 0U; (i < TxnInst->NumCmds) && (RC == XAIE_OK); i++) {
+		XAie_TxnCmd *Cmd = &TxnInst->CmdBuf[i];
+		XAie_ShadowEntry *Entry;
+
+		switch(Cmd->Opcode) {
+		case XAIE_IO_WRITE:
+			Entry = _XAie_ShadowFind(&Target, Cmd->RegOff);
+			if((Entry->LastCmd & XAIE_SHADOW_TARGET_VOLATILE) &&
+					(Cmd->Mask == 0U)) {
+				RC = XAie_Write32(DevInst, Cmd->RegOff,
+						Cmd->Value);
+				Written++;
+			} else if(Entry->LastCmd & XAIE_SHADOW_TARGET_FLAGS) {
+				RC = XAie_MaskWrite32(DevInst, Cmd->RegOff,
+						Cmd->Mask, Cmd->Value);
+				Written++;
+			} else if(_XAie_ShadowTargetIsDelta(DevInst, &Target,
+						Cmd->RegOff, i + 1U)) {
+				RC = XAie_Write32(DevInst, Cmd->RegOff,
+						Entry->Value);
+				Written++;
+			}
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			RC = _XAie_ShadowDeltaBlock(DevInst, &Target, i + 1U,
+					Cmd->RegOff,
+					(const u32 *)(uintptr_t)Cmd->DataPtr,
+					0U, Cmd->Size, &Written);
+			break;
+		case XAIE_IO_BLOCKSET:
+			RC = _XAie_ShadowDeltaBlock(DevInst, &Target, i + 1U,
+					Cmd->RegOff, NULL, Cmd->Value,
+					Cmd->Size, &Written);
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode\n");
+			RC = XAIE_INVALID_ARGS;
+			break;
+		}
+	}
+
+	free(Target.Entries);
+
+	TxnRC = _XAie_Txn_Submit(DevInst, NULL);
+	if(RC == XAIE_OK) {
+		RC = TxnRC;
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to apply configuration delta\n");
+		_XAie_ShadowInvalidate(DevInst);
+		return RC;
+	}
+
+	XAIE_DBG("Configuration delta: %d registers written\n", Written);
+	if(NumWr != NULL) {
+		*NumWr = Written;
+	}
+
+	return XAIE_OK;
+}
+
+/** @} */
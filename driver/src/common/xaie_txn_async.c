@@ -0,0 +1,507 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn_async.c
+* @{
+*
+* This file contains routines for asynchronous submission of transactions.
+* Transactions are queued to a bounded per device queue and executed in the
+* submission order by a worker thread. The worker is started on the first
+* asynchronous submission and stopped when the device instance is closed.
+*
+* IO operations issued by the driver APIs to the backend wait for all the
+* queued transactions to complete before they are executed. Register reads
+* and polls therefore always observe the effects of the transactions submitted
+* before them. IO operations recorded to the transaction of the calling thread
+* do not wait, so the next transaction can be prepared while the previous one
+* is executed.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "xaie_helper.h"
+
+#ifdef __linux__
+/***************************** Macro Definitions *****************************/
+#define XAIE_TXN_QUEUE_DEPTH	16U
+
+/****************************** Type Definitions *****************************/
+struct XAie_TxnHandle {
+	XAie_TxnInst *TxnInst;		/* Transaction to be executed */
+	XAie_TxnCallback Callback;	/* Completion callback */
+	void *Priv;			/* Private data of the callback */
+	AieRC Status;			/* Execution status */
+	u8 IsDone;			/* Transaction is executed */
+	struct XAie_TxnQueue *Queue;
+	struct XAie_TxnHandle *Next;
+};
+
+struct XAie_TxnQueue {
+	XAie_DevInst *DevInst;
+	pthread_t Worker;		/* Submission worker thread */
+	pthread_mutex_t Lock;		/* Lock for the queue */
+	pthread_cond_t WorkCond;	/* Signaled on submission and stop */
+	pthread_cond_t DoneCond;	/* Signaled on dequeue and completion */
+	XAie_TxnHandle *Head;
+	XAie_TxnHandle *Tail;
+	u32 NumQueued;			/* Transactions waiting for the worker */
+	u32 NumPending;			/* Transactions not completed yet */
+	u8 Stop;			/* Worker stop request */
+};
+
+/************************** Variable Definitions *****************************/
+static pthread_mutex_t _XAie_TxnQueueCreateLock = PTHREAD_MUTEX_INITIALIZER;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the submission worker thread. It executes the queued transactions in
+* order until it is requested to stop and the queue is empty.
+*
+* @param	Arg: Pointer to the transaction queue.
+*
+* @return	NULL.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void *_XAie_TxnQueueWorker(void *Arg)
+{
+	struct XAie_TxnQueue *Queue = (struct XAie_TxnQueue *)Arg;
+	XAie_TxnHandle *Handle;
+	XAie_TxnCallback Callback;
+	void *Priv;
+	AieRC RC;
+
+	pthread_mutex_lock(&Queue->Lock);
+	while(1) {
+		while((Queue->Head == NULL) && (Queue->Stop == 0U)) {
+			pthread_cond_wait(&Queue->WorkCond, &Queue->Lock);
+		}
+
+		if(Queue->Head == NULL) {
+			break;
+		}
+
+		Handle = Queue->Head;
+		Queue->Head = Handle->Next;
+		if(Queue->Head == NULL) {
+			Queue->Tail = NULL;
+		}
+		Queue->NumQueued--;
+		pthread_cond_broadcast(&Queue->DoneCond);
+		pthread_mutex_unlock(&Queue->Lock);
+
+		RC = _XAie_TxnExecute(Queue->DevInst, Handle->TxnInst);
+		Callback = Handle->Callback;
+		Priv = Handle->Priv;
+
+		/*
+		 * A waiter can free the handle once it is marked done, so
+		 * the handle is not accessed afterwards and not passed to
+		 * the callback.
+		 */
+		pthread_mutex_lock(&Queue->Lock);
+		Handle->Status = RC;
+		Handle->IsDone = 1U;
+		Queue->NumPending--;
+		pthread_cond_broadcast(&Queue->DoneCond);
+		pthread_mutex_unlock(&Queue->Lock);
+
+		if(Callback != NULL) {
+			Callback(RC, Priv);
+		}
+
+		pthread_mutex_lock(&Queue->Lock);
+	}
+	pthread_mutex_unlock(&Queue->Lock);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the transaction queue of the device instance. The queue
+* and its worker thread are created if they do not exist.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	Pointer to the transaction queue on success, NULL on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static struct XAie_TxnQueue *_XAie_TxnQueueGet(XAie_DevInst *DevInst)
+{
+	struct XAie_TxnQueue *Queue;
+
+	pthread_mutex_lock(&_XAie_TxnQueueCreateLock);
+	Queue = DevInst->TxnQueue;
+	if(Queue != NULL) {
+		pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+		return Queue;
+	}
+
+	Queue = (struct XAie_TxnQueue *)calloc(1U, sizeof(*Queue));
+	if(Queue == NULL) {
+		XAIE_ERROR("Failed to allocate transaction queue\n");
+		pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+		return NULL;
+	}
+
+	Queue->DevInst = DevInst;
+	pthread_mutex_init(&Queue->Lock, NULL);
+	pthread_cond_init(&Queue->WorkCond, NULL);
+	pthread_cond_init(&Queue->DoneCond, NULL);
+
+	if(pthread_create(&Queue->Worker, NULL, _XAie_TxnQueueWorker,
+				Queue) != 0) {
+		XAIE_ERROR("Failed to create transaction worker thread\n");
+		pthread_cond_destroy(&Queue->DoneCond);
+		pthread_cond_destroy(&Queue->WorkCond);
+		pthread_mutex_destroy(&Queue->Lock);
+		free(Queue);
+		pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+		return NULL;
+	}
+
+	DevInst->TxnQueue = Queue;
+	pthread_mutex_unlock(&_XAie_TxnQueueCreateLock);
+
+	return Queue;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits for all the transactions queued to the device instance to
+* complete.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	None.
+*
+* @note		Internal only. Returns immediately if called from the worker
+*		thread, i.e. from a completion callback.
+*
+*******************************************************************************/
+void _XAie_TxnAsyncDrain(XAie_DevInst *DevInst)
+{
+	struct XAie_TxnQueue *Queue = DevInst->TxnQueue;
+
+	if((Queue == NULL) || pthread_equal(pthread_self(), Queue->Worker)) {
+		return;
+	}
+
+	pthread_mutex_lock(&Queue->Lock);
+	while(Queue->NumPending > 0U) {
+		pthread_cond_wait(&Queue->DoneCond, &Queue->Lock);
+	}
+	pthread_mutex_unlock(&Queue->Lock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function executes the queued transactions, stops the worker thread and
+* releases the transaction queue of the device instance.
+*
+* @param	DevInst: Device instance pointer
+*
+* @return	None.
+*
+* @note		Internal only. Handles of the executed transactions remain
+*		valid until they are freed by the user.
+*
+*******************************************************************************/
+void _XAie_TxnAsyncFinish(XAie_DevInst *DevInst)
+{
+	struct XAie_TxnQueue *Queue = DevInst->TxnQueue;
+
+	if(Queue == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&Queue->Lock);
+	Queue->Stop = 1U;
+	pthread_cond_signal(&Queue->WorkCond);
+	pthread_mutex_unlock(&Queue->Lock);
+
+	pthread_join(Queue->Worker, NULL);
+
+	pthread_cond_destroy(&Queue->DoneCond);
+	pthread_cond_destroy(&Queue->WorkCond);
+	pthread_mutex_destroy(&Queue->Lock);
+	free(Queue);
+	DevInst->TxnQueue = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api queues a transaction for asynchronous execution and returns without
+* waiting for it to be executed. Transactions of a device instance are executed
+* in the submission order by a worker thread. If TxnInst is NULL, the
+* transaction instance of the calling thread is submitted and it is released
+* by the driver after the execution. Otherwise, the exported transaction
+* instance passed by the user is submitted.
+*
+* @param	DevInst - Device instance pointer.
+* @param	TxnInst - Exported transaction instance pointer or NULL.
+* @param	Callback - Completion callback or NULL.
+* @param	Priv - Private data passed to the callback.
+*
+* @return	Completion handle on success, NULL on failure.
+*
+* @note		The api blocks if XAIE_TXN_QUEUE_DEPTH transactions are waiting
+*		to be executed. An exported instance must not be modified or
+*		freed before the transaction completes. The handle must be
+*		released with XAie_FreeTransactionHandle(). The callback is
+*		called from the worker thread after the transaction is marked
+*		completed and must not submit transactions. It receives the
+*		status and Priv only, as the handle may already be freed by a
+*		waiter when it is called.
+*		IO operations issued to the backend after this api wait for
+*		the transaction to complete.
+*
+******************************************************************************/
+XAie_TxnHandle* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnCallback Callback, void *Priv)
+{
+	struct XAie_TxnQueue *Queue;
+	XAie_TxnHandle *Handle;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return NULL;
+	}
+
+	if((TxnInst != NULL) &&
+			!(TxnInst->Flags & XAIE_TXN_INSTANCE_EXPORTED)) {
+		XAIE_ERROR("Transaction instance was not exported.\n");
+		return NULL;
+	}
+
+	Queue = _XAie_TxnQueueGet(DevInst);
+	if(Queue == NULL) {
+		return NULL;
+	}
+
+	Handle = (XAie_TxnHandle *)calloc(1U, sizeof(*Handle));
+	if(Handle == NULL) {
+		XAIE_ERROR("Failed to allocate transaction handle\n");
+		return NULL;
+	}
+
+	if(TxnInst == NULL) {
+		TxnInst = _XAie_TxnDetach(DevInst);
+		if(TxnInst == NULL) {
+			free(Handle);
+			return NULL;
+		}
+	}
+
+	Handle->TxnInst = TxnInst;
+	Handle->Callback = Callback;
+	Handle->Priv = Priv;
+	Handle->Queue = Queue;
+
+	pthread_mutex_lock(&Queue->Lock);
+	while(Queue->NumQueued >= XAIE_TXN_QUEUE_DEPTH) {
+		pthread_cond_wait(&Queue->DoneCond, &Queue->Lock);
+	}
+
+	if(Queue->Tail == NULL) {
+		Queue->Head = Handle;
+	} else {
+		Queue->Tail->Next = Handle;
+	}
+	Queue->Tail = Handle;
+	Queue->NumQueued++;
+	Queue->NumPending++;
+	pthread_cond_signal(&Queue->WorkCond);
+	pthread_mutex_unlock(&Queue->Lock);
+
+	return Handle;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api waits for an asynchronously submitted transaction to complete.
+*
+* @param	Handle - Completion handle of the transaction.
+*
+* @return	Execution status of the transaction.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_WaitTransaction(XAie_TxnHandle *Handle)
+{
+	struct XAie_TxnQueue *Queue;
+	AieRC RC;
+
+	if(Handle == NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Queue = Handle->Queue;
+	pthread_mutex_lock(&Queue->Lock);
+	while(Handle->IsDone == 0U) {
+		pthread_cond_wait(&Queue->DoneCond, &Queue->Lock);
+	}
+	RC = Handle->Status;
+	pthread_mutex_unlock(&Queue->Lock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api checks if an asynchronously submitted transaction is completed.
+*
+* @param	Handle - Completion handle of the transaction.
+* @param	IsDone - Pointer to return 1 if the transaction is completed,
+*			 0 otherwise.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS on invalid arguments.
+*
+* @note		The execution status of a completed transaction is returned by
+*		XAie_WaitTransaction() without blocking.
+*
+******************************************************************************/
+AieRC XAie_PollTransaction(XAie_TxnHandle *Handle, u8 *IsDone)
+{
+	if((Handle == NULL) || (IsDone == NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	pthread_mutex_lock(&Handle->Queue->Lock);
+	*IsDone = Handle->IsDone;
+	pthread_mutex_unlock(&Handle->Queue->Lock);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api waits for an asynchronously submitted transaction to complete and
+* releases its completion handle.
+*
+* @param	Handle - Completion handle of the transaction.
+*
+* @return	Execution status of the transaction.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_FreeTransactionHandle(XAie_TxnHandle *Handle)
+{
+	AieRC RC;
+
+	RC = XAie_WaitTransaction(Handle);
+	if(RC == XAIE_INVALID_ARGS) {
+		return RC;
+	}
+
+	free(Handle);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This api waits for all the transactions submitted asynchronously to the
+* device instance to complete.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS on invalid arguments.
+*
+* @note		The status of the individual transactions is returned by their
+*		completion handles.
+*
+******************************************************************************/
+AieRC XAie_WaitAllTransactions(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_TxnAsyncDrain(DevInst);
+
+	return XAIE_OK;
+}
+
+#else
+
+void _XAie_TxnAsyncDrain(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+void _XAie_TxnAsyncFinish(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+XAie_TxnHandle* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnCallback Callback, void *Priv)
+{
+	(void)DevInst;
+	(void)TxnInst;
+	(void)Callback;
+	(void)Priv;
+	XAIE_ERROR("Asynchronous transactions are not supported\n");
+	return NULL;
+}
+
+AieRC XAie_WaitTransaction(XAie_TxnHandle *Handle)
+{
+	(void)Handle;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_PollTransaction(XAie_TxnHandle *Handle, u8 *IsDone)
+{
+	(void)Handle;
+	(void)IsDone;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_FreeTransactionHandle(XAie_TxnHandle *Handle)
+{
+	(void)Handle;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_WaitAllTransactions(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+#endif /* __linux__ */
+
+/** @} */
@@ -0,0 +1,925 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_context.c
+* @{
+*
+* This file contains routines to save the context of a partition to a host
+* side image and to restore it later, so that several applications can share
+* a partition without a teardown and a reload of their ELFs.
+*
+* The context of a tile consists of its program memory, data memory, DMA
+* buffer descriptors and channel controls, lock values and stream switch
+* configuration. For AIE tiles, the core control, debug control, status and
+* program counter are saved as well. The state of the core register file and
+* of in flight DMA transfers is not accessible through the AXI-MM interface, so
+* the context shall be saved when the cores and DMAs are idle, e.g. when the
+* cores wait on a lock at an iteration boundary.
+*
+* Registers are saved in pages of XAIE_CONTEXT_PAGE_SIZE bytes, each read with
+* a single block read if the backend supports it. Consecutive pages of the same
+* kind are merged into one segment of the image. Pages that read as zero are
+* only recorded by their range and restored with a single block set, without
+* transferring their content.
+*
+* The core register file cannot be restored, so a core is resumed only if its
+* program counter matches the saved one, see XAie_ContextRestore().
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_clock.h"
+#include "xaie_context.h"
+#include "xaie_core.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+
+#ifdef XAIE_FEATURE_CORE_ENABLE
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_CONTEXT_MAGIC		0x58414358U	/* "XCAX" */
+#define XAIE_CONTEXT_PAGE_SIZE		256U
+#define XAIE_CONTEXT_PAGE_WORDS		(XAIE_CONTEXT_PAGE_SIZE / 4U)
+#define XAIE_CONTEXT_INIT_SIZE		(64U * 1024U)
+
+#define XAIE_CONTEXT_SEG_DATA		0U	/* Register values follow */
+#define XAIE_CONTEXT_SEG_ZERO		1U	/* Registers are all zero */
+#define XAIE_CONTEXT_SEG_CORE		2U	/* XAie_ContextCore follows */
+
+/* Passes of the restore over the segments */
+#define XAIE_CONTEXT_PASS_QUIESCE	0U
+#define XAIE_CONTEXT_PASS_REGS		1U
+#define XAIE_CONTEXT_PASS_DMA		2U
+#define XAIE_CONTEXT_PASS_CORE		3U
+#define XAIE_CONTEXT_PASS_MAX		4U
+
+/****************************** Type Definitions *****************************/
+struct XAie_Context {
+	u32 Magic;
+	u8 DevGen;
+	u8 NumRows;
+	u8 NumCols;
+	u8 Reserved;
+	u32 NumSegs;
+	u32 Reserved1;
+	u64 Size;		/* Size of the image, including this header */
+};
+
+/*
+ * Segments follow the header. The payload of a segment, if any, immediately
+ * follows the segment and is a multiple of 4 bytes.
+ */
+typedef struct {
+	u32 RegOff;		/* Offset of the range within the tile */
+	u32 Size;		/* Size of the range in bytes */
+	u8 Col;
+	u8 Row;
+	u8 Type;
+	u8 Reserved;
+} XAie_ContextSeg;
+
+typedef struct {
+	u32 CoreCtrl;
+	u32 DebugCtrl;
+	u32 Status;
+	u32 PC;
+} XAie_ContextCore;
+
+/* Image under construction */
+typedef struct {
+	XAie_Context *Ctx;
+	u64 Capacity;
+	u64 LastSeg;		/* Offset of the last segment, 0 if none */
+	u8 BlockRead;		/* Backend supports block reads */
+} XAie_ContextImage;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API reserves space at the end of the image.
+*
+* @param	Img: Image under construction.
+* @param	Size: Number of bytes to reserve.
+*
+* @return	Pointer to the reserved space, NULL if out of memory.
+*
+* @note		Internal only. The image may be moved.
+*
+******************************************************************************/
+static void *_XAie_ContextReserve(XAie_ContextImage *Img, u64 Size)
+{
+	void *Ptr;
+
+	if(Img->Ctx->Size + Size > Img->Capacity) {
+		XAie_Context *Ctx;
+		u64 Capacity = Img->Capacity * 2U;
+
+		while(Img->Ctx->Size + Size > Capacity) {
+			Capacity *= 2U;
+		}
+
+		Ctx = realloc(Img->Ctx, Capacity);
+		if(Ctx == NULL) {
+			XAIE_ERROR("Failed to grow context image\n");
+			return NULL;
+		}
+
+		Img->Ctx = Ctx;
+		Img->Capacity = Capacity;
+	}
+
+	Ptr = (u8 *)Img->Ctx + Img->Ctx->Size;
+	Img->Ctx->Size += Size;
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API appends a page of registers to the image. The page is merged with
+* the last segment if it has the same type and follows it.
+*
+* @param	Img: Image under construction.
+* @param	Loc: Location of the tile.
+* @param	RegOff: Offset of the page within the tile.
+* @param	Type: XAIE_CONTEXT_SEG_DATA or XAIE_CONTEXT_SEG_ZERO.
+* @param	Data: Register values of a data page.
+* @param	NumWords: Number of registers of the page.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ContextAddPage(XAie_ContextImage *Img, XAie_LocType Loc,
+		u32 RegOff, u8 Type, const u32 *Data, u32 NumWords)
+{
+	XAie_ContextSeg *Seg = NULL;
+	u32 PayloadSize;
+
+	PayloadSize = (Type == XAIE_CONTEXT_SEG_DATA) ? NumWords * 4U : 0U;
+
+	if(Img->LastSeg != 0U) {
+		Seg = (XAie_ContextSeg *)((u8 *)Img->Ctx + Img->LastSeg);
+		if((Seg->Col != Loc.Col) || (Seg->Row != Loc.Row) ||
+				(Seg->Type != Type) ||
+				(Seg->RegOff + Seg->Size != RegOff)) {
+			Seg = NULL;
+		}
+	}
+
+	if(Seg == NULL) {
+		Seg = _XAie_ContextReserve(Img, sizeof(*Seg));
+		if(Seg == NULL) {
+			return XAIE_ERR;
+		}
+
+		Seg->RegOff = RegOff;
+		Seg->Size = 0U;
+		Seg->Col = Loc.Col;
+		Seg->Row = Loc.Row;
+		Seg->Type = Type;
+		Seg->Reserved = 0U;
+		Img->LastSeg = (u64)((u8 *)Seg - (u8 *)Img->Ctx);
+		Img->Ctx->NumSegs++;
+	}
+
+	if(PayloadSize != 0U) {
+		void *Payload = _XAie_ContextReserve(Img, PayloadSize);
+
+		if(Payload == NULL) {
+			return XAIE_ERR;
+		}
+
+		memcpy(Payload, Data, PayloadSize);
+	}
+
+	/* Image may have moved */
+	Seg = (XAie_ContextSeg *)((u8 *)Img->Ctx + Img->LastSeg);
+	Seg->Size += NumWords * 4U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads a range of registers of a tile into the image.
+*
+* @param	DevInst: Device Instance
+* @param	Img: Image under construction.
+* @param	Loc: Location of the tile.
+* @param	RegOff: Offset of the range within the tile.
+* @param	Size: Size of the range in bytes.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Once the backend reports that it cannot read a
+*		block, the registers are read one by one.
+*
+******************************************************************************/
+static AieRC _XAie_ContextSaveRange(XAie_DevInst *DevInst,
+		XAie_ContextImage *Img, XAie_LocType Loc, u32 RegOff, u32 Size)
+{
+	u32 Page[XAIE_CONTEXT_PAGE_WORDS];
+	u64 TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	for(u32 Off = 0U; Off < Size; Off += XAIE_CONTEXT_PAGE_SIZE) {
+		AieRC RC;
+		u32 NumWords, Or = 0U;
+
+		NumWords = (Size - Off) / 4U;
+		if(NumWords > XAIE_CONTEXT_PAGE_WORDS) {
+			NumWords = XAIE_CONTEXT_PAGE_WORDS;
+		}
+
+		if(Img->BlockRead != 0U) {
+			RC = XAie_BlockRead32(DevInst, TileAddr + RegOff + Off,
+					Page, NumWords);
+			if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+				Img->BlockRead = 0U;
+			} else if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		for(u32 i = 0U; i < NumWords; i++) {
+			if(Img->BlockRead == 0U) {
+				RC = XAie_Read32(DevInst, TileAddr + RegOff +
+						Off + i * 4U, &Page[i]);
+				if(RC != XAIE_OK) {
+					return RC;
+				}
+			}
+			Or |= Page[i];
+		}
+
+		RC = _XAie_ContextAddPage(Img, Loc, RegOff + Off,
+				(Or == 0U) ? XAIE_CONTEXT_SEG_ZERO :
+				XAIE_CONTEXT_SEG_DATA, Page, NumWords);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API quiesces the core of an AIE tile and saves its control and status
+* registers into the image.
+*
+* @param	DevInst: Device Instance
+* @param	Img: Image under construction.
+* @param	Loc: Location of the AIE tile.
+* @param	CoreMod: Core module of the tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The control registers are read before the core
+*		is halted, so that the restore resumes the core in the same
+*		state.
+*
+******************************************************************************/
+static AieRC _XAie_ContextSaveCore(XAie_DevInst *DevInst,
+		XAie_ContextImage *Img, XAie_LocType Loc,
+		const XAie_CoreMod *CoreMod)
+{
+	AieRC RC;
+	XAie_ContextSeg *Seg;
+	XAie_ContextCore Core;
+	u64 TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	RC = XAie_Read32(DevInst, TileAddr + CoreMod->CoreCtrl->RegOff,
+			&Core.CoreCtrl);
+	RC |= XAie_Read32(DevInst, TileAddr + CoreMod->CoreDebug->RegOff,
+			&Core.DebugCtrl);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to read core control registers\n");
+		return XAIE_ERR;
+	}
+
+	RC = XAie_CoreDebugHalt(DevInst, Loc);
+	RC |= XAie_CoreDisable(DevInst, Loc);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to quiesce core\n");
+		return XAIE_ERR;
+	}
+
+	RC = XAie_Read32(DevInst, TileAddr + CoreMod->CoreSts->RegOff,
+			&Core.Status);
+	RC |= XAie_Read32(DevInst, TileAddr + CoreMod->CorePCOff, &Core.PC);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to read core status registers\n");
+		return XAIE_ERR;
+	}
+
+	Seg = _XAie_ContextReserve(Img, sizeof(*Seg) + sizeof(Core));
+	if(Seg == NULL) {
+		return XAIE_ERR;
+	}
+
+	Seg->RegOff = 0U;
+	Seg->Size = sizeof(Core);
+	Seg->Col = Loc.Col;
+	Seg->Row = Loc.Row;
+	Seg->Type = XAIE_CONTEXT_SEG_CORE;
+	Seg->Reserved = 0U;
+	memcpy(Seg + 1, &Core, sizeof(Core));
+	Img->Ctx->NumSegs++;
+	/* Core segments are never merged */
+	Img->LastSeg = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves the stream switch configuration of a tile into the image.
+*
+* @param	DevInst: Device Instance
+* @param	Img: Image under construction.
+* @param	Loc: Location of the tile.
+* @param	StrmMod: Stream switch module of the tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ContextSaveStrmSw(XAie_DevInst *DevInst,
+		XAie_ContextImage *Img, XAie_LocType Loc,
+		const XAie_StrmMod *StrmMod)
+{
+	AieRC RC;
+	u32 SlotBase = ~0U;
+
+	RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+			StrmMod->MstrConfigBaseAddr,
+			(StrmMod->MaxMasterPhyPortId + 1U) *
+			StrmMod->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+			StrmMod->SlvConfigBaseAddr,
+			(StrmMod->MaxSlavePhyPortId + 1U) *
+			StrmMod->PortOffset);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Slot registers of all slave ports are contiguous */
+	for(u8 i = 0U; i < SS_PORT_TYPE_MAX; i++) {
+		if((StrmMod->SlvSlotConfig[i].NumPorts != 0U) &&
+				(StrmMod->SlvSlotConfig[i].PortBaseAddr <
+				 SlotBase)) {
+			SlotBase = StrmMod->SlvSlotConfig[i].PortBaseAddr;
+		}
+	}
+
+	if(SlotBase == ~0U) {
+		return XAIE_OK;
+	}
+
+	return _XAie_ContextSaveRange(DevInst, Img, Loc, SlotBase,
+			(StrmMod->MaxSlavePhyPortId + 1U) *
+			StrmMod->SlotOffsetPerPort);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves the context of a tile into the image.
+*
+* @param	DevInst: Device Instance
+* @param	Img: Image under construction.
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ContextSaveTile(XAie_DevInst *DevInst,
+		XAie_ContextImage *Img, XAie_LocType Loc)
+{
+	AieRC RC;
+	u8 TileType;
+	const XAie_TileMod *TileMod;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	TileMod = &_XAie_GetDevMod(DevInst)[TileType];
+
+	/* Quiesce the core before anything else is read */
+	if((TileType == XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileMod->CoreMod != NULL)) {
+		const XAie_CoreMod *CoreMod = TileMod->CoreMod;
+
+		RC = _XAie_ContextSaveCore(DevInst, Img, Loc, CoreMod);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+				CoreMod->ProgMemHostOffset,
+				CoreMod->ProgMemSize);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(TileMod->MemMod != NULL) {
+		RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+				TileMod->MemMod->MemAddr,
+				TileMod->MemMod->Size);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	if(TileMod->DmaMod != NULL) {
+		const XAie_DmaMod *DmaMod = TileMod->DmaMod;
+
+		RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+				DmaMod->BaseAddr,
+				DmaMod->NumBds * DmaMod->IdxOffset);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		/*
+		 * Only the channel controls are saved. Start queues are not
+		 * replayed, as pushing a BD starts a new transfer.
+		 */
+		for(u8 Ch = 0U; Ch < DmaMod->NumChannels * 2U; Ch++) {
+			RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+					DmaMod->ChCtrlBase +
+					Ch * DmaMod->ChIdxOffset, 4U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	/* Lock values can only be set on devices with lock value registers */
+	if((TileMod->LockMod != NULL) &&
+			(TileMod->LockMod->LockSetValBase != 0U)) {
+		const XAie_LockMod *LockMod = TileMod->LockMod;
+
+		for(u8 Lock = 0U; Lock < LockMod->NumLocks; Lock++) {
+			RC = _XAie_ContextSaveRange(DevInst, Img, Loc,
+					LockMod->LockSetValBase +
+					Lock * LockMod->LockSetValOff, 4U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+
+	if(TileMod->StrmSw != NULL) {
+		RC = _XAie_ContextSaveStrmSw(DevInst, Img, Loc,
+				TileMod->StrmSw);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API saves the context of all the tiles in use in the partition into a
+* host side image. The cores of the partition are debug halted and disabled
+* and stay quiesced when the API returns. The context can be resumed with
+* XAie_ContextRestore().
+*
+* @param	DevInst - Device Instance.
+* @param	Ctx - Pointer to return the context. It shall be freed with
+*		XAie_ContextFree().
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The context shall be saved when the cores and DMAs of the
+*		partition are idle, see the description of this file. Tiles
+*		which are not requested are skipped.
+*
+******************************************************************************/
+AieRC XAie_ContextSave(XAie_DevInst *DevInst, XAie_Context **Ctx)
+{
+	XAie_ContextImage Img;
+
+	if((DevInst == XAIE_NULL) || (Ctx == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Img.Ctx = malloc(XAIE_CONTEXT_INIT_SIZE);
+	if(Img.Ctx == NULL) {
+		XAIE_ERROR("Failed to allocate context image\n");
+		return XAIE_ERR;
+	}
+
+	Img.Capacity = XAIE_CONTEXT_INIT_SIZE;
+	Img.LastSeg = 0U;
+	Img.BlockRead = 1U;
+	memset(Img.Ctx, 0, sizeof(*Img.Ctx));
+	Img.Ctx->Magic = XAIE_CONTEXT_MAGIC;
+	Img.Ctx->DevGen = DevInst->DevProp.DevGen;
+	Img.Ctx->NumRows = DevInst->NumRows;
+	Img.Ctx->NumCols = DevInst->NumCols;
+	Img.Ctx->Size = sizeof(*Img.Ctx);
+
+	for(u8 Col = 0U; Col < DevInst->NumCols; Col++) {
+		for(u8 Row = 0U; Row < DevInst->NumRows; Row++) {
+			AieRC RC;
+			XAie_LocType Loc = XAie_TileLoc(Col, Row);
+
+			if(_XAie_PmIsTileRequested(DevInst, Loc) ==
+					XAIE_DISABLE) {
+				continue;
+			}
+
+			RC = _XAie_ContextSaveTile(DevInst, &Img, Loc);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to save context of tile (%u, %u)\n",
+						Col, Row);
+				free(Img.Ctx);
+				return RC;
+			}
+		}
+	}
+
+	XAIE_DBG("Saved context of %u segments, %llu bytes\n",
+			Img.Ctx->NumSegs, (unsigned long long)Img.Ctx->Size);
+	*Ctx = Img.Ctx;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates a context image against the device instance.
+*
+* @param	DevInst: Device Instance
+* @param	Ctx: Context image.
+*
+* @return	XAIE_OK if the context can be restored, error code otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_ContextValidate(XAie_DevInst *DevInst,
+		const XAie_Context *Ctx)
+{
+	const u8 *Ptr = (const u8 *)(Ctx + 1);
+	const u8 *End = (const u8 *)Ctx + Ctx->Size;
+
+	if((Ctx->Magic != XAIE_CONTEXT_MAGIC) ||
+			(Ctx->DevGen != DevInst->DevProp.DevGen) ||
+			(Ctx->NumRows != DevInst->NumRows) ||
+			(Ctx->NumCols != DevInst->NumCols)) {
+		XAIE_ERROR("Context does not match the partition\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < Ctx->NumSegs; i++) {
+		const XAie_ContextSeg *Seg = (const XAie_ContextSeg *)Ptr;
+
+		if((Ptr + sizeof(*Seg) > End) ||
+				(Seg->Type > XAIE_CONTEXT_SEG_CORE) ||
+				((Seg->Size & 0x3U) != 0U) ||
+				(Seg->Col >= Ctx->NumCols) ||
+				(Seg->Row >= Ctx->NumRows)) {
+			break;
+		}
+
+		Ptr += sizeof(*Seg);
+		if(Seg->Type != XAIE_CONTEXT_SEG_ZERO) {
+			Ptr += Seg->Size;
+		}
+	}
+
+	if(Ptr != End) {
+		XAIE_ERROR("Invalid context image\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the DMA channel control registers covered by a segment.
+*
+* @param	DevInst: Device Instance
+* @param	Seg: Segment of the context.
+* @param	Pass: XAIE_CONTEXT_PASS_QUIESCE to disable and reset the
+*		channels, XAIE_CONTEXT_PASS_REGS to write the registers of the
+*		segment with the channels kept disabled and reset, or
+*		XAIE_CONTEXT_PASS_DMA to write the saved channel controls.
+* @param	Covered: Returns 1 if the segment covers a channel control
+*		register, 0 otherwise.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Nothing is written if the segment does not
+*		cover a channel control register, the caller then writes the
+*		segment in the XAIE_CONTEXT_PASS_REGS pass.
+*
+******************************************************************************/
+static AieRC _XAie_ContextWriteChCtrl(XAie_DevInst *DevInst,
+		const XAie_ContextSeg *Seg, u8 Pass, u8 *Covered)
+{
+	AieRC RC = XAIE_OK;
+	const u32 *Data = (const u32 *)(Seg + 1);
+	XAie_LocType Loc = XAie_TileLoc(Seg->Col, Seg->Row);
+	const XAie_DmaMod *DmaMod;
+	u64 TileAddr;
+	u32 Start, End, Mask, Reset;
+	u8 TileType;
+
+	*Covered = 0U;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
+	if((DmaMod == NULL) || (DmaMod->ChProp == NULL)) {
+		return XAIE_OK;
+	}
+
+	Start = DmaMod->ChCtrlBase;
+	End = Start + DmaMod->NumChannels * 2U * DmaMod->ChIdxOffset;
+	if((Seg->RegOff >= End) || (Seg->RegOff + Seg->Size <= Start)) {
+		return XAIE_OK;
+	}
+
+	*Covered = 1U;
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	Mask = DmaMod->ChProp->Enable.Mask | DmaMod->ChProp->Reset.Mask;
+	Reset = DmaMod->ChProp->Reset.Mask;
+
+	for(u32 Off = Seg->RegOff; (Off < Seg->RegOff + Seg->Size) &&
+			(RC == XAIE_OK); Off += 4U) {
+		u32 Val = 0U;
+		u8 IsChCtrl;
+
+		IsChCtrl = (Off >= Start) && (Off < End) &&
+			(((Off - Start) % DmaMod->ChIdxOffset) == 0U);
+		if(Seg->Type == XAIE_CONTEXT_SEG_DATA) {
+			Val = Data[(Off - Seg->RegOff) / 4U];
+		}
+
+		if(Pass == XAIE_CONTEXT_PASS_QUIESCE) {
+			if((IsChCtrl != 0U) && (Mask != 0U)) {
+				RC = XAie_MaskWrite32(DevInst, TileAddr + Off,
+						Mask, Reset);
+			}
+		} else if(Pass == XAIE_CONTEXT_PASS_REGS) {
+			if(IsChCtrl != 0U) {
+				Val = (Val & ~Mask) | Reset;
+			}
+			RC = XAie_Write32(DevInst, TileAddr + Off, Val);
+		} else if(IsChCtrl != 0U) {
+			RC = XAie_Write32(DevInst, TileAddr + Off, Val);
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resumes the core of an AIE tile from its saved control registers.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+* @param	Core: Saved core registers.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the core cannot be resumed.
+*
+* @note		Internal only. The register file of the core is not
+*		accessible, so a core that was enabled and not done is resumed
+*		only if its program counter is the saved one. A core saved at
+*		program counter 0 is reset to get there. Otherwise, the core
+*		is left halted and disabled.
+*
+******************************************************************************/
+static AieRC _XAie_ContextResumeCore(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_ContextCore *Core)
+{
+	AieRC RC;
+	const XAie_CoreMod *CoreMod;
+	u64 TileAddr;
+	u32 PC;
+
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+
+	if(((Core->CoreCtrl & CoreMod->CoreCtrl->CtrlEn.Mask) != 0U) &&
+			((Core->Status & CoreMod->CoreSts->Done.Mask) == 0U)) {
+		RC = XAie_Read32(DevInst, TileAddr + CoreMod->CorePCOff, &PC);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		if((PC != Core->PC) && (Core->PC == 0U)) {
+			RC = XAie_CoreReset(DevInst, Loc);
+			RC |= XAie_CoreUnreset(DevInst, Loc);
+			RC |= XAie_Read32(DevInst, TileAddr +
+					CoreMod->CorePCOff, &PC);
+			if(RC != XAIE_OK) {
+				return XAIE_ERR;
+			}
+		}
+
+		if(PC != Core->PC) {
+			XAIE_ERROR("Core of tile (%u, %u) is at PC 0x%x, "
+					"saved at 0x%x, cannot resume\n",
+					Loc.Col, Loc.Row, PC, Core->PC);
+			return XAIE_ERR;
+		}
+	}
+
+	RC = XAie_Write32(DevInst, TileAddr + CoreMod->CoreDebug->RegOff,
+			Core->DebugCtrl);
+	RC |= XAie_Write32(DevInst, TileAddr + CoreMod->CoreCtrl->RegOff,
+			Core->CoreCtrl);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores a context saved with XAie_ContextSave(). The restore is
+* done in passes over the segments of the image:
+*	- The cores of the saved tiles are debug halted and disabled, and the
+*	  saved DMA channels are disabled and held in reset.
+*	- The registers are written back with block writes, the ranges which
+*	  were zero are cleared with block sets without transferring data. The
+*	  channel controls are written with the channels still disabled and
+*	  reset, so that no channel runs on partially written BDs.
+*	- The saved channel controls are written.
+*	- The core control registers are restored, which resumes the cores that
+*	  were running when the context was saved.
+*
+* @param	DevInst - Device Instance.
+* @param	Ctx - Context to restore.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The context can be restored to any partition of the same
+*		device generation and size. The tiles of the context shall be
+*		requested. The writes may be recorded in a transaction.
+*		The core register file is not part of the context. A running
+*		core is resumed only if its program counter is the saved one,
+*		or if it was saved at program counter 0, in which case it is
+*		reset. The other cores are left halted and disabled and the
+*		API returns XAIE_ERR once all the tiles are restored. The
+*		channels of SHIM DMAs without a reset control are only
+*		disabled, if the device has an enable control.
+*
+******************************************************************************/
+AieRC XAie_ContextRestore(XAie_DevInst *DevInst, const XAie_Context *Ctx)
+{
+	AieRC RC, Ret = XAIE_OK;
+	const u8 *Ptr;
+
+	if((DevInst == XAIE_NULL) || (Ctx == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_ContextValidate(DevInst, Ctx);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* The tile memories no longer hold the images loaded by the loader */
+	_XAie_ElfLoadRecsInvalidate(DevInst);
+
+	for(u8 Pass = 0U; Pass < XAIE_CONTEXT_PASS_MAX; Pass++) {
+		Ptr = (const u8 *)(Ctx + 1);
+
+		for(u32 i = 0U; i < Ctx->NumSegs; i++) {
+			const XAie_ContextSeg *Seg = (const XAie_ContextSeg *)Ptr;
+			const u32 *Data = (const u32 *)(Seg + 1);
+			XAie_LocType Loc = XAie_TileLoc(Seg->Col, Seg->Row);
+			u64 RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row,
+					Loc.Col) + Seg->RegOff;
+			u8 Covered;
+
+			RC = XAIE_OK;
+			Ptr += sizeof(*Seg);
+			if(Seg->Type != XAIE_CONTEXT_SEG_ZERO) {
+				Ptr += Seg->Size;
+			}
+
+			if(Seg->Type == XAIE_CONTEXT_SEG_CORE) {
+				if(Pass == XAIE_CONTEXT_PASS_QUIESCE) {
+					RC = XAie_CoreDebugHalt(DevInst, Loc);
+					RC |= XAie_CoreDisable(DevInst, Loc);
+				} else if(Pass == XAIE_CONTEXT_PASS_CORE) {
+					XAie_ContextCore Core;
+
+					memcpy(&Core, Data, sizeof(Core));
+					if(_XAie_ContextResumeCore(DevInst,
+							Loc, &Core) != XAIE_OK) {
+						Ret = XAIE_ERR;
+					}
+				}
+			} else if(Pass != XAIE_CONTEXT_PASS_CORE) {
+				RC = _XAie_ContextWriteChCtrl(DevInst, Seg,
+						Pass, &Covered);
+				if((RC == XAIE_OK) && (Covered == 0U) &&
+						(Pass == XAIE_CONTEXT_PASS_REGS)) {
+					if(Seg->Type == XAIE_CONTEXT_SEG_DATA) {
+						RC = XAie_BlockWrite32(DevInst,
+								RegAddr, Data,
+								Seg->Size / 4U);
+					} else {
+						RC = XAie_BlockSet32(DevInst,
+								RegAddr, 0U,
+								Seg->Size / 4U);
+					}
+				}
+			}
+
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to restore context of tile (%u, %u)\n",
+						Loc.Col, Loc.Row);
+				return XAIE_ERR;
+			}
+		}
+	}
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the size of a saved context.
+*
+* @param	Ctx - Context.
+*
+* @return	Size of the context in bytes, 0 if Ctx is NULL.
+*
+* @note		None.
+*
+******************************************************************************/
+u64 XAie_ContextGetSize(const XAie_Context *Ctx)
+{
+	if(Ctx == NULL) {
+		return 0U;
+	}
+
+	return Ctx->Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a context returned by XAie_ContextSave().
+*
+* @param	Ctx - Context.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_ContextFree(XAie_Context *Ctx)
+{
+	if(Ctx == NULL) {
+		XAIE_ERROR("Invalid context\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Ctx);
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_CORE_ENABLE */
+/** @} */
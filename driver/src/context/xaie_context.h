@@ -0,0 +1,37 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_context.h
+* @{
+*
+* Header file for partition context save and restore.
+*
+******************************************************************************/
+#ifndef XAIECONTEXT_H
+#define XAIECONTEXT_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * Saved context of a partition. The context is a single contiguous buffer of
+ * XAie_ContextGetSize() bytes, it can be copied as is and restored later from
+ * the copy.
+ */
+typedef struct XAie_Context XAie_Context;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_ContextSave(XAie_DevInst *DevInst, XAie_Context **Ctx);
+AieRC XAie_ContextRestore(XAie_DevInst *DevInst, const XAie_Context *Ctx);
+u64 XAie_ContextGetSize(const XAie_Context *Ctx);
+AieRC XAie_ContextFree(XAie_Context *Ctx);
+
+#endif		/* end of protection macro */
+
+/** @} */
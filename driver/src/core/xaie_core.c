@@ -33,6 +33,7 @@
 /***************************** Include Files *********************************/
 #include "xaie_core.h"
 #include "xaie_events.h"
+#include "xaie_events_internal.h"
 #include "xaie_feature_config.h"
 
 #ifdef XAIE_FEATURE_CORE_ENABLE
@@ -986,6 +987,143 @@ AieRC XAie_CoreProcessorBusDisable(XAie_DevInst *DevInst, XAie_LocType Loc)
 	return _XAie_CoreProcessorBusConfig(DevInst, Loc, XAIE_DISABLE);
 }
 
+#ifdef XAIE_FEATURE_EVENTS_ENABLE
+/*****************************************************************************/
+/**
+*
+* This API checks if the core module of a tile is reached by a partition wide
+* broadcast network.
+*
+* @param	Net: Broadcast network.
+* @param	Loc: Location of the aie tile.
+*
+* @return	XAIE_OK if the core module is part of the network,
+*		XAIE_INVALID_ARGS otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_GraphCheckRsc(const XAie_BcastNetwork *Net,
+		XAie_LocType Loc)
+{
+	for(u32 i = 0; i < Net->NumRscs; i++) {
+		if((Net->Rscs[i].Loc.Col == Loc.Col) &&
+				(Net->Rscs[i].Loc.Row == Loc.Row) &&
+				(Net->Rscs[i].Mod == XAIE_CORE_MOD)) {
+			return XAIE_OK;
+		}
+	}
+
+	XAIE_ERROR("Tile(%d, %d) is not reachable by launch broadcast\n",
+			Loc.Col, Loc.Row);
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts a set of cores from a single broadcast event. A partition
+* wide broadcast channel is reserved, the enable event of every core is set to
+* the broadcast event of the channel and the event is generated from the shim
+* tile of the first column. The arming of the cores and the generation of the
+* event are submitted as a single transaction.
+*
+* The broadcast event reaches the cores of a column in the same cycle relative
+* to the column, with a fixed skew of a few cycles between columns. The start
+* of the cores is therefore deterministic, whereas with XAie_CoreEnable() the
+* first core starts long before the last one of a large graph.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array of aie tile locations.
+* @param	NumLocs: Number of locations.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The cores shall be loaded and out of reset. The enable events
+*		of the cores are cleared and the broadcast channel is released
+*		when the API returns. Shall not be called while a transaction
+*		is started by the calling thread.
+*
+******************************************************************************/
+AieRC XAie_GraphLaunch(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs)
+{
+	AieRC RC, TxnRC;
+	u8 TileType;
+	XAie_Events BcastEvent;
+	XAie_BcastNetwork Net;
+
+	if((DevInst == XAIE_NULL) || (Locs == XAIE_NULL) || (NumLocs == 0U) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0; i < NumLocs; i++) {
+		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Locs[i]);
+		if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	RC = _XAie_EventBcastNetworkSetup(DevInst, &Net);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to setup broadcast for graph launch\n");
+		return RC;
+	}
+
+	for(u32 i = 0; i < NumLocs; i++) {
+		RC = _XAie_GraphCheckRsc(&Net, Locs[i]);
+		if(RC != XAIE_OK) {
+			_XAie_EventBcastNetworkTeardown(DevInst, &Net);
+			return RC;
+		}
+	}
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		_XAie_EventBcastNetworkTeardown(DevInst, &Net);
+		return RC;
+	}
+
+	for(u32 i = 0; i < NumLocs; i++) {
+		BcastEvent = _XAie_EventGetBroadcastEvent(DevInst, Locs[i],
+				XAIE_CORE_MOD, Net.BcastChannelId);
+		RC = XAie_CoreConfigureEnableEvent(DevInst, Locs[i],
+				BcastEvent);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to arm core enable event\n");
+			break;
+		}
+	}
+
+	if(RC == XAIE_OK) {
+		RC = XAie_EventGenerate(DevInst, XAie_TileLoc(0, 0),
+				XAIE_PL_MOD, Net.ShimBcastEvent);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to trigger event\n");
+		}
+	}
+
+	TxnRC = XAie_SubmitTransaction(DevInst, NULL);
+	if(RC == XAIE_OK) {
+		RC = TxnRC;
+	}
+
+	/* Disarm the cores before the channel can be reused */
+	for(u32 i = 0; i < NumLocs; i++) {
+		XAie_CoreConfigureEnableEvent(DevInst, Locs[i],
+				XAIE_EVENT_NONE_CORE);
+	}
+
+	_XAie_EventBcastNetworkTeardown(DevInst, &Net);
+
+	return RC;
+}
+
+#endif /* XAIE_FEATURE_EVENTS_ENABLE */
 #endif /* XAIE_FEATURE_CORE_ENABLE */
 
 /** @} */
@@ -89,6 +89,8 @@ AieRC XAie_ClearCoreDisableEventOccurred(XAie_DevInst *DevInst,
 		XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusEnable(XAie_DevInst *DevInst, XAie_LocType Loc);
 AieRC XAie_CoreProcessorBusDisable(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC XAie_GraphLaunch(XAie_DevInst *DevInst, const XAie_LocType *Locs,
+		u32 NumLocs);
 
 #endif		/* end of protection macro */
 /** @} */
@@ -29,7 +29,20 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif /* __linux__ */
+
 #include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -43,7 +56,102 @@
 #define XAIESIM_CMDIO_CMD_SETSTACK       0U
 #define XAIESIM_CMDIO_CMD_LOADSYM        1U
 
+#define XAIE_ELF_HASH_INIT		0xcbf29ce484222325ULL
+#define XAIE_ELF_HASH_PRIME		0x100000001b3ULL
+#define XAIE_ELF_CACHE_MAX_PLANS	32U
+#define XAIE_ELF_PAGE_SIZE		512U
+
+#define XAIE_ELF_SEG_PROGMEM		0U
+#define XAIE_ELF_SEG_DATAMEM		1U
+#define XAIE_ELF_SEG_BSS		2U
+
+/****************************** Type Definitions *****************************/
+/*
+ * Segment of an elf load plan. Program memory segments are zero padded to the
+ * next 32-bit word, data memory and .bss segments never cross a data memory
+ * boundary.
+ */
+typedef struct {
+	u8 Type;		/* XAIE_ELF_SEG_* */
+	u32 Addr;		/* Address from the core's perspective */
+	u32 Size;		/* Size in bytes */
+	u32 DataOff;		/* Offset of the content in the plan blob */
+} XAie_ElfSeg;
+
+/*
+ * Pre-parsed and validated elf, ready to be written to any AIE tile of a
+ * device of the same generation. The hash only selects the candidates in the
+ * cache, plans are matched by the raw bytes they were built from.
+ */
+typedef struct XAie_ElfPlan {
+	struct XAie_ElfPlan *Next;
+	u64 Hash;		/* Hash of the headers and PT_LOAD contents */
+	u32 KeySize;
+	unsigned char *Key;	/* Headers and PT_LOAD contents */
+	u8 DevGen;		/* Device generation the plan is validated for */
+	u8 IsSection;		/* Single section, without page hashes */
+	u32 RefCount;		/* Number of loads and load records using it */
+	u64 LastUse;
+	u32 NumSegs;
+	u32 MaxSegs;
+	XAie_ElfSeg *Segs;
+	u32 BlobSize;
+	u32 BlobCap;
+	unsigned char *Blob;	/* Content of the segments */
+	u32 NumPages;
+	u64 *PageHashes;	/* Hash of each page of the image */
+} XAie_ElfPlan;
+
+typedef struct {
+	XAie_ElfPlan *Plans;
+	u64 UseCount;
+} XAie_ElfCache;
+
+/*
+ * Raw bytes a load plan is built from, either the program headers and PT_LOAD
+ * contents of an elf or the header and content of a single section.
+ */
+typedef struct {
+	u64 Hash;
+	u8 DevGen;
+	const unsigned char *ElfMem;	/* Elf, NULL for a single section */
+	const Elf32_Phdr *Phdr;		/* Header of the single section */
+	const unsigned char *SectionPtr;
+} XAie_ElfKey;
+
+/* Record of the image last loaded to an AIE tile */
+typedef struct {
+	u8 PageDiff;		/* Loaded with XAIE_ELF_LOAD_PAGE_DIFF */
+	XAie_ElfPlan *Plan;	/* Referenced plan, NULL if unknown */
+} XAie_ElfLoadRec;
+
+struct XAie_ElfLoadRecs {
+	u32 NumRecs;
+	XAie_ElfLoadRec Recs[];	/* Column major, AIE tiles only */
+};
+typedef struct XAie_ElfLoadRecs XAie_ElfLoadRecs;
+
+/************************** Variable Definitions *****************************/
+static XAie_ElfCache ElfCache;
+#ifdef __linux__
+static pthread_mutex_t ElfCacheLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /************************** Function Definitions *****************************/
+static inline void _XAie_ElfCacheLock(void)
+{
+#ifdef __linux__
+	pthread_mutex_lock(&ElfCacheLock);
+#endif
+}
+
+static inline void _XAie_ElfCacheUnlock(void)
+{
+#ifdef __linux__
+	pthread_mutex_unlock(&ElfCacheLock);
+#endif
+}
+
 /*****************************************************************************/
 /**
 *
@@ -128,7 +236,7 @@ static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 	u8 TileType;
 	const XAie_CoreMod *CoreMod;
 
-	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
 
 	/*
 	 * Find the cardinal direction and get tile address.
@@ -187,7 +295,7 @@ static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type for address\n");
 		return XAIE_ERR;
@@ -202,56 +310,149 @@ static AieRC _XAie_GetTargetTileLoc(XAie_DevInst *DevInst, XAie_LocType Loc,
 /*****************************************************************************/
 /**
 *
-* This routine is used to write to the specified program section by reading the
-* corresponding data from the ELF buffer.
+* This function computes the FNV-1a hash of a buffer.
+*
+* @param	Hash: Hash of the previous buffers, XAIE_ELF_HASH_INIT for the
+*		first one.
+* @param	Data: Pointer to the buffer.
+* @param	Size: Size of the buffer in bytes.
+*
+* @return	Updated hash.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u64 _XAie_ElfHash(u64 Hash, const void *Data, u64 Size)
+{
+	const unsigned char *Ptr = Data;
+
+	for(u64 i = 0U; i < Size; i++) {
+		Hash ^= Ptr[i];
+		Hash *= XAIE_ELF_HASH_PRIME;
+	}
+
+	return Hash;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates space for a segment and its content in a load plan
+* under construction.
+*
+* @param	Plan: Load plan.
+* @param	Type: Type of the segment.
+* @param	Addr: Address of the segment from the core's perspective.
+* @param	Size: Size of the segment in bytes.
+* @param	DataSize: Size of the content to reserve in bytes, rounded up
+*		to a multiple of 4 bytes.
+*
+* @return	Pointer to the segment, NULL on failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static XAie_ElfSeg *_XAie_ElfPlanAddSeg(XAie_ElfPlan *Plan, u8 Type, u32 Addr,
+		u32 Size, u32 DataSize)
+{
+	XAie_ElfSeg *Seg;
+
+	if(Plan->NumSegs == Plan->MaxSegs) {
+		u32 MaxSegs = (Plan->MaxSegs == 0U) ? 8U : Plan->MaxSegs * 2U;
+
+		Seg = realloc(Plan->Segs, MaxSegs * sizeof(*Seg));
+		if(Seg == NULL) {
+			return NULL;
+		}
+
+		Plan->Segs = Seg;
+		Plan->MaxSegs = MaxSegs;
+	}
+
+	DataSize = (DataSize + 4U - 1U) & ~(4U - 1U);
+	if(Plan->BlobSize + DataSize > Plan->BlobCap) {
+		u32 BlobCap = (Plan->BlobCap == 0U) ? 4096U : Plan->BlobCap;
+		unsigned char *Blob;
+
+		while(Plan->BlobSize + DataSize > BlobCap) {
+			BlobCap *= 2U;
+		}
+
+		Blob = realloc(Plan->Blob, BlobCap);
+		if(Blob == NULL) {
+			return NULL;
+		}
+
+		Plan->Blob = Blob;
+		Plan->BlobCap = BlobCap;
+	}
+
+	Seg = &Plan->Segs[Plan->NumSegs++];
+	Seg->Type = Type;
+	Seg->Addr = Addr;
+	Seg->Size = Size;
+	Seg->DataOff = Plan->BlobSize;
+	Plan->BlobSize += DataSize;
+
+	return Seg;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine validates a program section and appends it to a load plan. Data
+* memory sections are split at the data memory boundaries, so that each segment
+* of the plan targets a single tile.
 *
 * @param	DevInst: Device Instance.
-* @param	Loc: Starting location of the section.
+* @param	Plan: Load plan under construction.
 * @param	ProgSec: Poiner to the program section entry in the ELF buffer.
-* @param	ElfPtr: Pointer to the program header.
+* @param	Phdr: Pointer to the program header.
 *
 * @return	XAIE_OK on success and error code for failure.
 *
 * @note		Internal API only.
 *
 *******************************************************************************/
-static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
-		const unsigned char *ProgSec, const Elf32_Phdr *Phdr)
+static AieRC _XAie_ElfPlanAddSection(XAie_DevInst *DevInst,
+		XAie_ElfPlan *Plan, const unsigned char *ProgSec,
+		const Elf32_Phdr *Phdr)
 {
-	AieRC RC;
-	u32 OverFlowBytes;
-	u32 BytesToWrite;
 	u32 SectionAddr;
 	u32 SectionSize;
 	u32 AddrMask;
-	u64 Addr;
-	XAie_LocType TgtLoc;
+	XAie_ElfSeg *Seg;
 	const XAie_CoreMod *CoreMod;
 
-	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
 
-	/* Write to Program Memory */
+	/* Program memory section */
 	if(Phdr->p_paddr < CoreMod->ProgMemSize) {
 		if((Phdr->p_paddr + Phdr->p_memsz) > CoreMod->ProgMemSize) {
 			XAIE_ERROR("Overflow of program memory\n");
 			return XAIE_INVALID_ELF;
 		}
 
-		Addr = CoreMod->ProgMemHostOffset + Phdr->p_paddr +
-			_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
-
 		/*
 		 * The program memory sections in the elf can end at 32bit
-		 * unaligned addresses. To factor this, we round up the number
-		 * of 32-bit words that has to be written to the program
-		 * memory. Since the elf has footers at the end, accessing
-		 * memory out of Progsec will not result in a segmentation
-		 * fault.
+		 * unaligned addresses. The content is padded with zeros to
+		 * the next 32-bit word.
 		 */
-		RC = XAie_BlockWrite32(DevInst, Addr, (u32 *)ProgSec,
-				(Phdr->p_memsz + 4U - 1U) / 4U);
+		Seg = _XAie_ElfPlanAddSeg(Plan, XAIE_ELF_SEG_PROGMEM,
+				Phdr->p_paddr, Phdr->p_memsz, Phdr->p_memsz);
+		if(Seg == NULL) {
+			XAIE_ERROR("Memory allocation failed for load plan\n");
+			return XAIE_ERR;
+		}
 
-		return RC;
+		SectionSize = (Phdr->p_filesz < Phdr->p_memsz) ?
+			Phdr->p_filesz : Phdr->p_memsz;
+		memcpy(Plan->Blob + Seg->DataOff, ProgSec, SectionSize);
+		memset(Plan->Blob + Seg->DataOff + SectionSize, 0,
+				((Phdr->p_memsz + 4U - 1U) & ~(4U - 1U)) -
+				SectionSize);
+
+		return XAIE_OK;
 	}
 
 	/* Check if section can access out of bound memory location on device */
@@ -264,107 +465,1245 @@ static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ELF;
 	}
 
-	/* Write initialized section to data memory */
+	/* Initialized section */
 	SectionSize = Phdr->p_filesz;
 	SectionAddr = Phdr->p_paddr;
 	AddrMask = CoreMod->DataMemSize - 1U;
 	while(SectionSize > 0U) {
-		RC = _XAie_GetTargetTileLoc(DevInst, Loc, SectionAddr, &TgtLoc);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Failed to get target "\
-					"location for p_paddr 0x%x\n",
-					SectionAddr);
-			return RC;
-		}
+		u32 BytesToWrite = SectionSize;
 
-		/*Bytes to write in this section */
-		OverFlowBytes = 0U;
 		if((SectionAddr & AddrMask) + SectionSize >
 				CoreMod->DataMemSize) {
-			OverFlowBytes = (SectionAddr & AddrMask) + SectionSize -
-				CoreMod->DataMemSize;
+			BytesToWrite = CoreMod->DataMemSize -
+				(SectionAddr & AddrMask);
 		}
 
-		BytesToWrite = SectionSize - OverFlowBytes;
-		Addr = (SectionAddr & AddrMask);
-
-		/* Turn ECC On if EccStatus flag is set. */
-		if(DevInst->EccStatus) {
-			RC = _XAie_EccOnDM(DevInst, TgtLoc);
-			if(RC != XAIE_OK) {
-				XAIE_ERROR("Unable to turn ECC On for Data Memory\n");
-				return RC;
-			}
+		Seg = _XAie_ElfPlanAddSeg(Plan, XAIE_ELF_SEG_DATAMEM,
+				SectionAddr, BytesToWrite, BytesToWrite);
+		if(Seg == NULL) {
+			XAIE_ERROR("Memory allocation failed for load plan\n");
+			return XAIE_ERR;
 		}
 
-		RC = XAie_DataMemBlockWrite(DevInst, TgtLoc, Addr,
-				(const void*)ProgSec, BytesToWrite);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Write to data memory failed\n");
-			return RC;
-		}
+		memcpy(Plan->Blob + Seg->DataOff, ProgSec, BytesToWrite);
 
 		SectionSize -= BytesToWrite;
 		SectionAddr += BytesToWrite;
 		ProgSec += BytesToWrite;
 	}
 
-	/* Write un-initialized section to data memory */
+	/* Un-initialized section */
 	SectionSize = Phdr->p_memsz - Phdr->p_filesz;
 	SectionAddr = Phdr->p_paddr + Phdr->p_filesz;
 	while(SectionSize > 0U) {
+		u32 BytesToWrite = SectionSize;
+
+		if((SectionAddr & AddrMask) + SectionSize >
+				CoreMod->DataMemSize) {
+			BytesToWrite = CoreMod->DataMemSize -
+				(SectionAddr & AddrMask);
+		}
+
+		Seg = _XAie_ElfPlanAddSeg(Plan, XAIE_ELF_SEG_BSS, SectionAddr,
+				BytesToWrite, 0U);
+		if(Seg == NULL) {
+			XAIE_ERROR("Memory allocation failed for load plan\n");
+			return XAIE_ERR;
+		}
+
+		SectionSize -= BytesToWrite;
+		SectionAddr += BytesToWrite;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of pages of the memory image of an AIE
+* tile, i.e. its program memory and the four data memories it can access.
+*
+* @param	CoreMod: Core module properties.
+*
+* @return	Number of pages.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static inline u32 _XAie_ElfNumPages(const XAie_CoreMod *CoreMod)
+{
+	return (CoreMod->ProgMemSize + CoreMod->DataMemSize * 4U) /
+		XAIE_ELF_PAGE_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the page index of an address of the memory image of an
+* AIE tile.
+*
+* @param	CoreMod: Core module properties.
+* @param	Addr: Address from the core's perspective.
+*
+* @return	Page index.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static inline u32 _XAie_ElfPageIdx(const XAie_CoreMod *CoreMod, u32 Addr)
+{
+	if(Addr < CoreMod->ProgMemSize) {
+		return Addr / XAIE_ELF_PAGE_SIZE;
+	}
+
+	return (CoreMod->ProgMemSize + Addr - CoreMod->DataMemAddr) /
+		XAIE_ELF_PAGE_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the size of the part of a segment, starting at the
+* given offset, which lies within a single page.
+*
+* @param	Seg: Segment of a load plan.
+* @param	Off: Offset in the segment.
+*
+* @return	Size in bytes.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static inline u32 _XAie_ElfPieceSize(const XAie_ElfSeg *Seg, u32 Off)
+{
+	u32 Size = XAIE_ELF_PAGE_SIZE -
+		((Seg->Addr + Off) & (XAIE_ELF_PAGE_SIZE - 1U));
+
+	return (Size < Seg->Size - Off) ? Size : Seg->Size - Off;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the hash of each page of the memory image written by a
+* load plan. The pages which are not written have a hash of 0.
+*
+* @param	DevInst: Device Instance.
+* @param	Plan: Load plan.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanHashPages(XAie_DevInst *DevInst, XAie_ElfPlan *Plan)
+{
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	Plan->NumPages = _XAie_ElfNumPages(CoreMod);
+	Plan->PageHashes = calloc(Plan->NumPages, sizeof(*Plan->PageHashes));
+	if(Plan->PageHashes == NULL) {
+		XAIE_ERROR("Memory allocation failed for page hashes\n");
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < Plan->NumSegs; i++) {
+		const XAie_ElfSeg *Seg = &Plan->Segs[i];
+
+		for(u32 Off = 0U; Off < Seg->Size;) {
+			u32 Addr = Seg->Addr + Off;
+			u32 Size = _XAie_ElfPieceSize(Seg, Off);
+			u64 *Hash = &Plan->PageHashes[_XAie_ElfPageIdx(CoreMod,
+					Addr)];
+
+			if(*Hash == 0U) {
+				*Hash = XAIE_ELF_HASH_INIT;
+			}
+
+			*Hash = _XAie_ElfHash(*Hash, &Seg->Type,
+					sizeof(Seg->Type));
+			*Hash = _XAie_ElfHash(*Hash, &Addr, sizeof(Addr));
+			*Hash = _XAie_ElfHash(*Hash, &Size, sizeof(Size));
+			if(Seg->Type != XAIE_ELF_SEG_BSS) {
+				*Hash = _XAie_ElfHash(*Hash,
+						Plan->Blob + Seg->DataOff + Off,
+						Size);
+			}
+
+			Off += Size;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees a load plan.
+*
+* @param	Plan: Load plan.
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static void _XAie_ElfPlanFree(XAie_ElfPlan *Plan)
+{
+	free(Plan->Segs);
+	free(Plan->Blob);
+	free(Plan->PageHashes);
+	free(Plan->Key);
+	free(Plan);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function drops a reference to a load plan returned by the cache.
+*
+* @param	Plan: Load plan.
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static void _XAie_ElfPlanPut(XAie_ElfPlan *Plan)
+{
+	_XAie_ElfCacheLock();
+	Plan->RefCount--;
+	_XAie_ElfCacheUnlock();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes an additional reference to a load plan returned by the
+* cache.
+*
+* @param	Plan: Load plan.
+*
+* @return	Load plan.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static XAie_ElfPlan *_XAie_ElfPlanHold(XAie_ElfPlan *Plan)
+{
+	_XAie_ElfCacheLock();
+	Plan->RefCount++;
+	_XAie_ElfCacheUnlock();
+
+	return Plan;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function renders the content a load plan writes to a page of the image,
+* along with the mask of the bytes it writes.
+*
+* @param	CoreMod: Core module of the AIE tiles.
+* @param	Plan: Load plan.
+* @param	Page: Index of the page.
+* @param	Buf: Buffer of XAIE_ELF_PAGE_SIZE bytes for the content.
+* @param	Mask: Buffer of XAIE_ELF_PAGE_SIZE bytes, set to 1 for the
+*		bytes written.
+*
+* @return	None.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static void _XAie_ElfPlanRenderPage(const XAie_CoreMod *CoreMod,
+		const XAie_ElfPlan *Plan, u32 Page, u8 *Buf, u8 *Mask)
+{
+	memset(Buf, 0, XAIE_ELF_PAGE_SIZE);
+	memset(Mask, 0, XAIE_ELF_PAGE_SIZE);
+
+	for(u32 i = 0U; i < Plan->NumSegs; i++) {
+		const XAie_ElfSeg *Seg = &Plan->Segs[i];
+
+		for(u32 Off = 0U; Off < Seg->Size;) {
+			u32 Addr = Seg->Addr + Off;
+			u32 Size = _XAie_ElfPieceSize(Seg, Off);
+			u32 PageOff = Addr & (XAIE_ELF_PAGE_SIZE - 1U);
+
+			if(_XAie_ElfPageIdx(CoreMod, Addr) == Page) {
+				if(Seg->Type != XAIE_ELF_SEG_BSS) {
+					memcpy(Buf + PageOff, Plan->Blob +
+							Seg->DataOff + Off,
+							Size);
+				} else {
+					memset(Buf + PageOff, 0, Size);
+				}
+				memset(Mask + PageOff, 1, Size);
+			}
+
+			Off += Size;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks if two load plans write the same bytes to a page of the
+* image. It confirms a match of the page hashes.
+*
+* @param	CoreMod: Core module of the AIE tiles.
+* @param	Prev: Load plan of the image in place.
+* @param	Plan: Load plan of the image to load.
+* @param	Page: Index of the page.
+*
+* @return	1 if the page content is the same, 0 otherwise.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u8 _XAie_ElfPlanPageEqual(const XAie_CoreMod *CoreMod,
+		const XAie_ElfPlan *Prev, const XAie_ElfPlan *Plan, u32 Page)
+{
+	u8 PrevBuf[XAIE_ELF_PAGE_SIZE], PrevMask[XAIE_ELF_PAGE_SIZE];
+	u8 Buf[XAIE_ELF_PAGE_SIZE], Mask[XAIE_ELF_PAGE_SIZE];
+
+	_XAie_ElfPlanRenderPage(CoreMod, Prev, Page, PrevBuf, PrevMask);
+	_XAie_ElfPlanRenderPage(CoreMod, Plan, Page, Buf, Mask);
+
+	return (memcmp(PrevMask, Mask, sizeof(Mask)) == 0) &&
+		(memcmp(PrevBuf, Buf, sizeof(Buf)) == 0);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares the next bytes of the key of a load plan.
+*
+* @param	Plan: Load plan.
+* @param	Off: Offset in the key, advanced past the compared bytes.
+* @param	Data: Bytes to compare.
+* @param	Size: Number of bytes.
+*
+* @return	1 if the bytes match, 0 otherwise.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static inline u8 _XAie_ElfKeyCmp(const XAie_ElfPlan *Plan, u32 *Off,
+		const void *Data, u32 Size)
+{
+	if((Plan->KeySize - *Off < Size) ||
+			(memcmp(Plan->Key + *Off, Data, Size) != 0)) {
+		return 0U;
+	}
+
+	*Off += Size;
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks if a load plan was built from the given raw bytes.
+*
+* @param	Plan: Load plan.
+* @param	Key: Raw bytes of the elf or section to load.
+*
+* @return	1 if the plan matches, 0 otherwise.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static u8 _XAie_ElfKeyMatch(const XAie_ElfPlan *Plan, const XAie_ElfKey *Key)
+{
+	const Elf32_Ehdr *Ehdr;
+	const Elf32_Phdr *Phdr;
+	u32 Off = 0U;
+
+	if((Plan->Hash != Key->Hash) || (Plan->DevGen != Key->DevGen) ||
+			(Plan->IsSection != (Key->ElfMem == NULL))) {
+		return 0U;
+	}
+
+	if(Key->ElfMem == NULL) {
+		return _XAie_ElfKeyCmp(Plan, &Off, Key->Phdr,
+				sizeof(*Key->Phdr)) &&
+			_XAie_ElfKeyCmp(Plan, &Off, Key->SectionPtr,
+					Key->Phdr->p_filesz) &&
+			(Off == Plan->KeySize);
+	}
+
+	Ehdr = (const Elf32_Ehdr *)Key->ElfMem;
+	Phdr = (const Elf32_Phdr *)(Key->ElfMem + sizeof(*Ehdr));
+	if(_XAie_ElfKeyCmp(Plan, &Off, Key->ElfMem, sizeof(*Ehdr) +
+				Ehdr->e_phnum * sizeof(*Phdr)) == 0U) {
+		return 0U;
+	}
+
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		if((Phdr[phnum].p_type == PT_LOAD) &&
+				(_XAie_ElfKeyCmp(Plan, &Off,
+					Key->ElfMem + Phdr[phnum].p_offset,
+					Phdr[phnum].p_filesz) == 0U)) {
+			return 0U;
+		}
+	}
+
+	return (Off == Plan->KeySize) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function saves the raw bytes a load plan is built from in the plan.
+*
+* @param	Plan: Load plan.
+* @param	Key: Raw bytes of the elf or section.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanSetKey(XAie_ElfPlan *Plan, const XAie_ElfKey *Key)
+{
+	const Elf32_Ehdr *Ehdr = (const Elf32_Ehdr *)Key->ElfMem;
+	const Elf32_Phdr *Phdr;
+	u32 HdrSize;
+
+	Plan->Hash = Key->Hash;
+	Plan->DevGen = Key->DevGen;
+	if(Key->ElfMem == NULL) {
+		Plan->IsSection = 1U;
+		Plan->KeySize = sizeof(*Key->Phdr) + Key->Phdr->p_filesz;
+		Plan->Key = malloc(Plan->KeySize);
+		if(Plan->Key == NULL) {
+			XAIE_ERROR("Memory allocation failed for load plan\n");
+			return XAIE_ERR;
+		}
+
+		memcpy(Plan->Key, Key->Phdr, sizeof(*Key->Phdr));
+		memcpy(Plan->Key + sizeof(*Key->Phdr), Key->SectionPtr,
+				Key->Phdr->p_filesz);
+
+		return XAIE_OK;
+	}
+
+	Phdr = (const Elf32_Phdr *)(Key->ElfMem + sizeof(*Ehdr));
+	HdrSize = sizeof(*Ehdr) + Ehdr->e_phnum * sizeof(*Phdr);
+	Plan->KeySize = HdrSize;
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		if(Phdr[phnum].p_type == PT_LOAD) {
+			Plan->KeySize += Phdr[phnum].p_filesz;
+		}
+	}
+
+	Plan->Key = malloc(Plan->KeySize);
+	if(Plan->Key == NULL) {
+		XAIE_ERROR("Memory allocation failed for load plan\n");
+		return XAIE_ERR;
+	}
+
+	memcpy(Plan->Key, Key->ElfMem, HdrSize);
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		if(Phdr[phnum].p_type != PT_LOAD) {
+			continue;
+		}
+
+		memcpy(Plan->Key + HdrSize, Key->ElfMem + Phdr[phnum].p_offset,
+				Phdr[phnum].p_filesz);
+		HdrSize += Phdr[phnum].p_filesz;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up the load plan built from the given raw bytes in the
+* cache and takes a reference to it.
+*
+* @param	Key: Raw bytes of the elf or section to load.
+*
+* @return	Cached load plan, NULL if not cached.
+*
+* @note		Internal API only. Plans with the same hash are compared with
+*		the raw bytes, so a hash collision is a cache miss.
+*
+*******************************************************************************/
+static XAie_ElfPlan *_XAie_ElfCacheLookup(const XAie_ElfKey *Key)
+{
+	XAie_ElfPlan *Plan;
+
+	_XAie_ElfCacheLock();
+	for(Plan = ElfCache.Plans; Plan != NULL; Plan = Plan->Next) {
+		if(_XAie_ElfKeyMatch(Plan, Key) != 0U) {
+			Plan->RefCount++;
+			Plan->LastUse = ++ElfCache.UseCount;
+			break;
+		}
+	}
+	_XAie_ElfCacheUnlock();
+
+	return Plan;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function inserts a load plan in the cache and takes a reference to it.
+* If a plan built from the same raw bytes was inserted concurrently, the new
+* plan is freed and the cached one is returned. The least recently used plans
+* are evicted once the cache holds more than XAIE_ELF_CACHE_MAX_PLANS plans.
+*
+* @param	Plan: Load plan.
+*
+* @return	Cached load plan.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static XAie_ElfPlan *_XAie_ElfCacheInsert(XAie_ElfPlan *Plan)
+{
+	XAie_ElfPlan *Cur;
+	u32 NumPlans = 0U;
+
+	_XAie_ElfCacheLock();
+	for(Cur = ElfCache.Plans; Cur != NULL; Cur = Cur->Next) {
+		if((Cur->Hash == Plan->Hash) && (Cur->DevGen == Plan->DevGen) &&
+				(Cur->IsSection == Plan->IsSection) &&
+				(Cur->KeySize == Plan->KeySize) &&
+				(memcmp(Cur->Key, Plan->Key, Cur->KeySize) == 0)) {
+			break;
+		}
+		NumPlans++;
+	}
+
+	if(Cur != NULL) {
+		_XAie_ElfPlanFree(Plan);
+		Plan = Cur;
+	} else {
+		Plan->Next = ElfCache.Plans;
+		ElfCache.Plans = Plan;
+		NumPlans++;
+	}
+
+	Plan->RefCount++;
+	Plan->LastUse = ++ElfCache.UseCount;
+
+	while(NumPlans > XAIE_ELF_CACHE_MAX_PLANS) {
+		XAie_ElfPlan **Victim = NULL;
+
+		for(XAie_ElfPlan **Pp = &ElfCache.Plans; *Pp != NULL;
+				Pp = &(*Pp)->Next) {
+			if(((*Pp)->RefCount == 0U) && ((Victim == NULL) ||
+					((*Pp)->LastUse < (*Victim)->LastUse))) {
+				Victim = Pp;
+			}
+		}
+
+		if(Victim == NULL) {
+			break;
+		}
+
+		Cur = *Victim;
+		*Victim = Cur->Next;
+		_XAie_ElfPlanFree(Cur);
+		NumPlans--;
+	}
+	_XAie_ElfCacheUnlock();
+
+	return Plan;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the load plan of an elf in memory, from the cache if
+* the same content was already parsed.
+*
+* @param	DevInst: Device Instance.
+* @param	ElfMem: Pointer to the elf contents in memory.
+* @param	ElfSz: Size of the elf in bytes, 0 if unknown.
+* @param	Plan: Pointer to return the load plan. The reference shall be
+*		dropped with _XAie_ElfPlanPut().
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only. The elf is only parsed if no cached plan was
+*		built from the same headers and PT_LOAD contents.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanGet(XAie_DevInst *DevInst,
+		const unsigned char *ElfMem, u64 ElfSz, XAie_ElfPlan **Plan)
+{
+	AieRC RC;
+	u64 Hash;
+	XAie_ElfKey Key;
+	XAie_ElfPlan *NewPlan;
+	const Elf32_Ehdr *Ehdr = (const Elf32_Ehdr *)ElfMem;
+	const Elf32_Phdr *Phdr;
+
+	if(((ElfSz != 0U) && (ElfSz < sizeof(*Ehdr))) ||
+			(memcmp(Ehdr->e_ident, ELFMAG, SELFMAG) != 0) ||
+			(Ehdr->e_ident[EI_CLASS] != ELFCLASS32)) {
+		XAIE_ERROR("Invalid elf header\n");
+		return XAIE_INVALID_ELF;
+	}
+
+	_XAie_PrintElfHdr(Ehdr);
+
+	/* Hash the headers and the content of the loadable segments */
+	Phdr = (const Elf32_Phdr *)(ElfMem + sizeof(*Ehdr));
+	if((ElfSz != 0U) && (sizeof(*Ehdr) + (u64)Ehdr->e_phnum *
+				sizeof(*Phdr) > ElfSz)) {
+		XAIE_ERROR("Invalid elf program headers\n");
+		return XAIE_INVALID_ELF;
+	}
+
+	Hash = _XAie_ElfHash(XAIE_ELF_HASH_INIT, ElfMem,
+			sizeof(*Ehdr) + Ehdr->e_phnum * sizeof(*Phdr));
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		if(Phdr[phnum].p_type != PT_LOAD) {
+			continue;
+		}
+
+		if((ElfSz != 0U) && ((u64)Phdr[phnum].p_offset +
+					Phdr[phnum].p_filesz > ElfSz)) {
+			XAIE_ERROR("Invalid elf section offset\n");
+			return XAIE_INVALID_ELF;
+		}
+
+		Hash = _XAie_ElfHash(Hash, ElfMem + Phdr[phnum].p_offset,
+				Phdr[phnum].p_filesz);
+	}
+
+	Key.Hash = Hash;
+	Key.DevGen = DevInst->DevProp.DevGen;
+	Key.ElfMem = ElfMem;
+	Key.Phdr = NULL;
+	Key.SectionPtr = NULL;
+	*Plan = _XAie_ElfCacheLookup(&Key);
+	if(*Plan != NULL) {
+		return XAIE_OK;
+	}
+
+	NewPlan = calloc(1U, sizeof(*NewPlan));
+	if(NewPlan == NULL) {
+		XAIE_ERROR("Memory allocation failed for load plan\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_ElfPlanSetKey(NewPlan, &Key);
+	if(RC != XAIE_OK) {
+		_XAie_ElfPlanFree(NewPlan);
+		return RC;
+	}
+
+	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
+		_XAie_PrintProgSectHdr(&Phdr[phnum]);
+		if(Phdr[phnum].p_type != PT_LOAD) {
+			continue;
+		}
+
+		RC = _XAie_ElfPlanAddSection(DevInst, NewPlan,
+				ElfMem + Phdr[phnum].p_offset, &Phdr[phnum]);
+		if(RC != XAIE_OK) {
+			_XAie_ElfPlanFree(NewPlan);
+			return RC;
+		}
+	}
+
+	RC = _XAie_ElfPlanHashPages(DevInst, NewPlan);
+	if(RC != XAIE_OK) {
+		_XAie_ElfPlanFree(NewPlan);
+		return RC;
+	}
+
+	*Plan = _XAie_ElfCacheInsert(NewPlan);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine zeroes a range of the data memory of a tile. The 32-bit aligned
+* part of the range is cleared with a block set.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Addr: Address in the data memory.
+* @param	Size: Size of the range in bytes.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfZeroDataMem(XAie_DevInst *DevInst, XAie_LocType Loc,
+		u32 Addr, u32 Size)
+{
+	AieRC RC;
+	u32 Head, Words;
+	const u8 Zero[XAIE_MEM_WORD_ALIGN_SIZE] = {0U};
+	const XAie_MemMod *MemMod;
+
+	MemMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
+
+	Head = XAIE_MEM_WORD_ROUND_UP(Addr) - Addr;
+	if(Head > Size) {
+		Head = Size;
+	}
+
+	if(Head != 0U) {
+		RC = XAie_DataMemBlockWrite(DevInst, Loc, Addr, Zero, Head);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Addr += Head;
+		Size -= Head;
+	}
+
+	Words = Size / XAIE_MEM_WORD_ALIGN_SIZE;
+	if(Words != 0U) {
+		RC = XAie_BlockSet32(DevInst, MemMod->MemAddr + Addr +
+				_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col),
+				0U, Words);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+		Addr += Words * XAIE_MEM_WORD_ALIGN_SIZE;
+		Size -= Words * XAIE_MEM_WORD_ALIGN_SIZE;
+	}
+
+	if(Size != 0U) {
+		return XAie_DataMemBlockWrite(DevInst, Loc, Addr, Zero, Size);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes a part of a segment of a load plan to the device.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	TgtLoc: Location of the tile targeted by a data memory segment.
+* @param	Plan: Load plan.
+* @param	Seg: Segment of the load plan.
+* @param	Off: Offset of the part in the segment.
+* @param	Size: Size of the part in bytes.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfWritePiece(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_LocType TgtLoc, const XAie_ElfPlan *Plan,
+		const XAie_ElfSeg *Seg, u32 Off, u32 Size)
+{
+	const unsigned char *Data = Plan->Blob + Seg->DataOff + Off;
+	const XAie_CoreMod *CoreMod;
+	u32 AddrMask;
+
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	AddrMask = CoreMod->DataMemSize - 1U;
+
+	switch(Seg->Type) {
+	case XAIE_ELF_SEG_PROGMEM:
+		return XAie_BlockWrite32(DevInst, CoreMod->ProgMemHostOffset +
+				Seg->Addr + Off +
+				_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col),
+				(const u32 *)Data, (Size + 4U - 1U) / 4U);
+	case XAIE_ELF_SEG_DATAMEM:
+		return XAie_DataMemBlockWrite(DevInst, TgtLoc,
+				(Seg->Addr + Off) & AddrMask, Data, Size);
+	default:
+		return _XAie_ElfZeroDataMem(DevInst, TgtLoc,
+				(Seg->Addr + Off) & AddrMask, Size);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine writes the segments of a load plan to the device.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Plan: Load plan.
+* @param	Dirty: Array of flags, one per page of the image, to write only
+*		the flagged pages. NULL to write the complete image.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanLoad(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_ElfPlan *Plan, const u8 *Dirty)
+{
+	AieRC RC;
+	const XAie_CoreMod *CoreMod;
+
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+
+	for(u32 i = 0U; i < Plan->NumSegs; i++) {
+		const XAie_ElfSeg *Seg = &Plan->Segs[i];
+		XAie_LocType TgtLoc = Loc;
+		u8 EccOn = XAIE_DISABLE;
+
+		if(Seg->Type != XAIE_ELF_SEG_PROGMEM) {
+			RC = _XAie_GetTargetTileLoc(DevInst, Loc, Seg->Addr,
+					&TgtLoc);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Failed to get target "\
+						"location for p_paddr 0x%x\n",
+						Seg->Addr);
+				return RC;
+			}
+		}
+
+		for(u32 Off = 0U; Off < Seg->Size;) {
+			u32 Size = Seg->Size - Off;
+
+			/* Merge the consecutive dirty pages in a single write */
+			if(Dirty != NULL) {
+				Size = _XAie_ElfPieceSize(Seg, Off);
+				if(Dirty[_XAie_ElfPageIdx(CoreMod,
+							Seg->Addr + Off)] == 0U) {
+					Off += Size;
+					continue;
+				}
+
+				while((Off + Size < Seg->Size) &&
+						(Dirty[_XAie_ElfPageIdx(CoreMod,
+							Seg->Addr + Off + Size)]
+						 != 0U)) {
+					Size += _XAie_ElfPieceSize(Seg,
+							Off + Size);
+				}
+			}
+
+			/* Turn ECC On if EccStatus flag is set. */
+			if((Seg->Type != XAIE_ELF_SEG_PROGMEM) &&
+					DevInst->EccStatus &&
+					(EccOn == XAIE_DISABLE)) {
+				RC = _XAie_EccOnDM(DevInst, TgtLoc);
+				if(RC != XAIE_OK) {
+					XAIE_ERROR("Unable to turn ECC On for Data Memory\n");
+					return RC;
+				}
+				EccOn = XAIE_ENABLE;
+			}
+
+			RC = _XAie_ElfWritePiece(DevInst, Loc, TgtLoc, Plan,
+					Seg, Off, Size);
+			if(RC != XAIE_OK) {
+				XAIE_ERROR("Write to memory failed\n");
+				return RC;
+			}
+
+			Off += Size;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine reads back the pages of the image of a load plan which are not
+* flagged dirty, and flags the ones whose content differs on the device.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Plan: Load plan.
+* @param	Dirty: Array of flags, one per page of the image.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanVerify(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_ElfPlan *Plan, u8 *Dirty)
+{
+	AieRC RC;
+	u32 AddrMask;
+	u32 Buf[XAIE_ELF_PAGE_SIZE / 4U + 1U];
+	const u8 Zero[XAIE_ELF_PAGE_SIZE] = {0U};
+	const XAie_CoreMod *CoreMod;
+	const XAie_MemMod *MemMod;
+
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	MemMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
+	AddrMask = CoreMod->DataMemSize - 1U;
+
+	for(u32 i = 0U; i < Plan->NumSegs; i++) {
+		const XAie_ElfSeg *Seg = &Plan->Segs[i];
+		XAie_LocType TgtLoc = Loc;
+
+		if(Seg->Type != XAIE_ELF_SEG_PROGMEM) {
+			RC = _XAie_GetTargetTileLoc(DevInst, Loc, Seg->Addr,
+					&TgtLoc);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+
+		for(u32 Off = 0U; Off < Seg->Size;) {
+			u32 Size = _XAie_ElfPieceSize(Seg, Off);
+			u32 Page = _XAie_ElfPageIdx(CoreMod, Seg->Addr + Off);
+			const void *Expected = Plan->Blob + Seg->DataOff + Off;
+			u32 ByteOff = (Seg->Addr + Off) & (4U - 1U);
+			u64 RegAddr;
+
+			if(Dirty[Page] != 0U) {
+				Off += Size;
+				continue;
+			}
+
+			if(Seg->Type == XAIE_ELF_SEG_PROGMEM) {
+				RegAddr = CoreMod->ProgMemHostOffset +
+					Seg->Addr + Off;
+				/* Program memory segments are padded to words */
+				Size = (Size + 4U - 1U) & ~(4U - 1U);
+			} else {
+				RegAddr = MemMod->MemAddr +
+					((Seg->Addr + Off) & AddrMask);
+				if(Seg->Type == XAIE_ELF_SEG_BSS) {
+					Expected = Zero;
+				}
+			}
+			RegAddr += _XAie_GetTileAddr(DevInst, TgtLoc.Row,
+					TgtLoc.Col);
+
+			RC = XAie_BlockRead32(DevInst, RegAddr - ByteOff, Buf,
+					(ByteOff + Size + 4U - 1U) / 4U);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			if(memcmp((u8 *)Buf + ByteOff, Expected, Size) != 0) {
+				XAIE_DBG("Page %u of tile (%u, %u) differs\n",
+						Page, Loc.Col, Loc.Row);
+				Dirty[Page] = 1U;
+			}
+
+			Off += _XAie_ElfPieceSize(Seg, Off);
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine loads an elf load plan to an AIE tile, handling the ECC of the
+* program memory.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Plan: Load plan.
+* @param	Dirty: Array of flags, one per page of the image, to write only
+*		the flagged pages. NULL to write the complete image.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanLoadElf(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const XAie_ElfPlan *Plan, const u8 *Dirty)
+{
+	AieRC RC;
+	u8 PmDirty = XAIE_ENABLE;
+
+	if(Dirty != NULL) {
+		const XAie_CoreMod *CoreMod;
+
+		CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+		PmDirty = XAIE_DISABLE;
+		for(u32 p = 0U; p < CoreMod->ProgMemSize / XAIE_ELF_PAGE_SIZE;
+				p++) {
+			if(Dirty[p] != 0U) {
+				PmDirty = XAIE_ENABLE;
+				break;
+			}
+		}
+	}
+
+	/* For AIE, turn ECC Off before program memory load */
+	if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
+			(DevInst->EccStatus == XAIE_ENABLE) &&
+			(PmDirty == XAIE_ENABLE)) {
+		_XAie_EccEvntResetPM(DevInst, Loc);
+	}
+
+	RC = _XAie_ElfPlanLoad(DevInst, Loc, Plan, Dirty);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	/* Turn ECC On after program memory load */
+	if(DevInst->EccStatus && (PmDirty == XAIE_ENABLE)) {
+		RC = _XAie_EccOnPM(DevInst, Loc);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to turn ECC On for Program Memory\n");
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the load record of an AIE tile.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Alloc: XAIE_ENABLE to allocate the records of the partition if
+*		they don't exist yet.
+*
+* @return	Load record, NULL if the records don't exist.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static XAie_ElfLoadRec *_XAie_ElfLoadRecGet(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 Alloc)
+{
+	XAie_ElfLoadRecs *Recs = DevInst->ElfLoadRecs;
+
+	if(Recs == NULL) {
+		u32 NumRecs;
+
+		if(Alloc == XAIE_DISABLE) {
+			return NULL;
+		}
+
+		NumRecs = (u32)DevInst->NumCols * DevInst->AieTileNumRows;
+		Recs = calloc(1U, sizeof(*Recs) + NumRecs * sizeof(Recs->Recs[0]));
+		if(Recs == NULL) {
+			XAIE_ERROR("Memory allocation failed for load records\n");
+			return NULL;
+		}
+
+		Recs->NumRecs = NumRecs;
+		DevInst->ElfLoadRecs = Recs;
+	}
+
+	return &Recs->Recs[Loc.Col * DevInst->AieTileNumRows +
+		(Loc.Row - DevInst->AieTileRowStart)];
+}
+
+/*****************************************************************************/
+/**
+*
+* This function records the image loaded to an AIE tile, if the load records
+* of the partition are in use.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Plan: Load plan of the image. NULL if the content of the tile
+*		memories is unknown.
+*
+* @return	None.
+*
+* @note		Internal API only. The record holds a reference to the plan,
+*		which keeps it cached until the record is updated or
+*		invalidated.
+*
+*******************************************************************************/
+static void _XAie_ElfLoadRecUpdate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ElfPlan *Plan)
+{
+	XAie_ElfLoadRec *Rec;
+
+	Rec = _XAie_ElfLoadRecGet(DevInst, Loc, XAIE_DISABLE);
+	if(Rec == NULL) {
+		return;
+	}
+
+	if(Rec->Plan != NULL) {
+		_XAie_ElfPlanPut(Rec->Plan);
+		Rec->Plan = NULL;
+	}
+
+	Rec->PageDiff = 0U;
+	if((Plan != NULL) && (Plan->PageHashes != NULL)) {
+		Rec->Plan = _XAie_ElfPlanHold(Plan);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function invalidates the load records of all the AIE tiles of the
+* partition. It is called by the operations which clear or reset the tile
+* memories.
+*
+* @param	DevInst: Device Instance.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_ElfLoadRecsInvalidate(XAie_DevInst *DevInst)
+{
+	XAie_ElfLoadRecs *Recs = DevInst->ElfLoadRecs;
+
+	if(Recs == NULL) {
+		return;
+	}
+
+	for(u32 i = 0U; i < Recs->NumRecs; i++) {
+		if(Recs->Recs[i].Plan != NULL) {
+			_XAie_ElfPlanPut(Recs->Recs[i].Plan);
+			Recs->Recs[i].Plan = NULL;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the load records of the partition.
+*
+* @param	DevInst: Device Instance.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_ElfLoadRecsFree(XAie_DevInst *DevInst)
+{
+	XAie_ElfLoadRecs *Recs = DevInst->ElfLoadRecs;
+
+	if(Recs == NULL) {
+		return;
+	}
+
+	_XAie_ElfLoadRecsInvalidate(DevInst);
+	free(Recs);
+	DevInst->ElfLoadRecs = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine loads an elf load plan to an AIE tile, skipping what is already
+* in place according to the load record of the tile.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of the AIE tile.
+* @param	Plan: Load plan.
+* @param	Flags: Combination of XAIE_ELF_LOAD_* flags.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanLoadIncremental(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ElfPlan *Plan, u8 Flags)
+{
+	AieRC RC;
+	u8 *Dirty = NULL;
+	XAie_ElfLoadRec *Rec;
+	const XAie_ElfPlan *Prev;
+	const XAie_CoreMod *CoreMod;
 
-		void *TempSrc;
+	Rec = _XAie_ElfLoadRecGet(DevInst, Loc, XAIE_ENABLE);
+	if(Rec == NULL) {
+		return XAIE_ERR;
+	}
 
-		RC = _XAie_GetTargetTileLoc(DevInst, Loc, SectionAddr, &TgtLoc);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Failed to get target "
-					"location for p_paddr 0x%x\n",
-					SectionAddr);
-			return RC;
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	Prev = Rec->Plan;
+	if(((Flags & XAIE_ELF_LOAD_FORCE) == 0U) && (Prev != NULL) &&
+			((Prev == Plan) || (Rec->PageDiff != 0U))) {
+		Dirty = calloc(Plan->NumPages, sizeof(*Dirty));
+		if(Dirty == NULL) {
+			XAIE_ERROR("Memory allocation failed\n");
+			return XAIE_ERR;
 		}
 
-		/*Bytes to write in this section */
-		OverFlowBytes = 0U;
-		if((SectionAddr & AddrMask) + SectionSize >
-				CoreMod->DataMemSize) {
-			OverFlowBytes = (SectionAddr & AddrMask) + SectionSize -
-				CoreMod->DataMemSize;
+		/* Pages with matching hashes are confirmed byte by byte */
+		if(Prev != Plan) {
+			for(u32 p = 0U; p < Plan->NumPages; p++) {
+				if(Prev->PageHashes[p] != Plan->PageHashes[p]) {
+					Dirty[p] = 1U;
+				} else if(Plan->PageHashes[p] != 0U) {
+					Dirty[p] = !_XAie_ElfPlanPageEqual(
+							CoreMod, Prev, Plan, p);
+				}
+			}
 		}
 
-		BytesToWrite = SectionSize - OverFlowBytes;
-		Addr = (SectionAddr & AddrMask);
-
-		/* Turn ECC On if the EccStatus flag is set */
-		if(DevInst->EccStatus) {
-			RC = _XAie_EccOnDM(DevInst, TgtLoc);
+		/*
+		 * Kernels modify their data memories at runtime, so the
+		 * writable segments are rewritten unless read back.
+		 */
+		if((Flags & XAIE_ELF_LOAD_VERIFY) != 0U) {
+			RC = _XAie_ElfPlanVerify(DevInst, Loc, Plan, Dirty);
 			if(RC != XAIE_OK) {
-				XAIE_ERROR("Unable to turn ECC On for Data Memory\n");
+				free(Dirty);
 				return RC;
 			}
+		} else {
+			for(u32 i = 0U; i < Plan->NumSegs; i++) {
+				const XAie_ElfSeg *Seg = &Plan->Segs[i];
+
+				if(Seg->Type == XAIE_ELF_SEG_PROGMEM) {
+					continue;
+				}
+
+				for(u32 Off = 0U; Off < Seg->Size;
+						Off += _XAie_ElfPieceSize(Seg,
+							Off)) {
+					Dirty[_XAie_ElfPageIdx(CoreMod,
+							Seg->Addr + Off)] = 1U;
+				}
+			}
 		}
 
-		/* Allocate temporary buffer and set it to 0 */
-		TempSrc = calloc(BytesToWrite, sizeof(char));
-		if(TempSrc == XAIE_NULL) {
-			XAIE_ERROR("Memory allocation failed for temporary "\
-					"buffer\n");
-			return XAIE_ERR;
-		}
-
-		RC = XAie_DataMemBlockWrite(DevInst, TgtLoc, Addr, TempSrc,
-				BytesToWrite);
-		free(TempSrc);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Write to data memory failed for .bss "
-					"section.\n");
-			return RC;
+		if(memchr(Dirty, 1, Plan->NumPages) == NULL) {
+			XAIE_DBG("Image of tile (%u, %u) unchanged\n", Loc.Col,
+					Loc.Row);
+			free(Dirty);
+			return XAIE_OK;
 		}
+	}
 
-		SectionSize -= BytesToWrite;
-		SectionAddr += BytesToWrite;
+	_XAie_ElfLoadRecUpdate(DevInst, Loc, NULL);
+	RC = _XAie_ElfPlanLoadElf(DevInst, Loc, Plan, Dirty);
+	free(Dirty);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
+	_XAie_ElfLoadRecUpdate(DevInst, Loc, Plan);
+	Rec->PageDiff = ((Flags & XAIE_ELF_LOAD_PAGE_DIFF) != 0U);
+
 	return XAIE_OK;
 }
 
@@ -377,20 +1716,18 @@ static AieRC _XAie_WriteProgramSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 * @param	DevInst: Device Instance.
 * @param	Loc: Location of AIE Tile.
 * @param	ElfMem: Pointer to the Elf contents in memory.
-* @param	ElfSz: Size of the elf pointed by *ElfMem
 *
 * @return	XAIE_OK on success and error code for failure.
 *
-* @note		None.
+* @note		The elf is parsed into a load plan which is cached by content,
+*		see XAie_ElfCacheFlush().
 *
 *******************************************************************************/
 AieRC XAie_LoadElfMem(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char* ElfMem)
 {
 	AieRC RC;
-	const Elf32_Ehdr *Ehdr;
-	const Elf32_Phdr *Phdr;
-	const unsigned char *SectionPtr;
+	XAie_ElfPlan *Plan;
 	u8 TileType;
 
 	if((DevInst == XAIE_NULL) || (ElfMem == XAIE_NULL) ||
@@ -399,43 +1736,57 @@ AieRC XAie_LoadElfMem(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	Ehdr = (const Elf32_Ehdr *) ElfMem;
-	_XAie_PrintElfHdr(Ehdr);
-
-	/* For AIE, turn ECC Off before program memory load */
-	if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
-			(DevInst->EccStatus == XAIE_ENABLE)) {
-		_XAie_EccEvntResetPM(DevInst, Loc);
+	RC = _XAie_ElfPlanGet(DevInst, ElfMem, 0U, &Plan);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	for(u32 phnum = 0U; phnum < Ehdr->e_phnum; phnum++) {
-		Phdr = (Elf32_Phdr*) (ElfMem + sizeof(*Ehdr) +
-			phnum * sizeof(*Phdr));
-		_XAie_PrintProgSectHdr(Phdr);
-		if(Phdr->p_type == PT_LOAD) {
-			SectionPtr = ElfMem + Phdr->p_offset;
-			RC = _XAie_WriteProgramSection(DevInst, Loc,
-					SectionPtr, Phdr);
-			if(RC != XAIE_OK) {
-				return RC;
-			}
-		}
+	RC = _XAie_ElfPlanLoadElf(DevInst, Loc, Plan, NULL);
+	if(RC == XAIE_OK) {
+		_XAie_ElfLoadRecUpdate(DevInst, Loc, Plan);
 	}
+	_XAie_ElfPlanPut(Plan);
 
-	/* Turn ECC On after program memory load */
-	if(DevInst->EccStatus) {
-		RC = _XAie_EccOnPM(DevInst, Loc);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Unable to turn ECC On for Program Memory\n");
-			return RC;
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the cached elf load plans which are not in use.
+*
+* @return	XAIE_OK on success.
+*
+* @note		The cache keeps at most XAIE_ELF_CACHE_MAX_PLANS plans, not
+*		counting the ones in use by loads or by the load records of
+*		the tiles. This API can be used to release the memory earlier,
+*		e.g. after the elfs of an application are loaded.
+*
+*******************************************************************************/
+AieRC XAie_ElfCacheFlush(void)
+{
+	XAie_ElfPlan **Pp;
+
+	_XAie_ElfCacheLock();
+	Pp = &ElfCache.Plans;
+	while(*Pp != NULL) {
+		XAie_ElfPlan *Plan = *Pp;
+
+		if(Plan->RefCount != 0U) {
+			Pp = &Plan->Next;
+			continue;
 		}
+
+		*Pp = Plan->Next;
+		_XAie_ElfPlanFree(Plan);
 	}
+	_XAie_ElfCacheUnlock();
 
 	return XAIE_OK;
 }
@@ -495,6 +1846,117 @@ static AieRC XAieSim_GetStackRange(const char *MapPtr,
 }
 #endif
 
+/*****************************************************************************/
+/**
+*
+* This function returns the load plan of an elf file. On Linux, the file is
+* mapped read only instead of being copied to a buffer.
+*
+* @param	DevInst: Device Instance.
+* @param	ElfPtr: Path to the elf file.
+* @param	Plan: Pointer to return the load plan. The reference shall be
+*		dropped with _XAie_ElfPlanPut().
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		Internal API only.
+*
+*******************************************************************************/
+static AieRC _XAie_ElfPlanGetFile(XAie_DevInst *DevInst, const char *ElfPtr,
+		XAie_ElfPlan **Plan)
+{
+#ifdef __linux__
+	int Fd;
+	struct stat Stat;
+	void *ElfMem;
+#else
+	FILE *Fd;
+	int Ret;
+	unsigned char *ElfMem;
+#endif
+	u64 ElfSz;
+	AieRC RC;
+
+#ifdef __linux__
+	Fd = open(ElfPtr, O_RDONLY | O_CLOEXEC);
+	if(Fd < 0) {
+		XAIE_ERROR("Unable to open elf file, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ELF;
+	}
+
+	if(fstat(Fd, &Stat) != 0) {
+		XAIE_ERROR("Failed to get elf file status, %d: %s\n",
+			errno, strerror(errno));
+		close(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	ElfSz = (u64)Stat.st_size;
+	XAIE_DBG("Elf size is %llu bytes\n", (unsigned long long)ElfSz);
+	if(ElfSz == 0U) {
+		XAIE_ERROR("Empty elf file\n");
+		close(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	/* Map the elf read only, the pages are shared through the page cache */
+	ElfMem = mmap(NULL, ElfSz, PROT_READ, MAP_PRIVATE, Fd, 0);
+	close(Fd);
+	if(ElfMem == MAP_FAILED) {
+		XAIE_ERROR("Failed to map elf file, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_ElfPlanGet(DevInst, ElfMem, ElfSz, Plan);
+	munmap(ElfMem, ElfSz);
+#else
+	Fd = fopen(ElfPtr, "r");
+	if(Fd == XAIE_NULL) {
+		XAIE_ERROR("Unable to open elf file, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_INVALID_ELF;
+	}
+
+	/* Get the file size of the elf */
+	Ret = fseek(Fd, 0L, SEEK_END);
+	if(Ret != 0U) {
+		XAIE_ERROR("Failed to get end of file, %d: %s\n",
+			errno, strerror(errno));
+		fclose(Fd);
+		return XAIE_INVALID_ELF;
+	}
+
+	ElfSz = ftell(Fd);
+	rewind(Fd);
+	XAIE_DBG("Elf size is %llu bytes\n", (unsigned long long)ElfSz);
+
+	/* Read entire elf file into memory */
+	ElfMem = (unsigned char*) malloc(ElfSz);
+	if(ElfMem == NULL) {
+		fclose(Fd);
+		XAIE_ERROR("Memory allocation failed\n");
+		return XAIE_ERR;
+	}
+
+	Ret = fread((void*)ElfMem, ElfSz, 1U, Fd);
+	if(Ret == 0U) {
+		fclose(Fd);
+		free(ElfMem);
+		XAIE_ERROR("Failed to read Elf into memory\n");
+		return XAIE_ERR;
+	}
+
+	fclose(Fd);
+
+	RC = _XAie_ElfPlanGet(DevInst, ElfMem, ElfSz, Plan);
+	free(ElfMem);
+#endif
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -515,11 +1977,8 @@ static AieRC XAieSim_GetStackRange(const char *MapPtr,
 AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 		u8 LoadSym)
 {
-	FILE *Fd;
-	int Ret;
-	unsigned char *ElfMem;
+	XAie_ElfPlan *Plan;
 	u8 TileType;
-	u64 ElfSz;
 	AieRC RC;
 
 	if((DevInst == XAIE_NULL) ||
@@ -528,7 +1987,7 @@ AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -586,52 +2045,126 @@ AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 	}
 #endif
 	(void)LoadSym;
-	Fd = fopen(ElfPtr, "r");
-	if(Fd == XAIE_NULL) {
-		XAIE_ERROR("Unable to open elf file, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_INVALID_ELF;
+	RC = _XAie_ElfPlanGetFile(DevInst, ElfPtr, &Plan);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	/* Get the file size of the elf */
-	Ret = fseek(Fd, 0L, SEEK_END);
-	if(Ret != 0U) {
-		XAIE_ERROR("Failed to get end of file, %d: %s\n",
-			errno, strerror(errno));
-		fclose(Fd);
-		return XAIE_INVALID_ELF;
+	RC = _XAie_ElfPlanLoadElf(DevInst, Loc, Plan, NULL);
+	if(RC == XAIE_OK) {
+		_XAie_ElfLoadRecUpdate(DevInst, Loc, Plan);
 	}
+	_XAie_ElfPlanPut(Plan);
 
-	ElfSz = ftell(Fd);
-	rewind(Fd);
-	XAIE_DBG("Elf size is %ld bytes\n", ElfSz);
+	return RC;
+}
 
-	/* Read entire elf file into memory */
-	ElfMem = (unsigned char*) malloc(ElfSz);
-	if(ElfMem == NULL) {
-		fclose(Fd);
-		XAIE_ERROR("Memory allocation failed\n");
-		return XAIE_ERR;
+/*****************************************************************************/
+/**
+*
+* This function loads the elf from memory to an AIE tile, skipping what is
+* already in place. The loader keeps a record of the image last loaded to each
+* AIE tile. If the image is unchanged, the program memory is not written. If
+* the image changed and XAIE_ELF_LOAD_PAGE_DIFF was used for the previous load,
+* only the program memory pages which differ are written. Otherwise the
+* complete image is written. The data memory segments, .data and .bss, are
+* always written unless XAIE_ELF_LOAD_VERIFY is set.
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile.
+* @param	ElfMem: Pointer to the Elf contents in memory.
+* @param	Flags: Combination of the following flags.
+*		XAIE_ELF_LOAD_FORCE: Write the complete image.
+*		XAIE_ELF_LOAD_VERIFY: Read back the pages which are to be
+*		skipped, including the data memory ones, and write the ones
+*		which differ on the device.
+*		XAIE_ELF_LOAD_PAGE_DIFF: Diff the pages of the image against
+*		this one at the next load of the tile.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		The records track the loads done with the elf loader APIs and
+*		are invalidated when the partition is reset, cleared or when
+*		the tiles are requested or released. Use XAIE_ELF_LOAD_FORCE
+*		if the program memory may have been written by other means
+*		since the last load. The load plan of the image recorded for
+*		a tile stays cached until the record is invalidated.
+*
+*******************************************************************************/
+AieRC XAie_LoadElfMemIncremental(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const unsigned char *ElfMem, u8 Flags)
+{
+	AieRC RC;
+	XAie_ElfPlan *Plan;
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) || (ElfMem == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
 	}
 
-	Ret = fread((void*)ElfMem, ElfSz, 1U, Fd);
-	if(Ret == 0U) {
-		fclose(Fd);
-		free(ElfMem);
-		XAIE_ERROR("Failed to read Elf into memory\n");
-		return XAIE_ERR;
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
 	}
 
-	fclose(Fd);
+	RC = _XAie_ElfPlanGet(DevInst, ElfMem, 0U, &Plan);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_ElfPlanLoadIncremental(DevInst, Loc, Plan, Flags);
+	_XAie_ElfPlanPut(Plan);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the elf from file to an AIE tile, skipping what is
+* already in place. See XAie_LoadElfMemIncremental().
+*
+* @param	DevInst: Device Instance.
+* @param	Loc: Location of AIE Tile.
+* @param	ElfPtr: Path to the elf file.
+* @param	Flags: Combination of XAIE_ELF_LOAD_* flags.
+*
+* @return	XAIE_OK on success and error code for failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_LoadElfIncremental(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const char *ElfPtr, u8 Flags)
+{
+	AieRC RC;
+	XAie_ElfPlan *Plan;
+	u8 TileType;
+
+	if((DevInst == XAIE_NULL) || (ElfPtr == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
+		XAIE_ERROR("Invalid tile type\n");
+		return XAIE_INVALID_TILE;
+	}
 
-	RC = XAie_LoadElfMem(DevInst, Loc, ElfMem);
+	RC = _XAie_ElfPlanGetFile(DevInst, ElfPtr, &Plan);
 	if(RC != XAIE_OK) {
-		free(ElfMem);
 		return RC;
 	}
 
-	free(ElfMem);
-	return XAIE_OK;
+	RC = _XAie_ElfPlanLoadIncremental(DevInst, Loc, Plan, Flags);
+	_XAie_ElfPlanPut(Plan);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -653,6 +2186,9 @@ AieRC XAie_LoadElf(XAie_DevInst *DevInst, XAie_LocType Loc, const char *ElfPtr,
 AieRC XAie_LoadElfSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char *SectionPtr, const Elf32_Phdr *Phdr)
 {
+	AieRC RC;
+	XAie_ElfKey Key;
+	XAie_ElfPlan *Plan, *NewPlan;
 	u8 TileType;
 
 	if((DevInst == XAIE_NULL) || (SectionPtr == XAIE_NULL) ||
@@ -662,13 +2198,45 @@ AieRC XAie_LoadElfSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	return _XAie_WriteProgramSection(DevInst, Loc, SectionPtr, Phdr);
+	Key.Hash = _XAie_ElfHash(XAIE_ELF_HASH_INIT, Phdr, sizeof(*Phdr));
+	Key.Hash = _XAie_ElfHash(Key.Hash, SectionPtr, Phdr->p_filesz);
+	Key.DevGen = DevInst->DevProp.DevGen;
+	Key.ElfMem = NULL;
+	Key.Phdr = Phdr;
+	Key.SectionPtr = SectionPtr;
+
+	Plan = _XAie_ElfCacheLookup(&Key);
+	if(Plan == NULL) {
+		NewPlan = calloc(1U, sizeof(*NewPlan));
+		if(NewPlan == NULL) {
+			XAIE_ERROR("Memory allocation failed for load plan\n");
+			return XAIE_ERR;
+		}
+
+		RC = _XAie_ElfPlanSetKey(NewPlan, &Key);
+		if(RC == XAIE_OK) {
+			RC = _XAie_ElfPlanAddSection(DevInst, NewPlan,
+					SectionPtr, Phdr);
+		}
+		if(RC != XAIE_OK) {
+			_XAie_ElfPlanFree(NewPlan);
+			return RC;
+		}
+
+		Plan = _XAie_ElfCacheInsert(NewPlan);
+	}
+
+	_XAie_ElfLoadRecUpdate(DevInst, Loc, NULL);
+	RC = _XAie_ElfPlanLoad(DevInst, Loc, Plan, NULL);
+	_XAie_ElfPlanPut(Plan);
+
+	return RC;
 }
 
 /*****************************************************************************/
@@ -703,13 +2271,15 @@ AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_AIETILE) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	CoreMod = DevInst->DevProp.DevMod[TileType].CoreMod;
+	_XAie_ElfLoadRecUpdate(DevInst, Loc, NULL);
+
+	CoreMod = _XAie_GetDevMod(DevInst)[TileType].CoreMod;
 	Addr = CoreMod->ProgMemHostOffset + TgtAddr +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 
@@ -717,5 +2287,17 @@ AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 			(Size + 4U - 1U) / 4U);
 }
 
+#else /* XAIE_FEATURE_ELF_ENABLE */
+
+void _XAie_ElfLoadRecsInvalidate(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+void _XAie_ElfLoadRecsFree(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
 #endif /* XAIE_FEATURE_ELF_ENABLE */
 /** @} */
@@ -38,6 +38,10 @@
 #include "xaiegbl_defs.h"
 
 /************************** Constant Definitions *****************************/
+/* Flags of the incremental elf load APIs */
+#define XAIE_ELF_LOAD_FORCE		(1U << 0)
+#define XAIE_ELF_LOAD_VERIFY		(1U << 1)
+#define XAIE_ELF_LOAD_PAGE_DIFF		(1U << 2)
 
 /************************** Variable Definitions *****************************/
 typedef struct {
@@ -54,6 +58,11 @@ AieRC XAie_LoadElfSection(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char *SectionPtr, const Elf32_Phdr *Phdr);
 AieRC XAie_LoadElfSectionBlock(XAie_DevInst *DevInst, XAie_LocType Loc,
 		const unsigned char* SectionPtr, u64 TgtAddr, u32 Size);
+AieRC XAie_LoadElfIncremental(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const char *ElfPtr, u8 Flags);
+AieRC XAie_LoadElfMemIncremental(XAie_DevInst *DevInst, XAie_LocType Loc,
+		const unsigned char *ElfMem, u8 Flags);
+AieRC XAie_ElfCacheFlush(void);
 
 #endif /* XAIE_FEATURE_ELF_ENABLE */
 
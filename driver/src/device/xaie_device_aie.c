@@ -24,6 +24,7 @@
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_clock.h"
+#include "xaie_reset.h"
 #include "xaie_tilectrl.h"
 
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
@@ -297,19 +298,27 @@ AieRC _XAie_SetPartIsolationAfterRst(XAie_DevInst *DevInst)
 * @return       XAIE_OK on success, error code on failure
 *
 * @note		It is not required to check the DevInst as the caller function
-*		should provide the correct value.
+*		should provide the correct value. It is called right after the
+*		partition reset, so the tile DMAs are free to clear the data
+*		memories.
 *		Internal API only.
 *
 ******************************************************************************/
 AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst)
 {
 	AieRC RC = XAIE_OK;
+	u8 DmaZeroed = XAIE_DISABLE;
 	const XAie_CoreMod *CoreMod;
 	const XAie_MemMod *MemMod;
 
 	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
 	MemMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
 
+	/* Data memories are cleared by the tile DMAs in parallel if possible */
+	if(_XAie_RstDmaZeroDataMems(DevInst) == XAIE_OK) {
+		DmaZeroed = XAIE_ENABLE;
+	}
+
 	for(u8 C = 0; C < DevInst->NumCols; C++) {
 		for(u8 R = 1; R < DevInst->NumRows; R++) {
 			u64 RegAddr;
@@ -324,6 +333,10 @@ AieRC _XAie_PartMemZeroInit(XAie_DevInst *DevInst)
 				return RC;
 			}
 
+			if(DmaZeroed == XAIE_ENABLE) {
+				continue;
+			}
+
 			/* Zeroize data memory */
 			RegAddr = MemMod->MemAddr +
 				_XAie_GetTileAddr(DevInst, R, C);
@@ -499,5 +512,120 @@ AieRC _XAie_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 	return XAIE_OK;
 }
 
+
+/*****************************************************************************/
+/**
+* This API returns the topmost row of a column which has a tile in use.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Col: Column
+*
+* @return	Topmost row in use, 0 if no tile of the column is in use.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_PmGetTopRowInUse(XAie_DevInst *DevInst, u8 Col)
+{
+	for(u8 R = DevInst->NumRows - 1U; R > 0U; R--) {
+		u32 Bit = _XAie_GetTileBitPosFromLoc(DevInst,
+				XAie_TileLoc(Col, R));
+
+		if(CheckBit(DevInst->DevOps->TilesInUse, Bit)) {
+			return R;
+		}
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a column was already processed by a previous entry of
+* the tiles array.
+*
+* @param	Args: Backend tile args
+* @param	Idx: Index of the current entry
+*
+* @return	XAIE_ENABLE if the column was processed, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_PmIsColDone(XAie_BackendTilesArray *Args, u32 Idx)
+{
+	for(u32 j = 0U; j < Idx; j++) {
+		if((Args->Locs[j].Col == Args->Locs[Idx].Col) &&
+				(Args->Locs[j].Row != 0U)) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API gates clock for all the tiles passed as argument to this API.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Args: Backend tile args
+*
+* @return	XAIE_OK on success, error code on failure
+*
+* @note		Internal only. The tiles above the topmost
+*		tile in use of a column are gated. If no tile of the column is
+*		in use, the column clock buffer is disabled.
+*
+*******************************************************************************/
+AieRC _XAie_ReleaseTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
+{
+	u32 StartBit = _XAie_GetTileBitPosFromLoc(DevInst, XAie_TileLoc(0, 1));
+
+	if(Args->Locs == NULL) {
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse, StartBit,
+				(DevInst->NumRows - 1U) * DevInst->NumCols);
+
+		return _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+	}
+
+	for(u32 i = 0; i < Args->NumTiles; i++) {
+		if(Args->Locs[i].Row == 0) {
+			continue;
+		}
+
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse,
+				_XAie_GetTileBitPosFromLoc(DevInst,
+					Args->Locs[i]), 1U);
+	}
+
+	for(u32 i = 0; i < Args->NumTiles; i++) {
+		XAie_LocType TileLoc;
+		u8 TopRow;
+
+		if((Args->Locs[i].Row == 0) || _XAie_PmIsColDone(Args, i)) {
+			continue;
+		}
+
+		TileLoc.Col = Args->Locs[i].Col;
+		TopRow = _XAie_PmGetTopRowInUse(DevInst, TileLoc.Col);
+		if(TopRow == 0U) {
+			TileLoc.Row = 0U;
+			_XAie_PmSetColumnClockBuffer(DevInst, TileLoc,
+					XAIE_DISABLE);
+			continue;
+		}
+
+		/* The tiles below the topmost tile in use remain ungated */
+		TileLoc.Row = TopRow;
+		_XAie_PmGateTiles(DevInst, TileLoc);
+		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse,
+				_XAie_GetTileBitPosFromLoc(DevInst,
+					XAie_TileLoc(TileLoc.Col, 1)), TopRow);
+	}
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
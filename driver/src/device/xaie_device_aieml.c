@@ -330,8 +330,119 @@ AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args)
 			return RC;
 		}
 
+		/* The column clock buffer ungates all the column tiles */
 		_XAie_SetBitInBitmap(DevInst->DevOps->TilesInUse,
-				ColClockStatus, DevInst->NumRows);
+				_XAie_GetTileBitPosFromLoc(DevInst,
+					XAie_TileLoc(Args->Locs[i].Col, 1)),
+				DevInst->NumRows - 1U);
+	}
+
+	return XAIE_OK;
+}
+
+
+/*****************************************************************************/
+/**
+* This API returns the topmost row of a column which has a tile in use.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Col: Column
+*
+* @return	Topmost row in use, 0 if no tile of the column is in use.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAieMl_PmGetTopRowInUse(XAie_DevInst *DevInst, u8 Col)
+{
+	for(u8 R = DevInst->NumRows - 1U; R > 0U; R--) {
+		u32 Bit = _XAie_GetTileBitPosFromLoc(DevInst,
+				XAie_TileLoc(Col, R));
+
+		if(CheckBit(DevInst->DevOps->TilesInUse, Bit)) {
+			return R;
+		}
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+* This API checks if a column was already processed by a previous entry of
+* the tiles array.
+*
+* @param	Args: Backend tile args
+* @param	Idx: Index of the current entry
+*
+* @return	XAIE_ENABLE if the column was processed, XAIE_DISABLE otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAieMl_PmIsColDone(XAie_BackendTilesArray *Args, u32 Idx)
+{
+	for(u32 j = 0U; j < Idx; j++) {
+		if((Args->Locs[j].Col == Args->Locs[Idx].Col) &&
+				(Args->Locs[j].Row != 0U)) {
+			return XAIE_ENABLE;
+		}
+	}
+
+	return XAIE_DISABLE;
+}
+
+/*****************************************************************************/
+/**
+* This API gates clock for all the tiles passed as argument to this API.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Args: Backend tile args
+*
+* @return	XAIE_OK on success, error code on failure
+*
+* @note		Internal only. The column clock buffer is
+*		disabled once no tile of the column is in use.
+*
+*******************************************************************************/
+AieRC _XAieMl_ReleaseTiles(XAie_DevInst *DevInst,
+		XAie_BackendTilesArray *Args)
+{
+	u32 StartBit = _XAie_GetTileBitPosFromLoc(DevInst, XAie_TileLoc(0, 1));
+
+	if(Args->Locs == NULL) {
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse, StartBit,
+				(DevInst->NumRows - 1U) * DevInst->NumCols);
+
+		return _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
+	}
+
+	for(u32 i = 0; i < Args->NumTiles; i++) {
+		if(Args->Locs[i].Row == 0) {
+			continue;
+		}
+
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse,
+				_XAie_GetTileBitPosFromLoc(DevInst,
+					Args->Locs[i]), 1U);
+	}
+
+	for(u32 i = 0; i < Args->NumTiles; i++) {
+		AieRC RC;
+
+		if((Args->Locs[i].Row == 0) || _XAieMl_PmIsColDone(Args, i) ||
+				(_XAieMl_PmGetTopRowInUse(DevInst,
+					Args->Locs[i].Col) != 0U)) {
+			continue;
+		}
+
+		RC = _XAieMl_PmSetColumnClockBuffer(DevInst, Args->Locs[i],
+				XAIE_DISABLE);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to disable clock for column: %d\n",
+					Args->Locs[i].Col);
+			return RC;
+		}
 	}
 
 	return XAIE_OK;
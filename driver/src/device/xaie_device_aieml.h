@@ -31,6 +31,7 @@ AieRC _XAieMl_SetPartColClockAfterRst(XAie_DevInst *DevInst, u8 Enable);
 AieRC _XAieMl_SetPartIsolationAfterRst(XAie_DevInst *DevInst);
 AieRC _XAieMl_PartMemZeroInit(XAie_DevInst *DevInst);
 AieRC _XAieMl_RequestTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args);
+AieRC _XAieMl_ReleaseTiles(XAie_DevInst *DevInst, XAie_BackendTilesArray *Args);
 
 #endif /* XAIE_DEVICE_AIEML */
 /** @} */
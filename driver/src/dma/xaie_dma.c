@@ -77,13 +77,13 @@ AieRC XAie_DmaDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 
 	memset((void *)DmaDesc, 0U, sizeof(XAie_DmaDesc));
 
@@ -91,7 +91,7 @@ AieRC XAie_DmaDescInit(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 	DmaDesc->TileType = TileType;
 	DmaDesc->IsReady = XAIE_COMPONENT_IS_READY;
 	DmaDesc->DmaMod = DmaMod;
-	DmaDesc->LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	DmaDesc->LockMod = _XAie_GetDevMod(DevInst)[TileType].LockMod;
 
 	return XAIE_OK;
 }
@@ -767,7 +767,7 @@ AieRC XAie_DmaWriteBd(XAie_DevInst *DevInst, XAie_DmaDesc *DmaDesc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	if(DmaDesc->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+	if(DmaDesc->TileType != _XAie_DevGetTTypefromLoc(DevInst, Loc)) {
 		XAIE_ERROR("Tile type mismatch\n");
 		return XAIE_INVALID_TILE;
 	}
@@ -821,14 +821,14 @@ AieRC XAie_DmaChannelReset(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
 			(TileType == XAIEGBL_TILE_TYPE_SHIMNOC)) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -876,13 +876,13 @@ AieRC XAie_DmaChannelResetAll(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 
 	/* Reset MM2S */
 	for(u8 i = 0U; i < DmaMod->NumChannels; i++) {
@@ -943,13 +943,13 @@ AieRC XAie_DmaChannelPauseStream(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1006,13 +1006,13 @@ AieRC XAie_DmaChannelPauseMem(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_ERR;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1065,13 +1065,13 @@ AieRC XAie_DmaChannelPushBdToQueue(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1129,13 +1129,13 @@ static AieRC _XAie_DmaChannelControl(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1227,13 +1227,13 @@ AieRC XAie_DmaGetPendingBdCount(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1275,13 +1275,13 @@ AieRC XAie_DmaWaitForDone(XAie_DevInst *DevInst, XAie_LocType Loc, u8 ChNum,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -1319,7 +1319,7 @@ AieRC XAie_DmaGetMaxQueueSize(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -1406,14 +1406,14 @@ AieRC XAie_DmaChannelSetStartQueueGeneric(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL ||
 		TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type to start queue\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(DmaMod->RepeatCount == XAIE_FEATURE_UNAVAILABLE) {
 		XAIE_ERROR("Repeat count feature in start queue is not supported for this device generation\n");
 		return XAIE_FEATURE_NOT_SUPPORTED;
@@ -1494,13 +1494,13 @@ AieRC XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Len,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(BdNum > DmaMod->NumBds) {
 		XAIE_ERROR("Invalid BD number\n");
 		return XAIE_INVALID_BD_NUM;
@@ -1540,13 +1540,13 @@ AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 	if(BdNum > DmaMod->NumBds) {
 		XAIE_ERROR("Invalid BD number\n");
 		return XAIE_INVALID_BD_NUM;
@@ -1590,13 +1590,13 @@ AieRC XAie_DmaChannelDescInit(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
 
 	memset((void *)DmaChannelDesc, 0U, sizeof(XAie_DmaChannelDesc));
 
@@ -1816,12 +1816,12 @@ AieRC XAie_DmaWriteChannel(XAie_DevInst *DevInst,
 		return XAIE_INVALID_DMA_DESC;
 	}
 
-	if(DmaChannelDesc->TileType != DevInst->DevOps->GetTTypefromLoc(DevInst, Loc)) {
+	if(DmaChannelDesc->TileType != _XAie_DevGetTTypefromLoc(DevInst, Loc)) {
 		XAIE_ERROR("Tile type mismatch\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	DmaMod = DevInst->DevProp.DevMod[DmaChannelDesc->TileType].DmaMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[DmaChannelDesc->TileType].DmaMod;
 	if(ChNum > DmaMod->NumChannels) {
 		XAIE_ERROR("Invalid Channel number\n");
 		return XAIE_INVALID_CHANNEL_NUM;
@@ -2039,5 +2039,124 @@ AieRC XAie_DmaTlastDisable(XAie_DmaDesc *DmaDesc)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API initializes a DMA channel handle. The tile, the channel number and
+* the direction are validated once and the absolute address of the start queue
+* register of the channel is cached in the handle, so that
+* XAie_DmaChannelHandlePushBd() only checks the BD number before the write.
+*
+* @param	DevInst: Device Instance.
+* @param	Handle: DMA channel handle to initialize.
+* @param	Loc: Location of AIE Tile
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA Channel. (MM2S or S2MM)
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The handle stays valid as long as the device instance does.
+*
+******************************************************************************/
+AieRC XAie_DmaChannelHandleInit(XAie_DevInst *DevInst,
+		XAie_DmaChannelHandle *Handle, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir)
+{
+	u8 TileType;
+	const XAie_DmaMod *DmaMod;
+
+	if((DevInst == XAIE_NULL) || (Handle == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or Handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Dir >= DMA_MAX) {
+		XAIE_ERROR("Invalid DMA direction\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if((TileType == XAIEGBL_TILE_TYPE_SHIMPL) ||
+			(TileType == XAIEGBL_TILE_TYPE_MAX)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	DmaMod = _XAie_GetDevMod(DevInst)[TileType].DmaMod;
+	if(ChNum >= DmaMod->NumChannels) {
+		XAIE_ERROR("Invalid Channel number\n");
+		return XAIE_INVALID_CHANNEL_NUM;
+	}
+
+	Handle->DevInst = DevInst;
+	Handle->DmaMod = DmaMod;
+	Handle->Loc = Loc;
+	Handle->StartQueueAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		DmaMod->ChCtrlBase + ChNum * DmaMod->ChIdxOffset +
+		Dir * DmaMod->ChIdxOffset * DmaMod->NumChannels +
+		(DmaMod->ChProp->StartBd.Idx * 4U);
+	Handle->Dir = Dir;
+	Handle->ChNum = ChNum;
+	Handle->NumBds = DmaMod->NumBds;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pushes a buffer descriptor to the start queue of the channel of a
+* DMA channel handle.
+*
+* @param	Handle: DMA channel handle initialized with
+*		XAie_DmaChannelHandleInit().
+* @param	BdNum: Buffer descriptor number.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Only the range of the BD number is checked. For memory tiles,
+*		the BD must belong to the BD range of the channel, as for
+*		XAie_DmaChannelPushBdToQueue().
+*
+******************************************************************************/
+AieRC XAie_DmaChannelHandlePushBd(const XAie_DmaChannelHandle *Handle,
+		u8 BdNum)
+{
+	if(BdNum >= Handle->NumBds) {
+		XAIE_ERROR("Invalid BD number\n");
+		return XAIE_INVALID_BD_NUM;
+	}
+
+	return XAie_Write32(Handle->DevInst, Handle->StartQueueAddr, BdNum);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits for the channel of a DMA channel handle to complete all the
+* buffer descriptors in its queue.
+*
+* @param	Handle: DMA channel handle initialized with
+*		XAie_DmaChannelHandleInit().
+* @param	TimeOutUs: Minimum timeout value in micro seconds. If 0, the
+*		default timeout of XAie_DmaWaitForDone() is used.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_DmaChannelHandleWaitForDone(const XAie_DmaChannelHandle *Handle,
+		u32 TimeOutUs)
+{
+	if(TimeOutUs == 0U) {
+		TimeOutUs = XAIE_DMA_WAITFORDONE_DEF_WAIT_TIME_US;
+	}
+
+	return Handle->DmaMod->WaitforDone(Handle->DevInst, Handle->Loc,
+			Handle->DmaMod, Handle->ChNum, Handle->Dir, TimeOutUs);
+}
+
 #endif /* XAIE_FEATURE_DMA_ENABLE */
 /** @} */
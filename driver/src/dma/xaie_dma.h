@@ -40,6 +40,20 @@ typedef enum {
 	XAIE_DMA_FIFO_COUNTER_1 = 3U,
 } XAie_DmaFifoCounter;
 
+/*
+ * DMA channel handle with the validated channel and the absolute address of
+ * its start queue register. Initialized with XAie_DmaChannelHandleInit().
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	const XAie_DmaMod *DmaMod;
+	XAie_LocType Loc;
+	u64 StartQueueAddr;
+	XAie_DmaDirection Dir;
+	u8 ChNum;
+	u8 NumBds;
+} XAie_DmaChannelHandle;
+
 /************************** Function Prototypes  *****************************/
 
 /*****************************************************************************/
@@ -145,5 +159,12 @@ AieRC XAie_DmaUpdateBdLen(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Len,
 		u8 BdNum);
 AieRC XAie_DmaUpdateBdAddr(XAie_DevInst *DevInst, XAie_LocType Loc, u64 Addr,
 		u8 BdNum);
+AieRC XAie_DmaChannelHandleInit(XAie_DevInst *DevInst,
+		XAie_DmaChannelHandle *Handle, XAie_LocType Loc, u8 ChNum,
+		XAie_DmaDirection Dir);
+AieRC XAie_DmaChannelHandlePushBd(const XAie_DmaChannelHandle *Handle,
+		u8 BdNum);
+AieRC XAie_DmaChannelHandleWaitForDone(const XAie_DmaChannelHandle *Handle,
+		u32 TimeOutUs);
 
 #endif		/* end of protection macro */
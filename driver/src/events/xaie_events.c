@@ -28,9 +28,14 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
 #include "xaie_events.h"
+#include "xaie_events_internal.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
+#include "xaie_rsc.h"
 
 #ifdef XAIE_FEATURE_EVENTS_ENABLE
 
@@ -1580,5 +1585,246 @@ AieRC XAie_EventGetUserEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return RC;
 }
 
+/*****************************************************************************/
+/**
+* This API returns the broadcast event enum given a broadcast channel id for the
+* given tile and module.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of Tile
+* @param	Mod: Module type
+* @param	BcastId: Broadcast channel id
+*
+* @return	Event enum on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+XAie_Events _XAie_EventGetBroadcastEvent(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Mod, u8 BcastId)
+{
+	u8 TileType;
+	const XAie_EvntMod *EvntMod;
+
+	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+
+	if(Mod == XAIE_PL_MOD)
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+	else
+		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+
+	return EvntMod->BroadcastEventMap->Event + BcastId;
+}
+
+/*****************************************************************************/
+/**
+* This API blocks the east/west propagation of the partition wide broadcast
+* channel in a tile module so that the event raised by the shim row travels
+* only northwards through each column.
+*
+* @param	DevInst: Device Instance
+* @param	Rsc: Broadcast channel resource of the tile module
+* @param	BcastId: Broadcast channel id
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. AIE tiles of the first generation are
+*		checkerboarded, so the direction to block depends on the row.
+*
+*******************************************************************************/
+static AieRC _XAie_EventBcastNetworkBlockDir(XAie_DevInst *DevInst,
+		XAie_UserRsc *Rsc, u8 BcastId)
+{
+	u8 TileType, Dir;
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rsc->Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
+		if(Rsc->Mod == XAIE_MEM_MOD) {
+			Dir = XAIE_EVENT_BROADCAST_EAST;
+		} else {
+			Dir = XAIE_EVENT_BROADCAST_WEST;
+		}
+
+		/* Checker board structure */
+		if((DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) &&
+				((Rsc->Loc.Row % 2U) == 0U)) {
+			Dir = (Dir == XAIE_EVENT_BROADCAST_EAST) ?
+				XAIE_EVENT_BROADCAST_WEST :
+				XAIE_EVENT_BROADCAST_EAST;
+		}
+	} else if(Rsc->Loc.Row != 0U) {
+		Dir = XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST;
+	} else {
+		return XAIE_OK;
+	}
+
+	return XAie_EventBroadcastBlockDir(DevInst, Rsc->Loc, Rsc->Mod,
+			XAIE_EVENT_SWITCH_A, BcastId, Dir);
+}
+
+/*****************************************************************************/
+/**
+* This API sets up a partition wide broadcast network. It reserves a broadcast
+* channel across all the ungated tiles of the partition and another one along
+* the shim row. An event generated in the shim tile of the first column with
+* XAie_EventGenerate(Net->ShimBcastEvent) propagates along the shim row and
+* then northwards through every column, so that every module of the partition
+* observes the broadcast event of channel Net->BcastChannelId in the same
+* cycle relative to its column.
+*
+* @param	DevInst: Device Instance
+* @param	Net: Pointer to the broadcast network to populate
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The resources are released with
+*		_XAie_EventBcastNetworkTeardown().
+*
+*******************************************************************************/
+AieRC _XAie_EventBcastNetworkSetup(XAie_DevInst *DevInst,
+		XAie_BcastNetwork *Net)
+{
+	AieRC RC;
+	u32 UserRscNum = 0;
+
+	for(u8 i = 0; i < XAIEGBL_TILE_TYPE_MAX; i++) {
+		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
+			continue;
+		UserRscNum += (DevInst->DevProp.DevMod[i].NumModules) *
+			_XAie_GetNumRows(DevInst, i) * DevInst->NumCols;
+	}
+
+	memset((void *)Net, 0, sizeof(*Net));
+	Net->Rscs = (XAie_UserRsc *)malloc(UserRscNum * sizeof(XAie_UserRsc));
+	if(Net->Rscs == NULL) {
+		XAIE_ERROR("Unable to allocate memory for resource\n");
+		return XAIE_ERR;
+	}
+
+	Net->NumShimRscs = DevInst->NumCols;
+	Net->ShimRscs = (XAie_UserRsc *)malloc(DevInst->NumCols *
+			sizeof(XAie_UserRsc));
+	if(Net->ShimRscs == NULL) {
+		XAIE_ERROR("Unable to allocate memory for resource\n");
+		free(Net->Rscs);
+		return XAIE_ERR;
+	}
+
+	/* Reserve a free BC across partition */
+	Net->NumRscs = UserRscNum;
+	RC = XAie_RequestBroadcastChannel(DevInst, &Net->NumRscs, Net->Rscs,
+			1U);
+	if(RC != XAIE_OK) {
+		free(Net->Rscs);
+		free(Net->ShimRscs);
+		return RC;
+	}
+	Net->BcastChannelId = (u8)Net->Rscs[0].RscId;
+
+	/* Reserve a free BC along the shim row */
+	for(u32 i = 0; i < Net->NumShimRscs; i++) {
+		Net->ShimRscs[i].Loc = XAie_TileLoc(i, 0);
+		Net->ShimRscs[i].Mod = XAIE_PL_MOD;
+		Net->ShimRscs[i].RscType = XAIE_BCAST_CHANNEL_RSC;
+	}
+	RC = XAie_RequestBroadcastChannel(DevInst, &Net->NumShimRscs,
+			Net->ShimRscs, 0U);
+	if(RC != XAIE_OK) {
+		XAie_ReleaseBroadcastChannel(DevInst, Net->NumRscs, Net->Rscs);
+		free(Net->Rscs);
+		free(Net->ShimRscs);
+		return RC;
+	}
+	Net->ShimBcastChannelId = (u8)Net->ShimRscs[0].RscId;
+
+	Net->ShimBcastEvent = _XAie_EventGetBroadcastEvent(DevInst,
+		XAie_TileLoc(0, 0), XAIE_PL_MOD, Net->ShimBcastChannelId);
+
+	/* Blocking unncessary broadcasting */
+	for(u32 j = 0; j < Net->NumRscs; j++) {
+		RC = _XAie_EventBcastNetworkBlockDir(DevInst, &Net->Rscs[j],
+				Net->BcastChannelId);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to setup broadcast network.\n");
+			_XAie_EventBcastNetworkTeardown(DevInst, Net);
+			return RC;
+		}
+	}
+
+	for(u32 i = 0; i < DevInst->NumCols; i++) {
+		XAie_LocType Loc = XAie_TileLoc(i, 0);
+
+		RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
+				Net->BcastChannelId, Net->ShimBcastEvent);
+		if((RC == XAIE_OK) && (i == 0)) {
+			RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
+				Net->ShimBcastChannelId, Net->ShimBcastEvent);
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to configure shim broadcast event\n");
+			_XAie_EventBcastNetworkTeardown(DevInst, Net);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API clears the broadcast configuration of a partition wide broadcast
+* network and releases its broadcast channels.
+*
+* @param	DevInst: Device Instance
+* @param	Net: Pointer to the broadcast network
+*
+* @return	None.
+*
+* @note		Internal only. Clearing continues even if some of the register
+*		writes fail.
+*
+*******************************************************************************/
+void _XAie_EventBcastNetworkTeardown(XAie_DevInst *DevInst,
+		XAie_BcastNetwork *Net)
+{
+	AieRC RC;
+
+	if(Net->Rscs == NULL) {
+		return;
+	}
+
+	/* Clear broadcast setting */
+	for(u32 j = 0; j < Net->NumRscs; j++) {
+		if(Net->Rscs[j].Loc.Row == 0) {
+			/* If it is SHIM tile, skip */
+			continue;
+		}
+		RC = XAie_EventBroadcastUnblockDir(DevInst,
+			Net->Rscs[j].Loc, Net->Rscs[j].Mod,
+			XAIE_EVENT_SWITCH_A, Net->BcastChannelId,
+			XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to clear broadcast setting.\n");
+			/* Will continue clearning even if it failes */
+		}
+	}
+
+	/* Clear shim broadcast configuration */
+	for(u32 i = 0; i < DevInst->NumCols; i++) {
+		XAie_EventBroadcast(DevInst, XAie_TileLoc(i, 0), XAIE_PL_MOD,
+			Net->BcastChannelId, XAIE_EVENT_NONE_PL);
+	}
+	XAie_EventBroadcast(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
+		Net->ShimBcastChannelId, XAIE_EVENT_NONE_PL);
+
+	/* Release broadcast channel across partition */
+	XAie_ReleaseBroadcastChannel(DevInst, Net->NumRscs, Net->Rscs);
+	XAie_ReleaseBroadcastChannel(DevInst, Net->NumShimRscs, Net->ShimRscs);
+	free(Net->Rscs);
+	free(Net->ShimRscs);
+	Net->Rscs = NULL;
+	Net->ShimRscs = NULL;
+}
+
 #endif /* XAIE_FEATURE_EVENTS_ENABLE */
 /** @} */
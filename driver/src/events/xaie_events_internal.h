@@ -0,0 +1,49 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_events_internal.h
+* @{
+*
+* Header file for the internal routines of the AIE events module, shared with
+* the other modules of the driver. Not part of the driver API.
+*
+******************************************************************************/
+#ifndef XAIE_EVENTS_INTERNAL_H
+#define XAIE_EVENTS_INTERNAL_H
+
+/***************************** Include Files *********************************/
+#include "xaie_events.h"
+#include "xaie_rsc.h"
+#include "xaiegbl.h"
+
+/**************************** Type Definitions *******************************/
+/*
+ * This structure captures a partition wide broadcast network. An event
+ * generated on the shim tile of the first column reaches every ungated module
+ * of the partition on channel BcastChannelId.
+ */
+typedef struct XAie_BcastNetwork {
+	u32 NumRscs;			/* Number of partition wide resources */
+	XAie_UserRsc *Rscs;		/* Partition wide channel resources */
+	u32 NumShimRscs;		/* Number of shim row resources */
+	XAie_UserRsc *ShimRscs;		/* Shim row channel resources */
+	u8 BcastChannelId;		/* Partition wide channel id */
+	u8 ShimBcastChannelId;		/* Shim row channel id */
+	XAie_Events ShimBcastEvent;	/* Event to generate on shim (0, 0) */
+} XAie_BcastNetwork;
+
+/************************** Function Prototypes  *****************************/
+XAie_Events _XAie_EventGetBroadcastEvent(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_ModuleType Mod, u8 BcastId);
+AieRC _XAie_EventBcastNetworkSetup(XAie_DevInst *DevInst,
+		XAie_BcastNetwork *Net);
+void _XAie_EventBcastNetworkTeardown(XAie_DevInst *DevInst,
+		XAie_BcastNetwork *Net);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -44,6 +44,11 @@
 *    * XAIE_FEATURE_RSC_ENABLE: AIE resource management APIs
 *    * XAIE_FEATURE_INTR_INIT_ENABLE: AIE interrupt network initialization APIs
 *
+* The following feature is not part of any group and has to be defined
+* explicitly:
+*  * XAIE_FEATURE_IO_STATS_ENABLE: count and time the IO operations issued to
+*    the backend, see XAie_GetIoStats() and XAie_GetIoCallerStats()
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
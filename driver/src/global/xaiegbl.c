@@ -47,24 +47,6 @@
 #define XAIE_ECC_BROADCAST_ID		6U
 
 /************************** Variable Definitions *****************************/
-extern XAie_TileMod AieMod[XAIEGBL_TILE_TYPE_MAX];
-extern XAie_TileMod AieMlMod[XAIEGBL_TILE_TYPE_MAX];
-
-extern XAie_DeviceOps AieDevOps;
-extern XAie_DeviceOps AieMlDevOps;
-
-#if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
-#define XAIE_DEV_SINGLE_MOD AieMlMod
-#define XAIE_DEV_SINGLE_DEVOPS AieMlDevOps
-#elif XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIE
-#define XAIE_DEV_SINGLE_MOD AieMod
-#define XAIE_DEV_SINGLE_DEVOPS AieDevOps
-#else
-#ifdef XAIE_DEV_SINGLE_GEN
-#error "Unsupported device defined."
-#endif
-#endif
-
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -179,6 +161,12 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 	InstPtr->AieTileNumRows = ConfigPtr->AieTileNumRows;
 	InstPtr->EccStatus = XAIE_ENABLE;
 	InstPtr->TxnList.Next = NULL;
+	InstPtr->TxnQueue = NULL;
+	InstPtr->ShadowRegs = NULL;
+	InstPtr->ElfLoadRecs = NULL;
+	InstPtr->StrmPortMap = NULL;
+	InstPtr->PmLazy = NULL;
+	memset(&InstPtr->PartTimes, 0, sizeof(InstPtr->PartTimes));
 
 	RC = _XAie_RscMgrInit(InstPtr);
 	if(RC != XAIE_OK) {
@@ -188,7 +176,7 @@ AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr)
 	memcpy(&InstPtr->PartProp, &ConfigPtr->PartProp,
 		sizeof(ConfigPtr->PartProp));
 
-	RC = XAie_IOInit(InstPtr);
+	RC = XAie_IOInit(InstPtr, ConfigPtr->BackendName);
 	if(RC != XAIE_OK) {
 		return RC;
 	}
@@ -277,6 +265,35 @@ AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst)
 
 	return XAIE_OK;
 }
+
+/*****************************************************************************/
+/**
+*
+* This is the api to get the timing breakdown of the last partition
+* initialization or teardown done by the driver.
+*
+* @param	DevInst - Global AIE device instance pointer.
+* @param	Times - Pointer to return the time spent in each phase.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		The times are not updated when the partition is initialized
+*		by the backend, e.g. by the kernel driver.
+*
+******************************************************************************/
+AieRC XAie_GetPartitionPhaseTimes(XAie_DevInst *DevInst,
+		XAie_PartPhaseTimes *Times)
+{
+	if((DevInst == XAIE_NULL) || (Times == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Times = DevInst->PartTimes;
+
+	return XAIE_OK;
+}
 #endif /* !XAIE_FEATURE_LITE && XAIE_FEATURE_PRIVILEGED_ENABLE */
 
 /*****************************************************************************/
@@ -330,8 +347,15 @@ AieRC XAie_Finish(XAie_DevInst *DevInst)
 		return XAIE_INVALID_ARGS;
 	}
 
+	/* Execute the queued asynchronous transactions, if any */
+	_XAie_TxnAsyncFinish(DevInst);
+
 	/* Free transaction mode resources, if any */
 	_XAie_TxnResourceCleanup(DevInst);
+	_XAie_ShadowFree(DevInst);
+	_XAie_ElfLoadRecsFree(DevInst);
+	_XAie_StrmPortMapFree(DevInst);
+	_XAie_PmLazyFree(DevInst);
 
 	CurrBackend = DevInst->Backend;
 	RC = CurrBackend->Ops.Finish(DevInst->IOInst);
@@ -405,6 +429,54 @@ AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the API to set the IO backend of the driver by name at runtime. The
+* name can be a built-in backend or a backend registered with
+* XAie_RegisterBackend(). Registered backends can be stacked on top of another
+* backend with a comma separated list of names, top most backend first.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Name - Name of the backend stack.
+*
+* @return	XAIE_OK on success and error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_SetIOBackendByName(XAie_DevInst *DevInst, const char *Name)
+{
+	AieRC RC;
+	const XAie_Backend *CurrBackend;
+
+	if((DevInst == XAIE_NULL) || (Name == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Release resources for current backend */
+	CurrBackend = DevInst->Backend;
+	RC = CurrBackend->Ops.Finish((void *)(DevInst->IOInst));
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to close backend instance."
+				"Falling back to backend %d\n",
+				CurrBackend->Type);
+		return RC;
+	}
+
+	RC = XAie_IOInit(DevInst, Name);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to initialize backend %s\n", Name);
+		return RC;
+	}
+
+	XAIE_DBG("Switching backend to %s\n", Name);
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -706,7 +778,7 @@ AieRC XAie_TurnEccOn(XAie_DevInst *DevInst)
 			i == XAIEGBL_TILE_TYPE_SHIMPL) {
 			UserRscNum += DevInst->NumCols;
 		} else {
-			UserRscNum += (DevInst->DevProp.DevMod[i].NumModules) *
+			UserRscNum += (_XAie_GetDevMod(DevInst)[i].NumModules) *
 				_XAie_GetNumRows(DevInst, i) * DevInst->NumCols;
 		}
 	}
@@ -888,4 +960,98 @@ AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr)
 			(void *)&NpiAddr);
 }
 
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the write combining mode of the IO backend. In
+* write combining mode, register writes issued outside of a transaction are
+* queued in a per thread buffer by the backend and submitted together. The
+* buffer is flushed before any read, poll, memory access or backend operation
+* of the same thread, when it is full, on XAie_WriteFence() and when the thread
+* exits.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Enable - XAIE_ENABLE to enable, XAIE_DISABLE to disable.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support write combining, error code on failure.
+*
+* @note		Only the Linux kernel backend supports write combining. Writes
+*		queued by a thread are not visible to reads of other threads
+*		until they are flushed. Disabling the mode flushes the writes
+*		queued by the calling thread. The writes queued by other
+*		threads are flushed by their next register access or when they
+*		exit.
+*
+******************************************************************************/
+AieRC XAie_ConfigWriteCombine(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE,
+			(void *)&Enable);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API flushes the register writes queued by the calling thread in write
+* combining mode.
+*
+* @param	DevInst - Device instance pointer.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		does not support write combining, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_WriteFence(XAie_DevInst *DevInst)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_WRITE_FENCE, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables or disables the trusted mode of the IO backend. In trusted
+* mode, the register space of the partition is mapped writable and writes to
+* DMA buffer descriptors, DMA channel controls, lock values and stream switch
+* port configurations are done with direct stores instead of kernel calls.
+* Masked writes which do not cover the full word, and writes to all the other
+* registers, keep going through the kernel.
+*
+* @param	DevInst - Device instance pointer.
+* @param	Enable - XAIE_ENABLE to enable, XAIE_DISABLE to disable.
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the backend
+*		or the kernel does not support trusted mode, error code on
+*		failure.
+*
+* @note		Only the Linux kernel backend supports trusted mode. SHIM DMA
+*		buffer descriptors are always written through the kernel.
+*
+******************************************************************************/
+AieRC XAie_ConfigTrustedMode(XAie_DevInst *DevInst, u8 Enable)
+{
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_CONFIG_TRUSTED_MODE,
+			(void *)&Enable);
+}
+
 /** @} */
@@ -78,7 +78,7 @@ typedef struct XAie_DevProp {
 	u8 DevGen;
 	u8 RowShift;
 	u8 ColShift;
-	XAie_TileMod *DevMod;
+	const XAie_TileMod *DevMod;
 } XAie_DevProp;
 
 /*
@@ -92,6 +92,8 @@ typedef enum {
 	XAIE_IO_BACKEND_DEBUG, /* IO debug backend */
 	XAIE_IO_BACKEND_LINUX, /* Linux kernel backend */
 	XAIE_IO_BACKEND_SOCKET, /* Socket backend */
+	XAIE_IO_BACKEND_BROKER, /* Multi-process broker client backend */
+	XAIE_IO_BACKEND_CUSTOM, /* Backend registered by the application */
 	XAIE_IO_BACKEND_MAX
 } XAie_BackendType;
 
@@ -116,6 +118,31 @@ typedef struct XAie_List {
 	struct XAie_List *Next;
 } XAie_List;
 
+/* Phases of the AI engine partition initialization and teardown */
+typedef enum {
+	XAIE_PART_PHASE_PROT_REGS,	/* Protected registers enable/disable */
+	XAIE_PART_PHASE_CLOCK,		/* Column clock buffers */
+	XAIE_PART_PHASE_COL_RST,	/* Column reset */
+	XAIE_PART_PHASE_SHIM_RST,	/* Shim reset */
+	XAIE_PART_PHASE_AXIMM_ERR,	/* NoC AXI MM error blocking */
+	XAIE_PART_PHASE_CLOCK_AFTER_RST, /* Tile clocks after reset */
+	XAIE_PART_PHASE_ISOLATE,	/* Partition isolation */
+	XAIE_PART_PHASE_MEM_ZERO,	/* Memory zeroization */
+	XAIE_PART_PHASE_IRQ,		/* L2 error and NPI interrupts */
+	XAIE_PART_PHASE_MAX
+} XAie_PartPhase;
+
+/*
+ * Timing breakdown of the last partition initialization or teardown. Time is
+ * only measured on Linux, elsewhere the times are 0.
+ */
+typedef struct {
+	u64 PhaseNs[XAIE_PART_PHASE_MAX];	/* Time spent in each phase */
+	u32 PhaseRuns[XAIE_PART_PHASE_MAX];	/* Number of runs of a phase */
+	u32 NumBatched;		/* Phases submitted as one transaction */
+	u64 TotalNs;		/* Time of the whole operation */
+} XAie_PartPhaseTimes;
+
 /*
  * This typedef contains the attributes for an AIE partition. The structure is
  * setup during intialization.
@@ -137,9 +164,15 @@ typedef struct {
 	void *IOInst;	       /* IO Instance for the backend */
 	XAie_DevProp DevProp; /* Pointer to the device property. To be
 				     setup to AIE prop during intialization*/
-	XAie_DeviceOps *DevOps; /* Device level operations */
+	const XAie_DeviceOps *DevOps; /* Device level operations */
 	XAie_PartitionProp PartProp; /* Partition property */
 	XAie_List TxnList; /* Head of the list of txn buffers */
+	struct XAie_TxnQueue *TxnQueue; /* Asynchronous transaction queue */
+	struct XAie_ShadowRegs *ShadowRegs; /* Shadow register cache */
+	struct XAie_ElfLoadRecs *ElfLoadRecs; /* Images loaded to the tiles */
+	struct XAie_StrmPortMap *StrmPortMap; /* Used stream switch ports */
+	XAie_PartPhaseTimes PartTimes; /* Last partition init/teardown times */
+	struct XAie_PmLazy *PmLazy; /* Lazy tile power up state */
 } XAie_DevInst;
 
 /* typedef to capture transaction buffer data */
@@ -181,6 +214,9 @@ typedef struct {
 	u8 AieTileRowStart;
 	u8 AieTileNumRows;
 	XAie_PartitionProp PartProp;
+	const char *BackendName; /* IO backend stack to be used. If NULL, the
+				  * XAIE_IO_BACKEND environment variable or
+				  * the default backend is used. */
 } XAie_Config;
 
 /*
@@ -423,6 +459,17 @@ typedef enum{
 	XAIE_ERR_MAX
 } AieRC;
 
+/* Completion handle of an asynchronously submitted transaction */
+typedef struct XAie_TxnHandle XAie_TxnHandle;
+
+/*
+ * Completion callback of an asynchronously submitted transaction. It is called
+ * from the submission worker thread with the status of the transaction and the
+ * private data passed at submission, after the handle is marked completed. The
+ * handle is not passed, as a waiter may have freed it already.
+ */
+typedef void (*XAie_TxnCallback)(AieRC Status, void *Priv);
+
 /*
  * This enum is to identify different hardware modules within a tile type.
  * An AIE tile can have memory or core module. A PL or Shim tile will have
@@ -497,8 +544,11 @@ AieRC XAie_SetupPartitionConfig(XAie_DevInst *DevInst,
 AieRC XAie_CfgInitialize(XAie_DevInst *InstPtr, XAie_Config *ConfigPtr);
 AieRC XAie_PartitionInitialize(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts);
 AieRC XAie_PartitionTeardown(XAie_DevInst *DevInst);
+AieRC XAie_GetPartitionPhaseTimes(XAie_DevInst *DevInst,
+		XAie_PartPhaseTimes *Times);
 AieRC XAie_Finish(XAie_DevInst *DevInst);
 AieRC XAie_SetIOBackend(XAie_DevInst *DevInst, XAie_BackendType Backend);
+AieRC XAie_SetIOBackendByName(XAie_DevInst *DevInst, const char *Name);
 XAie_MemInst* XAie_MemAllocate(XAie_DevInst *DevInst, u64 Size,
 		XAie_MemCacheProp Cache);
 AieRC XAie_MemFree(XAie_MemInst *MemInst);
@@ -515,8 +565,23 @@ AieRC XAie_StartTransaction(XAie_DevInst *DevInst, u32 Flags);
 AieRC XAie_SubmitTransaction(XAie_DevInst *DevInst, XAie_TxnInst *TxnInst);
 XAie_TxnInst* XAie_ExportTransactionInstance(XAie_DevInst *DevInst);
 AieRC XAie_FreeTransactionInstance(XAie_TxnInst *TxnInst);
+XAie_TxnHandle* XAie_SubmitTransactionAsync(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, XAie_TxnCallback Callback, void *Priv);
+AieRC XAie_WaitTransaction(XAie_TxnHandle *Handle);
+AieRC XAie_PollTransaction(XAie_TxnHandle *Handle, u8 *IsDone);
+AieRC XAie_FreeTransactionHandle(XAie_TxnHandle *Handle);
+AieRC XAie_WaitAllTransactions(XAie_DevInst *DevInst);
 AieRC XAie_IsDeviceCheckerboard(XAie_DevInst *DevInst, u8 *IsCheckerBoard);
 AieRC XAie_UpdateNpiAddr(XAie_DevInst *DevInst, u64 NpiAddr);
+AieRC XAie_ConfigWriteCombine(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_WriteFence(XAie_DevInst *DevInst);
+AieRC XAie_ConfigTrustedMode(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_BrokerServe(XAie_DevInst *DevInst, const char *Name,
+		const volatile u8 *Stop);
+AieRC XAie_ConfigShadowRegs(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_InvalidateShadowRegs(XAie_DevInst *DevInst);
+AieRC XAie_SubmitTransactionDelta(XAie_DevInst *DevInst,
+		XAie_TxnInst *TxnInst, u32 *NumWr);
 /*****************************************************************************/
 /*
 *
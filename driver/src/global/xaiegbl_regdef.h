@@ -630,6 +630,8 @@ struct XAie_LockMod {
 	AieRC (*SetValue)(XAie_DevInst *DevInst,
 			const struct XAie_LockMod *LockMod, XAie_LocType Loc,
 			XAie_Lock Lock);
+	u32 (*GetRegOff)(const struct XAie_LockMod *LockMod, XAie_Lock Lock,
+			u8 IsAcquire);
 };
 
 /* This typedef contains attributes of Performace Counter module */
@@ -839,6 +841,8 @@ struct XAie_DeviceOps {
 	AieRC (*PartMemZeroInit)(XAie_DevInst *DevInst);
 	AieRC (*RequestTiles)(XAie_DevInst *DevInst,
 			XAie_BackendTilesArray *Args);
+	AieRC (*ReleaseTiles)(XAie_DevInst *DevInst,
+			XAie_BackendTilesArray *Args);
 };
 
 #endif
@@ -1228,6 +1228,7 @@ static const XAie_LockMod AieTileLockMod =
 	.Acquire = &(_XAie_LockAcquire),
 	.Release = &(_XAie_LockRelease),
 	.SetValue = &_XAie_LockSetValue,
+	.GetRegOff = &_XAie_LockGetRegOff,
 };
 
 /* Lock Module for SHIM NOC Tiles  */
@@ -1243,6 +1244,7 @@ static const XAie_LockMod AieShimNocLockMod =
 	.Acquire = &(_XAie_LockAcquire),
 	.Release = &(_XAie_LockRelease),
 	.SetValue = &_XAie_LockSetValue,
+	.GetRegOff = &_XAie_LockGetRegOff,
 };
 #endif /* XAIE_FEATURE_LOCK_ENABLE */
 
@@ -3191,7 +3193,7 @@ static const XAie_TileCtrlMod AieShimTileCtrlMod =
  * Depending on the tile type, this data strcuture can be used to access all
  * hardware properties of individual modules.
  */
-XAie_TileMod AieMod[] =
+const XAie_TileMod AieMod[] =
 {
 	{
 		/*
@@ -3280,7 +3282,7 @@ XAie_TileMod AieMod[] =
 };
 
 /* Device level operations for aie */
-XAie_DeviceOps AieDevOps =
+const XAie_DeviceOps AieDevOps =
 {
 	.IsCheckerBoard = 1,
 	.TilesInUse = AieTilesInUse,
@@ -3293,12 +3295,14 @@ XAie_DeviceOps AieDevOps =
 	.SetPartIsolationAfterRst = &_XAie_SetPartIsolationAfterRst,
 	.PartMemZeroInit = &_XAie_PartMemZeroInit,
 	.RequestTiles = &_XAie_RequestTiles,
+	.ReleaseTiles = &_XAie_ReleaseTiles,
 #else
 	.SetPartColShimReset = NULL,
 	.SetPartColClockAfterRst = NULL,
 	.SetPartIsolationAfterRst = NULL,
 	.PartMemZeroInit = NULL,
 	.RequestTiles = NULL,
+	.ReleaseTiles = NULL,
 #endif
 };
 
@@ -2376,6 +2376,7 @@ static const  XAie_LockMod AieMlTileLockMod =
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
+	.GetRegOff = &_XAieMl_LockGetRegOff,
 };
 
 static const XAie_RegFldAttr AieMlShimNocLockInit =
@@ -2400,6 +2401,7 @@ static const  XAie_LockMod AieMlShimNocLockMod =
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
+	.GetRegOff = &_XAieMl_LockGetRegOff,
 };
 
 static const XAie_RegFldAttr AieMlMemTileLockInit =
@@ -2424,6 +2426,7 @@ static const  XAie_LockMod AieMlMemTileLockMod =
 	.Acquire = &_XAieMl_LockAcquire,
 	.Release = &_XAieMl_LockRelease,
 	.SetValue = &_XAieMl_LockSetValue,
+	.GetRegOff = &_XAieMl_LockGetRegOff,
 };
 #endif /* XAIE_FEATURE_LOCK_ENABLE */
 
@@ -4335,7 +4338,7 @@ static const XAie_MemCtrlMod AieMlMemTileMemCtrlMod =
  * Depending on the tile type, this data strcuture can be used to access all
  * hardware properties of individual modules.
  */
-XAie_TileMod AieMlMod[] =
+const XAie_TileMod AieMlMod[] =
 {
 	{
 		/*
@@ -4420,7 +4423,7 @@ XAie_TileMod AieMlMod[] =
 };
 
 /* Device level operations for aieml */
-XAie_DeviceOps AieMlDevOps =
+const XAie_DeviceOps AieMlDevOps =
 {
 	.IsCheckerBoard = 0U,
 	.TilesInUse = AieMlTilesInUse,
@@ -4433,12 +4436,14 @@ XAie_DeviceOps AieMlDevOps =
 	.SetPartIsolationAfterRst = &_XAieMl_SetPartIsolationAfterRst,
 	.PartMemZeroInit = &_XAieMl_PartMemZeroInit,
 	.RequestTiles = &_XAieMl_RequestTiles,
+	.ReleaseTiles = &_XAieMl_ReleaseTiles,
 #else
 	.SetPartColShimReset = NULL,
 	.SetPartColClockAfterRst = NULL,
 	.SetPartIsolationAfterRst = NULL,
 	.PartMemZeroInit = NULL,
 	.RequestTiles = NULL,
+	.ReleaseTiles = NULL,
 #endif
 };
 
@@ -527,12 +527,21 @@ static AieRC XAie_BaremetalIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 		case XAIE_BACKEND_OP_REQUEST_TILES:
 			return _XAie_PrivilegeRequestTiles(DevInst,
 					(XAie_BackendTilesArray *)Arg);
+		case XAIE_BACKEND_OP_RELEASE_TILES:
+			return _XAie_PrivilegeReleaseTiles(DevInst,
+					(XAie_BackendTilesArray *)Arg);
 		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
 			return _XAie_RequestRscCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
 			return _XAie_ReleaseRscCommon(Arg);
 		case XAIE_BACKEND_OP_FREE_RESOURCE:
 			return _XAie_FreeRscCommon(Arg);
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+			return _XAie_RequestRscArrayCommon(DevInst, Arg);
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY:
+			return _XAie_ReleaseRscArrayCommon(Arg);
+		case XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY:
+			return _XAie_FreeRscArrayCommon(Arg);
 		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 			return _XAie_RequestAllocatedRscCommon(DevInst, Arg);
 		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
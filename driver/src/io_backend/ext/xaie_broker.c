@@ -0,0 +1,2419 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_broker.c
+* @{
+*
+* This file contains the broker IO backend. The broker lets several processes
+* drive the same partition. One process, the broker, owns the device instance
+* with the real backend and serves the IO operations of the other processes,
+* the clients, with XAie_BrokerServe(). The clients use the broker backend.
+*
+* The broker and its clients share a ring of command batches in a POSIX shared
+* memory object. The clients reserve slots of the ring without locking and
+* the broker executes the batches in the reservation order, so the operations
+* of a client are executed in the order they are issued. Writes are posted,
+* the client does not wait for them to be executed. Reads and polls wait for
+* the completion of their batch, which also guarantees the completion of all
+* the earlier posted batches of the client. A transaction submitted by a client
+* is sent in the batches of consecutive slots and executed by the broker as
+* one transaction of its own device instance, so either all or none of its
+* commands are executed.
+*
+* The name of the shared memory object is "/xaie_broker" unless overridden
+* with the XAIE_BROKER_NAME environment variable in the clients and with the
+* name argument of XAie_BrokerServe() in the broker.
+*
+* The resource, tile and partition operations of the clients are forwarded to
+* the broker, which executes them one at a time with its own device instance.
+* The resources are therefore shared by all the clients.
+*
+* The slots reserved by a client record its process id. The broker frees the
+* slots of the clients which exit without submitting or collecting their
+* batches. A device instance attached to the broker shall not be used across
+* fork().
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __AIEBROKER__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#endif /* __AIEBROKER__ */
+
+#include "xaie_helper.h"
+#include "xaie_io.h"
+#include "xaie_io_common.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_BROKER_MAGIC		0x4B524241U
+#define XAIE_BROKER_VERSION		2U
+#define XAIE_BROKER_NUM_SLOTS		16U
+#define XAIE_BROKER_SLOT_WORDS		4096U
+#define XAIE_BROKER_DEFAULT_NAME	"/xaie_broker"
+#define XAIE_BROKER_NAME_ENV		"XAIE_BROKER_NAME"
+
+/* Slot flags */
+#define XAIE_BROKER_SLOT_POSTED		0b1U
+#define XAIE_BROKER_SLOT_CHAINED	0b10U	/* Next slot continues the txn */
+
+/* Number of empty polls of the ring before the broker starts to sleep */
+#define XAIE_BROKER_SPIN_COUNT		1024U
+#define XAIE_BROKER_IDLE_SLEEP_NS	50000L
+
+/* Number of sleeping polls of the broker between two checks for dead clients */
+#define XAIE_BROKER_RECLAIM_INTERVAL	256U
+/* Time after which a reserved slot without an owner is reclaimed */
+#define XAIE_BROKER_RESERVE_TIMEOUT_NS	1000000000ULL
+/* Number of polls of a client between two checks of the broker process */
+#define XAIE_BROKER_LIVENESS_INTERVAL	4096U
+
+/* Maximum number of requests of a forwarded resource array operation */
+#define XAIE_BROKER_MAX_TILES_RSC	32U
+#define XAIE_BROKER_NO_RSC_NUM		0xFFFFFFFFU
+
+/* Size of the command header in 32-bit words */
+#define XAIE_BROKER_CMD_WORDS	(sizeof(XAie_BrokerCmd) / sizeof(u32))
+
+/* Maximum size of the data of a forwarded backend operation in bytes */
+#define XAIE_BROKER_OP_BYTES	((XAIE_BROKER_SLOT_WORDS - \
+			XAIE_BROKER_CMD_WORDS) * sizeof(u32))
+#define XAIE_BROKER_ALIGN(Size)	(((Size) + 7U) & ~7U)
+
+/****************************** Type Definitions *****************************/
+#ifdef __AIEBROKER__
+
+typedef enum {
+	XAIE_BROKER_CMD_WRITE,
+	XAIE_BROKER_CMD_MASKWRITE,
+	XAIE_BROKER_CMD_READ,
+	XAIE_BROKER_CMD_MASKPOLL,
+	XAIE_BROKER_CMD_BLOCKWRITE,
+	XAIE_BROKER_CMD_BLOCKSET,
+	XAIE_BROKER_CMD_NPIWRITE,
+	XAIE_BROKER_CMD_NPIMASKPOLL,
+	XAIE_BROKER_CMD_RUNOP,
+	XAIE_BROKER_CMD_BLOCKREAD,
+} XAie_BrokerCmdOpcode;
+
+/*
+ * Typedef for a command of a batch. The data of a block write follows the
+ * command in the batch, padded to a multiple of 64 bits. The data of a block
+ * read is returned by the broker at the same place. A backend operation
+ * forwarded to the broker is sent as the only command of a batch with the
+ * operation code in Value, the number of requests in Mask and the arguments
+ * in the data. The broker returns the results in the data.
+ */
+typedef struct {
+	u32 Opcode;
+	u32 Size;	/* Number of words of block operations, timeout of polls */
+	u64 RegOff;
+	u32 Mask;
+	u32 Value;
+} XAie_BrokerCmd;
+
+/*
+ * Typedef for a slot of the ring. For the slot reserved with position Pos,
+ * Seq is Pos when the slot is free, Pos + 1 when the batch is submitted,
+ * Pos + 2 when the batch is completed and waits for the client to collect the
+ * result, and Pos + XAIE_BROKER_NUM_SLOTS when the slot is free again. Owner
+ * is the process id of the client which reserved the slot, 0 while the slot
+ * is free.
+ */
+typedef struct {
+	_Atomic u64 Seq;
+	_Atomic u32 Owner;
+	u32 NumWords;		/* Number of words of the batch */
+	u32 Flags;
+	AieRC Status;		/* Status of the batch */
+	u32 ReadVal;		/* Value read by the last command of the batch */
+	u64 Batch[XAIE_BROKER_SLOT_WORDS / 2U];
+} XAie_BrokerSlot;
+
+/*
+ * Typedef for the ring shared by the broker and its clients. EnqPos is the
+ * next position to reserve by the clients and DeqPos the next position to
+ * execute by the broker.
+ */
+typedef struct {
+	u32 Magic;
+	u32 Version;
+	_Atomic u32 IsServing;
+	u32 BrokerPid;		/* Process id of the broker */
+	_Atomic u64 EnqPos;
+	u64 DeqPos;
+	XAie_BrokerSlot Slots[XAIE_BROKER_NUM_SLOTS];
+} XAie_BrokerRing;
+
+/*
+ * Typedef for a request of a forwarded resource operation. The resources of
+ * the request follow it in the batch. The offsets in the resource bitmaps are
+ * computed by the client, the bitmap itself is the one of the broker.
+ */
+typedef struct {
+	u32 MaxRscVal;
+	u32 BitmapOffset;
+	u32 NumRscPerTile;
+	u32 RscId;
+	u32 StartBit;
+	u32 StaticBitmapOffset;
+	u32 UserRscNumInput;
+	u32 UserRscNum;		/* XAIE_BROKER_NO_RSC_NUM if not passed */
+	u32 Flags;
+	u32 RscType;
+	u32 Mod;
+	u32 NumRscs;		/* Number of resources following the request */
+	XAie_LocType Loc;
+	u8 HasBitmap;
+	u8 NumContigRscs;
+} XAie_BrokerTilesRsc;
+
+/* Typedef for the arguments of a forwarded tiles operation */
+typedef struct {
+	u32 NumTiles;
+	u32 HasLocs;		/* Locations of the tiles follow if set */
+} XAie_BrokerTilesArg;
+
+/* Typedef for the arguments of a forwarded partition initialization */
+typedef struct {
+	u32 HasOpts;
+	u32 InitOpts;
+	u32 NumUseTiles;	/* Number of locations following the arguments */
+} XAie_BrokerPartArg;
+
+/* Typedef for the arguments of a forwarded resource statistics request */
+typedef struct {
+	u32 NumRscStats;	/* Number of statistics following the arguments */
+	u32 RscStatType;
+} XAie_BrokerRscStatArg;
+
+typedef struct XAie_BrokerIO {
+	XAie_BrokerRing *Ring;
+	int ShmFd;
+	u32 Pid;		/* Process id of the client */
+} XAie_BrokerIO;
+
+/*
+ * Typedef for the state of the broker for a transaction sent by a client in
+ * several chained batches.
+ */
+typedef struct {
+	u8 IsActive;		/* A chained batch was executed */
+	u8 HasTxn;		/* Transaction of the broker is started */
+	AieRC Status;		/* First error of the batches of the chain */
+} XAie_BrokerChain;
+
+/*
+ * Typedef for the slot the broker waits for to be submitted, used to time out
+ * reservations of clients which exited before the owner was recorded.
+ */
+typedef struct {
+	u64 Pos;
+	u64 StartNs;
+} XAie_BrokerStall;
+
+#endif /* __AIEBROKER__ */
+/************************** Function Definitions *****************************/
+#ifdef __AIEBROKER__
+
+/*****************************************************************************/
+/**
+*
+* This is the function to get the name of the shared memory object of the
+* broker.
+*
+* @param	Name: Name passed by the application, NULL for the default.
+*
+* @return	Name of the shared memory object.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static const char *_XAie_BrokerGetName(const char *Name)
+{
+	if(Name != NULL) {
+		return Name;
+	}
+
+	Name = getenv(XAIE_BROKER_NAME_ENV);
+	if(Name != NULL) {
+		return Name;
+	}
+
+	return XAIE_BROKER_DEFAULT_NAME;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to check if a process is alive.
+*
+* @param	Pid: Process id.
+*
+* @return	1 if the process exists, 0 otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_BrokerPidAlive(u32 Pid)
+{
+	if((kill((pid_t)Pid, 0) == 0) || (errno != ESRCH)) {
+		return 1U;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to check if the broker still serves while a client
+* waits for it. The broker process is checked once every
+* XAIE_BROKER_LIVENESS_INTERVAL calls.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	Polls: Number of calls of the wait loop of the caller.
+*
+* @return	1 if the broker serves, 0 otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_BrokerIO_IsServing(XAie_BrokerIO *IOInst, u32 *Polls)
+{
+	XAie_BrokerRing *Ring = IOInst->Ring;
+
+	if(atomic_load_explicit(&Ring->IsServing, memory_order_relaxed) == 0U) {
+		return 0U;
+	}
+
+	*Polls += 1U;
+	if(((*Polls % XAIE_BROKER_LIVENESS_INTERVAL) == 0U) &&
+			(_XAie_BrokerPidAlive(Ring->BrokerPid) == 0U)) {
+		return 0U;
+	}
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to reserve consecutive slots of the ring. It waits if
+* the slots are in use.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	NumSlots: Number of slots to reserve, at most
+*		XAIE_BROKER_NUM_SLOTS.
+* @param	Pos: Pointer to return the position of the first slot.
+*
+* @return	Pointer to the first slot on success, NULL if the broker
+*		stopped.
+*
+* @note		Internal only. No other batch is executed between the batches
+*		of the reserved slots.
+*
+*******************************************************************************/
+static XAie_BrokerSlot *_XAie_BrokerIO_GetSlots(XAie_BrokerIO *IOInst,
+		u32 NumSlots, u64 *Pos)
+{
+	XAie_BrokerRing *Ring = IOInst->Ring;
+	XAie_BrokerSlot *Slot;
+	u64 CurPos, Seq = 0U;
+	u32 Polls = 0U, i;
+
+	CurPos = atomic_load_explicit(&Ring->EnqPos, memory_order_relaxed);
+	while(1) {
+		if(_XAie_BrokerIO_IsServing(IOInst, &Polls) == 0U) {
+			XAIE_ERROR("Broker is not serving\n");
+			return NULL;
+		}
+
+		for(i = 0U; i < NumSlots; i++) {
+			Slot = &Ring->Slots[(CurPos + i) %
+				XAIE_BROKER_NUM_SLOTS];
+			Seq = atomic_load_explicit(&Slot->Seq,
+					memory_order_acquire);
+			if(Seq != CurPos + i) {
+				break;
+			}
+		}
+
+		if(i == NumSlots) {
+			if(atomic_compare_exchange_weak_explicit(&Ring->EnqPos,
+						&CurPos, CurPos + NumSlots,
+						memory_order_relaxed,
+						memory_order_relaxed)) {
+				break;
+			}
+			continue;
+		}
+
+		if((int64_t)(Seq - (CurPos + i)) < 0) {
+			/* Ring is full */
+			sched_yield();
+		}
+		CurPos = atomic_load_explicit(&Ring->EnqPos,
+				memory_order_relaxed);
+	}
+
+	for(i = 0U; i < NumSlots; i++) {
+		Slot = &Ring->Slots[(CurPos + i) % XAIE_BROKER_NUM_SLOTS];
+		atomic_store_explicit(&Slot->Owner, IOInst->Pid,
+				memory_order_relaxed);
+		Slot->NumWords = 0U;
+	}
+	*Pos = CurPos;
+
+	return &Ring->Slots[CurPos % XAIE_BROKER_NUM_SLOTS];
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to get the number of words of a command in a batch.
+*
+* @param	Cmd: Command.
+* @param	Data: Data of a block write, NULL for other commands.
+*
+* @return	Number of words.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_BrokerCmdWords(const XAie_BrokerCmd *Cmd,
+		const u32 *Data)
+{
+	if(Data == NULL) {
+		return XAIE_BROKER_CMD_WORDS;
+	}
+
+	return XAIE_BROKER_CMD_WORDS + ((Cmd->Size + 1U) & ~1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to append a command to the batch of a slot.
+*
+* @param	Slot: Reserved slot.
+* @param	Cmd: Command to append.
+* @param	Data: Data of a block write, NULL for other commands.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the batch is full.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_AddCmd(XAie_BrokerSlot *Slot,
+		const XAie_BrokerCmd *Cmd, const u32 *Data)
+{
+	u32 *Batch = (u32 *)Slot->Batch;
+	u32 NumWords = _XAie_BrokerCmdWords(Cmd, Data);
+
+	if(Slot->NumWords + NumWords > XAIE_BROKER_SLOT_WORDS) {
+		return XAIE_ERR;
+	}
+
+	memcpy(&Batch[Slot->NumWords], Cmd, sizeof(*Cmd));
+	if(Data != NULL) {
+		memcpy(&Batch[Slot->NumWords + XAIE_BROKER_CMD_WORDS], Data,
+				Cmd->Size * sizeof(u32));
+	}
+	Slot->NumWords += NumWords;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to hand the batch of a reserved slot to the broker.
+*
+* @param	Slot: Reserved slot.
+* @param	Pos: Reserved position.
+* @param	Flags: Slot flags.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the broker reclaimed the slot.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_Post(XAie_BrokerSlot *Slot, u64 Pos, u32 Flags)
+{
+	u64 Seq = Pos;
+
+	Slot->Flags = Flags;
+	if(!atomic_compare_exchange_strong_explicit(&Slot->Seq, &Seq, Pos + 1U,
+				memory_order_release, memory_order_relaxed)) {
+		XAIE_ERROR("Broker reclaimed the batch\n");
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to wait for the completion of a batch.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	Slot: Slot of the batch.
+* @param	Pos: Position of the slot.
+*
+* @return	XAIE_OK once completed, XAIE_ERR if the broker stopped.
+*
+* @note		Internal only. The slot is released with
+*		_XAie_BrokerIO_PutSlot() after the results are collected.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_Wait(XAie_BrokerIO *IOInst, XAie_BrokerSlot *Slot,
+		u64 Pos)
+{
+	u32 Polls = 0U;
+
+	while(atomic_load_explicit(&Slot->Seq, memory_order_acquire) !=
+			Pos + 2U) {
+		if(_XAie_BrokerIO_IsServing(IOInst, &Polls) == 0U) {
+			XAIE_ERROR("Broker stopped before completing the "
+					"batch\n");
+			return XAIE_ERR;
+		}
+		sched_yield();
+	}
+
+	return XAIE_OK;
+}
+
+static inline void _XAie_BrokerIO_PutSlot(XAie_BrokerSlot *Slot, u64 Pos)
+{
+	atomic_store_explicit(&Slot->Owner, 0U, memory_order_relaxed);
+	atomic_store_explicit(&Slot->Seq, Pos + XAIE_BROKER_NUM_SLOTS,
+			memory_order_release);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to submit the batch of a slot to the broker.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	Slot: Reserved slot.
+* @param	Pos: Reserved position.
+* @param	Wait: XAIE_ENABLE to wait for the completion of the batch,
+*		XAIE_DISABLE to post the batch.
+* @param	ReadVal: Pointer to return the value read by the last command
+*		of the batch. Can be NULL.
+*
+* @return	XAIE_OK on success, error code on failure. The status of a
+*		posted batch is not returned.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_Submit(XAie_BrokerIO *IOInst,
+		XAie_BrokerSlot *Slot, u64 Pos, u8 Wait, u32 *ReadVal)
+{
+	AieRC RC;
+
+	RC = _XAie_BrokerIO_Post(Slot, Pos, (Wait == XAIE_ENABLE) ? 0U :
+			XAIE_BROKER_SLOT_POSTED);
+	if((RC != XAIE_OK) || (Wait == XAIE_DISABLE)) {
+		return RC;
+	}
+
+	RC = _XAie_BrokerIO_Wait(IOInst, Slot, Pos);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = Slot->Status;
+	if(ReadVal != NULL) {
+		*ReadVal = Slot->ReadVal;
+	}
+	_XAie_BrokerIO_PutSlot(Slot, Pos);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to send a single command to the broker.
+*
+* @param	IOInst: IO instance pointer
+* @param	Cmd: Command to send.
+* @param	Data: Data of a block write, NULL for other commands.
+* @param	Wait: XAIE_ENABLE to wait for the completion of the command.
+* @param	ReadVal: Pointer to return the value read by the command. Can
+*		be NULL.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_SendCmd(void *IOInst, const XAie_BrokerCmd *Cmd,
+		const u32 *Data, u8 Wait, u32 *ReadVal)
+{
+	XAie_BrokerSlot *Slot;
+	u64 Pos;
+
+	Slot = _XAie_BrokerIO_GetSlots((XAie_BrokerIO *)IOInst, 1U, &Pos);
+	if(Slot == NULL) {
+		return XAIE_ERR;
+	}
+
+	/* Commands are split by the callers to fit in an empty batch */
+	(void)_XAie_BrokerIO_AddCmd(Slot, Cmd, Data);
+
+	return _XAie_BrokerIO_Submit((XAie_BrokerIO *)IOInst, Slot, Pos, Wait,
+			ReadVal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to free the global IO instance
+*
+* @param	IOInst: IO Instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_Finish(void *IOInst)
+{
+	XAie_BrokerIO *BrokerIOInst = (XAie_BrokerIO *)IOInst;
+
+	munmap(BrokerIOInst->Ring, sizeof(*BrokerIOInst->Ring));
+	close(BrokerIOInst->ShmFd);
+	free(IOInst);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize the global IO instance. It
+* attaches to the ring of the broker.
+*
+* @param	DevInst: Device instance pointer.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_Init(XAie_DevInst *DevInst)
+{
+	XAie_BrokerIO *IOInst;
+	XAie_BrokerRing *Ring;
+	const char *Name;
+	int Fd;
+
+	Name = _XAie_BrokerGetName(NULL);
+	Fd = shm_open(Name, O_RDWR, 0);
+	if(Fd < 0) {
+		XAIE_ERROR("Failed to open broker %s, %d: %s\n", Name, errno,
+				strerror(errno));
+		return XAIE_ERR;
+	}
+
+	Ring = mmap(NULL, sizeof(*Ring), PROT_READ | PROT_WRITE, MAP_SHARED,
+			Fd, 0);
+	if(Ring == MAP_FAILED) {
+		XAIE_ERROR("Failed to map broker %s, %d: %s\n", Name, errno,
+				strerror(errno));
+		close(Fd);
+		return XAIE_ERR;
+	}
+
+	if((Ring->Magic != XAIE_BROKER_MAGIC) ||
+			(Ring->Version != XAIE_BROKER_VERSION)) {
+		XAIE_ERROR("Broker %s is not compatible\n", Name);
+		munmap(Ring, sizeof(*Ring));
+		close(Fd);
+		return XAIE_ERR;
+	}
+
+	IOInst = (XAie_BrokerIO *)malloc(sizeof(*IOInst));
+	if(IOInst == NULL) {
+		XAIE_ERROR("Broker backend init failed. failed to allocate "
+				"memory\n");
+		munmap(Ring, sizeof(*Ring));
+		close(Fd);
+		return XAIE_ERR;
+	}
+
+	IOInst->Ring = Ring;
+	IOInst->ShmFd = Fd;
+	IOInst->Pid = (u32)getpid();
+	DevInst->IOInst = IOInst;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The write is posted.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_WRITE,
+		.RegOff = RegOff,
+		.Value = Value,
+	};
+
+	return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL, XAIE_DISABLE, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to store the 32 bit value
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_READ,
+		.RegOff = RegOff,
+	};
+
+	return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL, XAIE_ENABLE, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write masked 32bit data to the specified
+* address.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The write is posted.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_MASKWRITE,
+		.RegOff = RegOff,
+		.Mask = Mask,
+		.Value = Value,
+	};
+
+	return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL, XAIE_DISABLE, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to mask poll an address for a value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Mask: Mask to be applied to Data.
+* @param	Value: 32-bit value to poll for
+* @param	TimeOutUs: Timeout in micro seconds.
+*
+* @return	XAIE_OK or XAIE_ERR.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_MASKPOLL,
+		.Size = TimeOutUs,
+		.RegOff = RegOff,
+		.Mask = Mask,
+		.Value = Value,
+	};
+
+	return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL, XAIE_ENABLE, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a block of data to aie.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Pointer to the data buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The write is posted. Blocks larger than a batch
+*		are split in several batches.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	AieRC RC;
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_BLOCKWRITE,
+	};
+
+	while(Size > 0U) {
+		Cmd.RegOff = RegOff;
+		Cmd.Size = XAIE_BROKER_SLOT_WORDS - XAIE_BROKER_CMD_WORDS;
+		if(Size < Cmd.Size) {
+			Cmd.Size = Size;
+		}
+
+		RC = _XAie_BrokerIO_SendCmd(IOInst, &Cmd, Data, XAIE_DISABLE,
+				NULL);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RegOff += Cmd.Size * sizeof(u32);
+		Data += Cmd.Size;
+		Size -= Cmd.Size;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to initialize a chunk of aie address space with
+* a specified value.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+* @param	Data: Data to initialize a chunk of aie address space..
+* @param	Size: Number of 32-bit words.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. The write is posted.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_BLOCKSET,
+		.Size = Size,
+		.RegOff = RegOff,
+		.Value = Data,
+	};
+
+	return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL, XAIE_DISABLE, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to read a block of registers through the broker.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	Req: Block read request.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Blocks larger than a batch are read with several
+*		batches.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_BlockRead32(XAie_BrokerIO *IOInst,
+		XAie_BackendBlockRdReq *Req)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_BLOCKREAD,
+	};
+	u64 RegOff = Req->RegOff;
+	u32 *Data = Req->Data;
+	u32 Size = Req->Size;
+	AieRC RC;
+
+	while(Size > 0U) {
+		XAie_BrokerSlot *Slot;
+		u32 *Batch;
+		u64 Pos;
+
+		Cmd.RegOff = RegOff;
+		Cmd.Size = XAIE_BROKER_SLOT_WORDS - XAIE_BROKER_CMD_WORDS;
+		if(Size < Cmd.Size) {
+			Cmd.Size = Size;
+		}
+
+		Slot = _XAie_BrokerIO_GetSlots(IOInst, 1U, &Pos);
+		if(Slot == NULL) {
+			return XAIE_ERR;
+		}
+
+		Batch = (u32 *)Slot->Batch;
+		memcpy(Batch, &Cmd, sizeof(Cmd));
+		Slot->NumWords = _XAie_BrokerCmdWords(&Cmd, Data);
+
+		RC = _XAie_BrokerIO_Post(Slot, Pos, 0U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = _XAie_BrokerIO_Wait(IOInst, Slot, Pos);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = Slot->Status;
+		if(RC == XAIE_OK) {
+			memcpy(Data, &Batch[XAIE_BROKER_CMD_WORDS],
+					Cmd.Size * sizeof(u32));
+		}
+		_XAie_BrokerIO_PutSlot(Slot, Pos);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RegOff += Cmd.Size * sizeof(u32);
+		Data += Cmd.Size;
+		Size -= Cmd.Size;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to pack the commands of a transaction in the batches of
+* consecutive slots. Each batch is filled as much as possible.
+*
+* @param	Ring: Ring of the broker.
+* @param	TxnInst: Transaction instance.
+* @param	Pos: Position of the first slot.
+* @param	Fill: XAIE_ENABLE to fill the slots, XAIE_DISABLE to only count
+*		them.
+*
+* @return	Number of slots of the transaction, 0 on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_BrokerIO_PackTxn(XAie_BrokerRing *Ring,
+		XAie_TxnInst *TxnInst, u64 Pos, u8 Fill)
+{
+	XAie_BrokerSlot *Slot = &Ring->Slots[Pos % XAIE_BROKER_NUM_SLOTS];
+	u32 NumSlots = 1U, NumWords = 0U;
+
+	for(u32 i = 0U; i < TxnInst->NumCmds; i++) {
+		XAie_TxnCmd *TxnCmd = &TxnInst->CmdBuf[i];
+		const u32 *Data = NULL;
+		u32 Size = TxnCmd->Size;
+		u64 RegOff = TxnCmd->RegOff;
+		XAie_BrokerCmd Cmd = {
+			.Mask = TxnCmd->Mask,
+			.Value = TxnCmd->Value,
+		};
+
+		switch(TxnCmd->Opcode) {
+		case XAIE_IO_WRITE:
+			Cmd.Opcode = (TxnCmd->Mask == 0U) ?
+				XAIE_BROKER_CMD_WRITE :
+				XAIE_BROKER_CMD_MASKWRITE;
+			Size = 1U;
+			break;
+		case XAIE_IO_BLOCKWRITE:
+			Cmd.Opcode = XAIE_BROKER_CMD_BLOCKWRITE;
+			Data = (const u32 *)(uintptr_t)TxnCmd->DataPtr;
+			break;
+		case XAIE_IO_BLOCKSET:
+			Cmd.Opcode = XAIE_BROKER_CMD_BLOCKSET;
+			break;
+		default:
+			XAIE_ERROR("Invalid transaction opcode\n");
+			return 0U;
+		}
+
+		do {
+			u32 CmdWords;
+
+			Cmd.RegOff = RegOff;
+			Cmd.Size = Size;
+			if((Data != NULL) && (Size > XAIE_BROKER_SLOT_WORDS -
+						XAIE_BROKER_CMD_WORDS)) {
+				Cmd.Size = XAIE_BROKER_SLOT_WORDS -
+					XAIE_BROKER_CMD_WORDS;
+			}
+
+			CmdWords = _XAie_BrokerCmdWords(&Cmd, Data);
+			if(NumWords + CmdWords > XAIE_BROKER_SLOT_WORDS) {
+				/* Batch is full, continue in the next slot */
+				Slot = &Ring->Slots[(Pos + NumSlots) %
+					XAIE_BROKER_NUM_SLOTS];
+				NumSlots++;
+				NumWords = 0U;
+			}
+
+			if(Fill == XAIE_ENABLE) {
+				(void)_XAie_BrokerIO_AddCmd(Slot, &Cmd, Data);
+			}
+			NumWords += CmdWords;
+
+			if(Data != NULL) {
+				RegOff += Cmd.Size * sizeof(u32);
+				Data += Cmd.Size;
+				Size -= Cmd.Size;
+			} else {
+				Size = 0U;
+			}
+		} while(Size > 0U);
+	}
+
+	return NumSlots;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to submit the commands of a transaction to the broker.
+* The commands are sent in as few batches as possible, in consecutive slots of
+* the ring, and the function waits for the completion of the last batch. The
+* broker executes all the batches as one transaction.
+*
+* @param	IOInst: IO instance pointer
+* @param	TxnInst: Transaction instance.
+*
+* @return	XAIE_OK on success, error code on failure. The first error of
+*		any of the batches is returned and none of the commands of the
+*		transaction are executed in that case.
+*
+* @note		Internal only. Transactions larger than the ring are rejected.
+*
+*******************************************************************************/
+static AieRC XAie_BrokerIO_SubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
+{
+	XAie_BrokerIO *BrokerIOInst = (XAie_BrokerIO *)IOInst;
+	XAie_BrokerRing *Ring = BrokerIOInst->Ring;
+	XAie_BrokerSlot *Slot;
+	u32 NumSlots;
+	AieRC RC;
+	u64 Pos;
+
+	if(TxnInst->NumCmds == 0U) {
+		return XAIE_OK;
+	}
+
+	NumSlots = _XAie_BrokerIO_PackTxn(Ring, TxnInst, 0U, XAIE_DISABLE);
+	if(NumSlots == 0U) {
+		return XAIE_ERR;
+	}
+
+	if(NumSlots > XAIE_BROKER_NUM_SLOTS) {
+		XAIE_ERROR("Transaction needs %u broker batches, more than the "
+				"%u of the ring\n", NumSlots,
+				XAIE_BROKER_NUM_SLOTS);
+		return XAIE_INVALID_ARGS;
+	}
+
+	Slot = _XAie_BrokerIO_GetSlots(BrokerIOInst, NumSlots, &Pos);
+	if(Slot == NULL) {
+		return XAIE_ERR;
+	}
+
+	(void)_XAie_BrokerIO_PackTxn(Ring, TxnInst, Pos, XAIE_ENABLE);
+	for(u32 i = 0U; i < NumSlots - 1U; i++) {
+		RC = _XAie_BrokerIO_Post(
+				&Ring->Slots[(Pos + i) % XAIE_BROKER_NUM_SLOTS],
+				Pos + i, XAIE_BROKER_SLOT_POSTED |
+				XAIE_BROKER_SLOT_CHAINED);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	Pos += NumSlots - 1U;
+	RC = _XAie_BrokerIO_Submit(BrokerIOInst,
+			&Ring->Slots[Pos % XAIE_BROKER_NUM_SLOTS], Pos,
+			XAIE_ENABLE, NULL);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Broker failed to execute transaction\n");
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to get the number of resources returned by the backend
+* for a resource request.
+*
+* @param	TilesRsc: Resource request.
+*
+* @return	Number of resources.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u32 _XAie_BrokerIO_NumRscs(const XAie_BackendTilesRsc *TilesRsc)
+{
+	if(TilesRsc->Rscs == NULL) {
+		return 0U;
+	}
+
+	if(TilesRsc->UserRscNum != NULL) {
+		return TilesRsc->UserRscNumInput;
+	}
+
+	return TilesRsc->NumRscPerTile;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to pack resource requests in the data of a forwarded
+* backend operation.
+*
+* @param	TilesRsc: Array of resource requests.
+* @param	NumTilesRsc: Number of requests.
+* @param	Buf: Data of the operation.
+* @param	Len: Pointer to return the size of the data in bytes.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if the requests do not
+*		fit in a batch.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_PackTilesRsc(const XAie_BackendTilesRsc *TilesRsc,
+		u32 NumTilesRsc, u8 *Buf, u32 *Len)
+{
+	u32 Off = 0U;
+
+	for(u32 i = 0U; i < NumTilesRsc; i++) {
+		const XAie_BackendTilesRsc *Src = &TilesRsc[i];
+		XAie_BrokerTilesRsc *Req = (XAie_BrokerTilesRsc *)&Buf[Off];
+		u32 NumRscs = _XAie_BrokerIO_NumRscs(Src);
+		u32 Size;
+
+		Size = XAIE_BROKER_ALIGN(sizeof(*Req)) +
+			XAIE_BROKER_ALIGN(NumRscs * sizeof(XAie_UserRsc));
+		if(Off + Size > XAIE_BROKER_OP_BYTES) {
+			XAIE_ERROR("Resource request is too large for the "
+					"broker\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		Req->MaxRscVal = Src->MaxRscVal;
+		Req->BitmapOffset = Src->BitmapOffset;
+		Req->NumRscPerTile = Src->NumRscPerTile;
+		Req->RscId = Src->RscId;
+		Req->StartBit = Src->StartBit;
+		Req->StaticBitmapOffset = Src->StaticBitmapOffset;
+		Req->UserRscNumInput = Src->UserRscNumInput;
+		Req->UserRscNum = (Src->UserRscNum != NULL) ?
+			*Src->UserRscNum : XAIE_BROKER_NO_RSC_NUM;
+		Req->Flags = Src->Flags;
+		Req->RscType = (u32)Src->RscType;
+		Req->Mod = (u32)Src->Mod;
+		Req->NumRscs = NumRscs;
+		Req->Loc = Src->Loc;
+		Req->HasBitmap = (Src->Bitmap != NULL) ? 1U : 0U;
+		Req->NumContigRscs = Src->NumContigRscs;
+		if(NumRscs > 0U) {
+			memcpy(&Buf[Off + XAIE_BROKER_ALIGN(sizeof(*Req))],
+					Src->Rscs, NumRscs * sizeof(XAie_UserRsc));
+		}
+
+		Off += Size;
+	}
+
+	*Len = Off;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to return the results of forwarded resource requests to
+* the caller.
+*
+* @param	TilesRsc: Array of resource requests.
+* @param	NumTilesRsc: Number of requests.
+* @param	Buf: Data of the completed operation.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_BrokerIO_UnpackTilesRsc(XAie_BackendTilesRsc *TilesRsc,
+		u32 NumTilesRsc, const u8 *Buf)
+{
+	u32 Off = 0U;
+
+	for(u32 i = 0U; i < NumTilesRsc; i++) {
+		const XAie_BrokerTilesRsc *Req =
+			(const XAie_BrokerTilesRsc *)&Buf[Off];
+
+		if(TilesRsc[i].UserRscNum != NULL) {
+			*TilesRsc[i].UserRscNum = Req->UserRscNum;
+		}
+		if(Req->NumRscs > 0U) {
+			memcpy(TilesRsc[i].Rscs,
+					&Buf[Off + XAIE_BROKER_ALIGN(sizeof(*Req))],
+					Req->NumRscs * sizeof(XAie_UserRsc));
+		}
+
+		Off += XAIE_BROKER_ALIGN(sizeof(*Req)) +
+			XAIE_BROKER_ALIGN(Req->NumRscs * sizeof(XAie_UserRsc));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to pack the arguments of a backend operation forwarded
+* to the broker.
+*
+* @param	Op: Backend operation code.
+* @param	Arg: Backend operation argument.
+* @param	Buf: Data of the operation.
+* @param	NumReqs: Pointer to return the number of requests.
+* @param	Len: Pointer to return the size of the data in bytes.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_PackOp(XAie_BackendOpCode Op, void *Arg, u8 *Buf,
+		u32 *NumReqs, u32 *Len)
+{
+	u32 Size;
+
+	*NumReqs = 1U;
+	*Len = 0U;
+	switch(Op) {
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+		case XAIE_BACKEND_OP_FREE_RESOURCE:
+		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+			return _XAie_BrokerIO_PackTilesRsc(Arg, 1U, Buf, Len);
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY:
+		{
+			XAie_BackendTilesRscArray *Array = Arg;
+
+			/* Served with one operation per request */
+			if(Array->NumTilesRsc > XAIE_BROKER_MAX_TILES_RSC) {
+				return XAIE_FEATURE_NOT_SUPPORTED;
+			}
+
+			*NumReqs = Array->NumTilesRsc;
+			return _XAie_BrokerIO_PackTilesRsc(Array->TilesRsc,
+					Array->NumTilesRsc, Buf, Len);
+		}
+		case XAIE_BACKEND_OP_GET_RSC_STAT:
+		{
+			XAie_BackendRscStat *Stat = Arg;
+			XAie_BrokerRscStatArg *StatArg =
+				(XAie_BrokerRscStatArg *)Buf;
+
+			Size = Stat->NumRscStats * sizeof(XAie_UserRscStat);
+			*NumReqs = Stat->NumRscStats;
+			*Len = XAIE_BROKER_ALIGN(sizeof(*StatArg)) +
+				XAIE_BROKER_ALIGN(Size);
+			if(*Len > XAIE_BROKER_OP_BYTES) {
+				break;
+			}
+
+			StatArg->NumRscStats = Stat->NumRscStats;
+			StatArg->RscStatType = (u32)Stat->RscStatType;
+			memcpy(&Buf[XAIE_BROKER_ALIGN(sizeof(*StatArg))],
+					Stat->RscStats, Size);
+			return XAIE_OK;
+		}
+		case XAIE_BACKEND_OP_REQUEST_TILES:
+		case XAIE_BACKEND_OP_RELEASE_TILES:
+		{
+			XAie_BackendTilesArray *Tiles = Arg;
+			XAie_BrokerTilesArg *TilesArg =
+				(XAie_BrokerTilesArg *)Buf;
+
+			Size = (Tiles->Locs != NULL) ?
+				Tiles->NumTiles * sizeof(XAie_LocType) : 0U;
+			*Len = XAIE_BROKER_ALIGN(sizeof(*TilesArg)) +
+				XAIE_BROKER_ALIGN(Size);
+			if(*Len > XAIE_BROKER_OP_BYTES) {
+				break;
+			}
+
+			TilesArg->NumTiles = Tiles->NumTiles;
+			TilesArg->HasLocs = (Tiles->Locs != NULL) ? 1U : 0U;
+			if(Size > 0U) {
+				memcpy(&Buf[XAIE_BROKER_ALIGN(sizeof(*TilesArg))],
+						Tiles->Locs, Size);
+			}
+			return XAIE_OK;
+		}
+		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+		{
+			XAie_PartInitOpts *Opts = Arg;
+			XAie_BrokerPartArg *PartArg =
+				(XAie_BrokerPartArg *)Buf;
+
+			memset(PartArg, 0, sizeof(*PartArg));
+			Size = 0U;
+			if(Opts != NULL) {
+				PartArg->HasOpts = 1U;
+				PartArg->InitOpts = Opts->InitOpts;
+				if(Opts->Locs != NULL) {
+					PartArg->NumUseTiles = Opts->NumUseTiles;
+					Size = Opts->NumUseTiles *
+						sizeof(XAie_LocType);
+				}
+			}
+
+			*Len = XAIE_BROKER_ALIGN(sizeof(*PartArg)) +
+				XAIE_BROKER_ALIGN(Size);
+			if(*Len > XAIE_BROKER_OP_BYTES) {
+				break;
+			}
+
+			if(Size > 0U) {
+				memcpy(&Buf[XAIE_BROKER_ALIGN(sizeof(*PartArg))],
+						Opts->Locs, Size);
+			}
+			return XAIE_OK;
+		}
+		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+			return XAIE_OK;
+		default:
+			return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	XAIE_ERROR("Arguments of backend operation %d are too large for the "
+			"broker\n", Op);
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to forward a backend operation to the broker, which
+* executes it with its device instance. The operations of all the clients are
+* executed one at a time by the broker.
+*
+* @param	IOInst: Broker IO instance of the client.
+* @param	Op: Backend operation code.
+* @param	Arg: Backend operation argument.
+*
+* @return	Status of the operation executed by the broker.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerIO_ForwardOp(XAie_BrokerIO *IOInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	XAie_BrokerCmd Cmd = {
+		.Opcode = XAIE_BROKER_CMD_RUNOP,
+		.Value = (u32)Op,
+	};
+	XAie_BrokerSlot *Slot;
+	u32 *Batch, Len;
+	u8 *Data;
+	AieRC RC;
+	u64 Pos;
+
+	Slot = _XAie_BrokerIO_GetSlots(IOInst, 1U, &Pos);
+	if(Slot == NULL) {
+		return XAIE_ERR;
+	}
+
+	Batch = (u32 *)Slot->Batch;
+	Data = (u8 *)&Batch[XAIE_BROKER_CMD_WORDS];
+	RC = _XAie_BrokerIO_PackOp(Op, Arg, Data, &Cmd.Mask, &Len);
+	if(RC != XAIE_OK) {
+		/* Release the slot with an empty batch */
+		(void)_XAie_BrokerIO_Submit(IOInst, Slot, Pos, XAIE_DISABLE,
+				NULL);
+		return RC;
+	}
+
+	Cmd.Size = Len / sizeof(u32);
+	memcpy(Batch, &Cmd, sizeof(Cmd));
+	Slot->NumWords = XAIE_BROKER_CMD_WORDS + Cmd.Size;
+
+	RC = _XAie_BrokerIO_Post(Slot, Pos, 0U);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_BrokerIO_Wait(IOInst, Slot, Pos);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = Slot->Status;
+	if(RC == XAIE_OK) {
+		switch(Op) {
+			case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+			case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+				_XAie_BrokerIO_UnpackTilesRsc(Arg, 1U, Data);
+				break;
+			case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+			{
+				XAie_BackendTilesRscArray *Array = Arg;
+
+				_XAie_BrokerIO_UnpackTilesRsc(Array->TilesRsc,
+						Array->NumTilesRsc, Data);
+				break;
+			}
+			case XAIE_BACKEND_OP_GET_RSC_STAT:
+			{
+				XAie_BackendRscStat *Stat = Arg;
+
+				memcpy(Stat->RscStats, &Data[XAIE_BROKER_ALIGN(
+						sizeof(XAie_BrokerRscStatArg))],
+						Stat->NumRscStats *
+						sizeof(XAie_UserRscStat));
+				break;
+			}
+			default:
+				break;
+		}
+	}
+	_XAie_BrokerIO_PutSlot(Slot, Pos);
+
+	return RC;
+}
+
+static AieRC XAie_BrokerIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	AieRC RC;
+
+	switch(Op) {
+		case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
+		{
+			XAie_ShimDmaBdArgs *BdArgs =
+				(XAie_ShimDmaBdArgs *)Arg;
+
+			return XAie_BrokerIO_BlockWrite32(IOInst, BdArgs->Addr,
+					BdArgs->BdWords, BdArgs->NumBdWords);
+		}
+		case XAIE_BACKEND_OP_NPIWR32:
+		{
+			XAie_BackendNpiWrReq *Req = Arg;
+			XAie_BrokerCmd Cmd = {
+				.Opcode = XAIE_BROKER_CMD_NPIWRITE,
+				.RegOff = Req->NpiRegOff,
+				.Value = Req->Val,
+			};
+
+			return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL,
+					XAIE_DISABLE, NULL);
+		}
+		case XAIE_BACKEND_OP_NPIMASKPOLL32:
+		{
+			XAie_BackendNpiMaskPollReq *Req = Arg;
+			XAie_BrokerCmd Cmd = {
+				.Opcode = XAIE_BROKER_CMD_NPIMASKPOLL,
+				.Size = Req->TimeOutUs,
+				.RegOff = Req->NpiRegOff,
+				.Mask = Req->Mask,
+				.Value = Req->Val,
+			};
+
+			return _XAie_BrokerIO_SendCmd(IOInst, &Cmd, NULL,
+					XAIE_ENABLE, NULL);
+		}
+		case XAIE_BACKEND_OP_WRITE_FENCE:
+		{
+			/*
+			 * An empty batch completes after all the batches
+			 * posted before it.
+			 */
+			XAie_BrokerIO *BrokerIOInst = (XAie_BrokerIO *)IOInst;
+			XAie_BrokerSlot *Slot;
+			u64 Pos;
+
+			Slot = _XAie_BrokerIO_GetSlots(BrokerIOInst, 1U, &Pos);
+			if(Slot == NULL) {
+				return XAIE_ERR;
+			}
+
+			return _XAie_BrokerIO_Submit(BrokerIOInst, Slot, Pos,
+					XAIE_ENABLE, NULL);
+		}
+		case XAIE_BACKEND_OP_BLOCK_READ32:
+			return _XAie_BrokerIO_BlockRead32(IOInst, Arg);
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+		case XAIE_BACKEND_OP_FREE_RESOURCE:
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+		case XAIE_BACKEND_OP_GET_RSC_STAT:
+		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+			return _XAie_BrokerIO_ForwardOp(IOInst, Op, Arg);
+		case XAIE_BACKEND_OP_REQUEST_TILES:
+			RC = _XAie_BrokerIO_ForwardOp(IOInst, Op, Arg);
+			if(RC == XAIE_OK)
+				_XAie_IOCommon_MarkTilesInUse(DevInst,
+						(XAie_BackendTilesArray *)Arg);
+			return RC;
+		case XAIE_BACKEND_OP_RELEASE_TILES:
+			RC = _XAie_BrokerIO_ForwardOp(IOInst, Op, Arg);
+			if(RC == XAIE_OK)
+				_XAie_IOCommon_MarkTilesReleased(DevInst,
+						(XAie_BackendTilesArray *)Arg);
+			return RC;
+		default:
+			XAIE_ERROR("Broker backend does not support operation "
+					"%d\n", Op);
+			return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+}
+
+static u64 XAie_BrokerIO_GetTid(void)
+{
+	return (u64)pthread_self();
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to execute forwarded resource requests in the broker.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Op: Backend operation code.
+* @param	Buf: Data of the operation. The results are returned in it.
+* @param	Len: Size of the data in bytes.
+* @param	NumTilesRsc: Number of requests.
+* @param	IsArray: XAIE_ENABLE for the resource array operations.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerRunRscOp(XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, u8 *Buf, u32 Len, u32 NumTilesRsc,
+		u8 IsArray)
+{
+	XAie_BackendTilesRsc TilesRsc[XAIE_BROKER_MAX_TILES_RSC];
+	XAie_BackendTilesRscArray Array;
+	u32 Off = 0U;
+
+	if((NumTilesRsc == 0U) || (NumTilesRsc > XAIE_BROKER_MAX_TILES_RSC)) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumTilesRsc; i++) {
+		XAie_BrokerTilesRsc *Req = (XAie_BrokerTilesRsc *)&Buf[Off];
+		XAie_BackendTilesRsc *Dst = &TilesRsc[i];
+		u32 Size;
+
+		if((Off + XAIE_BROKER_ALIGN(sizeof(*Req)) > Len) ||
+				(Req->NumRscs > Len / sizeof(XAie_UserRsc))) {
+			return XAIE_INVALID_ARGS;
+		}
+
+		Size = XAIE_BROKER_ALIGN(sizeof(*Req)) +
+			XAIE_BROKER_ALIGN(Req->NumRscs * sizeof(XAie_UserRsc));
+		if((Off + Size > Len) || (Req->RscType >= XAIE_MAX_RSC) ||
+				(Req->Loc.Col >= DevInst->NumCols) ||
+				(Req->Loc.Row >= DevInst->NumRows)) {
+			XAIE_ERROR("Invalid forwarded resource request\n");
+			return XAIE_INVALID_ARGS;
+		}
+
+		memset(Dst, 0, sizeof(*Dst));
+		if(Req->HasBitmap != 0U) {
+			u8 TileType = DevInst->DevOps->GetTTypefromLoc(
+					DevInst, Req->Loc);
+
+			if(DevInst->RscMapping == NULL) {
+				XAIE_ERROR("Broker resource manager is not "
+						"initialized\n");
+				return XAIE_ERR;
+			}
+			Dst->Bitmap = DevInst->RscMapping[TileType].
+				Bitmaps[Req->RscType];
+		}
+		Dst->MaxRscVal = Req->MaxRscVal;
+		Dst->BitmapOffset = Req->BitmapOffset;
+		Dst->NumRscPerTile = Req->NumRscPerTile;
+		Dst->RscId = Req->RscId;
+		Dst->StartBit = Req->StartBit;
+		Dst->StaticBitmapOffset = Req->StaticBitmapOffset;
+		if(Req->UserRscNum != XAIE_BROKER_NO_RSC_NUM) {
+			Dst->UserRscNum = &Req->UserRscNum;
+		}
+		Dst->UserRscNumInput = Req->UserRscNumInput;
+		Dst->Flags = Req->Flags;
+		Dst->NumContigRscs = Req->NumContigRscs;
+		Dst->RscType = (XAie_RscType)Req->RscType;
+		Dst->Loc = Req->Loc;
+		Dst->Mod = (XAie_ModuleType)Req->Mod;
+		if(Req->NumRscs > 0U) {
+			Dst->Rscs = (XAie_UserRsc *)
+				&Buf[Off + XAIE_BROKER_ALIGN(sizeof(*Req))];
+		}
+
+		Off += Size;
+	}
+
+	if(IsArray == XAIE_DISABLE) {
+		return XAie_RunOp(DevInst, Op, (void *)&TilesRsc[0]);
+	}
+
+	Array.TilesRsc = TilesRsc;
+	Array.NumTilesRsc = NumTilesRsc;
+
+	return XAie_RunOp(DevInst, Op, (void *)&Array);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to execute a backend operation forwarded by a client
+* with the device instance of the broker.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Cmd: Command of the operation.
+* @param	Buf: Data of the operation. The results are returned in it.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerRunOp(XAie_DevInst *DevInst,
+		const XAie_BrokerCmd *Cmd, u8 *Buf)
+{
+	XAie_BackendOpCode Op = (XAie_BackendOpCode)Cmd->Value;
+	u32 Len = Cmd->Size * sizeof(u32);
+
+	switch(Op) {
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE:
+		case XAIE_BACKEND_OP_FREE_RESOURCE:
+		case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
+			return _XAie_BrokerRunRscOp(DevInst, Op, Buf, Len, 1U,
+					XAIE_DISABLE);
+		case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY:
+		case XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY:
+			return _XAie_BrokerRunRscOp(DevInst, Op, Buf, Len,
+					Cmd->Mask, XAIE_ENABLE);
+		case XAIE_BACKEND_OP_GET_RSC_STAT:
+		{
+			XAie_BrokerRscStatArg *StatArg =
+				(XAie_BrokerRscStatArg *)Buf;
+			XAie_BackendRscStat Stat;
+
+			if((Len < XAIE_BROKER_ALIGN(sizeof(*StatArg))) ||
+					(StatArg->NumRscStats > (Len -
+					XAIE_BROKER_ALIGN(sizeof(*StatArg))) /
+					sizeof(XAie_UserRscStat))) {
+				return XAIE_INVALID_ARGS;
+			}
+
+			Stat.NumRscStats = StatArg->NumRscStats;
+			Stat.RscStatType =
+				(XAie_BackendRscStatType)StatArg->RscStatType;
+			Stat.RscStats = (XAie_UserRscStat *)
+				&Buf[XAIE_BROKER_ALIGN(sizeof(*StatArg))];
+
+			return XAie_RunOp(DevInst, Op, (void *)&Stat);
+		}
+		case XAIE_BACKEND_OP_REQUEST_TILES:
+		case XAIE_BACKEND_OP_RELEASE_TILES:
+		{
+			XAie_BrokerTilesArg *TilesArg =
+				(XAie_BrokerTilesArg *)Buf;
+			XAie_BackendTilesArray Tiles = {0};
+
+			if((Len < XAIE_BROKER_ALIGN(sizeof(*TilesArg))) ||
+					((TilesArg->HasLocs != 0U) &&
+					 (TilesArg->NumTiles > (Len -
+					  XAIE_BROKER_ALIGN(sizeof(*TilesArg))) /
+					  sizeof(XAie_LocType)))) {
+				return XAIE_INVALID_ARGS;
+			}
+
+			Tiles.NumTiles = TilesArg->NumTiles;
+			if(TilesArg->HasLocs != 0U) {
+				Tiles.Locs = (XAie_LocType *)
+					&Buf[XAIE_BROKER_ALIGN(sizeof(*TilesArg))];
+			}
+
+			return XAie_RunOp(DevInst, Op, (void *)&Tiles);
+		}
+		case XAIE_BACKEND_OP_PARTITION_INITIALIZE:
+		{
+			XAie_BrokerPartArg *PartArg = (XAie_BrokerPartArg *)Buf;
+			XAie_PartInitOpts Opts = {0};
+
+			if((Len < XAIE_BROKER_ALIGN(sizeof(*PartArg))) ||
+					(PartArg->NumUseTiles > (Len -
+					 XAIE_BROKER_ALIGN(sizeof(*PartArg))) /
+					 sizeof(XAie_LocType))) {
+				return XAIE_INVALID_ARGS;
+			}
+
+			if(PartArg->HasOpts == 0U) {
+				return XAie_RunOp(DevInst, Op, NULL);
+			}
+
+			Opts.InitOpts = PartArg->InitOpts;
+			Opts.NumUseTiles = PartArg->NumUseTiles;
+			if(PartArg->NumUseTiles > 0U) {
+				Opts.Locs = (XAie_LocType *)
+					&Buf[XAIE_BROKER_ALIGN(sizeof(*PartArg))];
+			}
+
+			return XAie_RunOp(DevInst, Op, (void *)&Opts);
+		}
+		case XAIE_BACKEND_OP_PARTITION_TEARDOWN:
+			return XAie_RunOp(DevInst, Op, NULL);
+		default:
+			XAIE_ERROR("Invalid forwarded backend operation %d\n",
+					Op);
+			return XAIE_INVALID_ARGS;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to execute a command of a batch in the broker.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Cmd: Command to execute.
+* @param	Data: Data following the command in the batch.
+* @param	ReadVal: Pointer to return the value read by the command.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerExecuteCmd(XAie_DevInst *DevInst,
+		const XAie_BrokerCmd *Cmd, u32 *Data, u32 *ReadVal)
+{
+	switch(Cmd->Opcode) {
+		case XAIE_BROKER_CMD_WRITE:
+			return XAie_Write32(DevInst, Cmd->RegOff, Cmd->Value);
+		case XAIE_BROKER_CMD_MASKWRITE:
+			return XAie_MaskWrite32(DevInst, Cmd->RegOff, Cmd->Mask,
+					Cmd->Value);
+		case XAIE_BROKER_CMD_READ:
+			return XAie_Read32(DevInst, Cmd->RegOff, ReadVal);
+		case XAIE_BROKER_CMD_MASKPOLL:
+			return XAie_MaskPoll(DevInst, Cmd->RegOff, Cmd->Mask,
+					Cmd->Value, Cmd->Size);
+		case XAIE_BROKER_CMD_BLOCKWRITE:
+			return XAie_BlockWrite32(DevInst, Cmd->RegOff, Data,
+					Cmd->Size);
+		case XAIE_BROKER_CMD_BLOCKSET:
+			return XAie_BlockSet32(DevInst, Cmd->RegOff, Cmd->Value,
+					Cmd->Size);
+		case XAIE_BROKER_CMD_NPIWRITE:
+		{
+			XAie_BackendNpiWrReq Req = {
+				.NpiRegOff = (u32)Cmd->RegOff,
+				.Val = Cmd->Value,
+			};
+
+			return XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIWR32,
+					&Req);
+		}
+		case XAIE_BROKER_CMD_NPIMASKPOLL:
+		{
+			XAie_BackendNpiMaskPollReq Req = {
+				.NpiRegOff = (u32)Cmd->RegOff,
+				.Mask = Cmd->Mask,
+				.Val = Cmd->Value,
+				.TimeOutUs = Cmd->Size,
+			};
+
+			return XAie_RunOp(DevInst, XAIE_BACKEND_OP_NPIMASKPOLL32,
+					&Req);
+		}
+		case XAIE_BROKER_CMD_RUNOP:
+			return _XAie_BrokerRunOp(DevInst, Cmd, (u8 *)Data);
+		case XAIE_BROKER_CMD_BLOCKREAD:
+			return XAie_BlockRead32(DevInst, Cmd->RegOff, Data,
+					Cmd->Size);
+		default:
+			XAIE_ERROR("Invalid broker command %d\n", Cmd->Opcode);
+			return XAIE_INVALID_ARGS;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to submit the transaction of the broker device instance.
+* The transaction is discarded if it fails or if Status is an error, so that
+* the device instance is left without transaction.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Status: Status of the commands of the transaction.
+*
+* @return	Status if it is an error, status of the submission otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerEndTxn(XAie_DevInst *DevInst, AieRC Status)
+{
+	XAie_TxnInst *TxnInst;
+
+	if(Status == XAIE_OK) {
+		Status = XAie_SubmitTransaction(DevInst, NULL);
+		if(Status == XAIE_OK) {
+			return XAIE_OK;
+		}
+	}
+
+	TxnInst = _XAie_TxnDetach(DevInst);
+	if(TxnInst != NULL) {
+		_XAie_Txn_FreePayloads(TxnInst);
+		free(TxnInst->CmdBuf);
+		free(TxnInst);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to execute a batch in the broker. Batches of more than
+* one command are executed as a transaction of the broker device instance.
+* The execution stops at the first failing command.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Slot: Slot of the batch.
+* @param	InTxn: XAIE_ENABLE if the batch is part of a transaction
+*		started by the caller.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerExecuteBatch(XAie_DevInst *DevInst,
+		XAie_BrokerSlot *Slot, u8 InTxn)
+{
+	u32 *Batch = (u32 *)Slot->Batch;
+	AieRC RC = XAIE_OK;
+	u8 IsTxn = XAIE_DISABLE;
+	u32 Word = 0U;
+
+	Slot->ReadVal = 0U;
+
+	if(Slot->NumWords > XAIE_BROKER_SLOT_WORDS) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	while(Word + XAIE_BROKER_CMD_WORDS <= Slot->NumWords) {
+		XAie_BrokerCmd Cmd;
+		u32 DataWords = 0U;
+
+		memcpy(&Cmd, &Batch[Word], sizeof(Cmd));
+		Word += XAIE_BROKER_CMD_WORDS;
+		if((Cmd.Opcode == XAIE_BROKER_CMD_BLOCKWRITE) ||
+				(Cmd.Opcode == XAIE_BROKER_CMD_BLOCKREAD) ||
+				(Cmd.Opcode == XAIE_BROKER_CMD_RUNOP)) {
+			DataWords = (Cmd.Size + 1U) & ~1U;
+			if(Word + DataWords > Slot->NumWords) {
+				RC = XAIE_INVALID_ARGS;
+				break;
+			}
+		}
+
+		if((InTxn == XAIE_DISABLE) && (IsTxn == XAIE_DISABLE) &&
+				(Word + DataWords < Slot->NumWords)) {
+			RC = XAie_StartTransaction(DevInst,
+					XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+			if(RC != XAIE_OK) {
+				break;
+			}
+			IsTxn = XAIE_ENABLE;
+		}
+
+		RC = _XAie_BrokerExecuteCmd(DevInst, &Cmd, &Batch[Word],
+				&Slot->ReadVal);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		Word += DataWords;
+	}
+
+	if(IsTxn == XAIE_ENABLE) {
+		RC = _XAie_BrokerEndTxn(DevInst, RC);
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to end the transaction of chained batches in the
+* broker. The transaction is submitted if all the batches succeeded and
+* discarded otherwise.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Chain: State of the chained batches.
+* @param	RC: Status of the chained batches.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerEndChain(XAie_DevInst *DevInst,
+		XAie_BrokerChain *Chain, AieRC RC)
+{
+	Chain->IsActive = XAIE_DISABLE;
+	if(Chain->HasTxn == XAIE_DISABLE) {
+		return RC;
+	}
+
+	Chain->HasTxn = XAIE_DISABLE;
+
+	return _XAie_BrokerEndTxn(DevInst, RC);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to execute the batch of a slot in the broker. The
+* batches of a transaction chained over several slots are executed as one
+* transaction of the broker device instance, which is only submitted with the
+* last batch.
+*
+* @param	DevInst: Device instance of the broker.
+* @param	Slot: Slot of the batch.
+* @param	Chain: State of the chained batches.
+*
+* @return	XAIE_OK on success, error code on failure. The last batch of a
+*		chain returns the first error of all the batches.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_BrokerExecuteSlot(XAie_DevInst *DevInst,
+		XAie_BrokerSlot *Slot, XAie_BrokerChain *Chain)
+{
+	u8 IsChained = (Slot->Flags & XAIE_BROKER_SLOT_CHAINED) ? 1U : 0U;
+
+	if(Chain->IsActive == XAIE_DISABLE) {
+		if(IsChained == 0U) {
+			return _XAie_BrokerExecuteBatch(DevInst, Slot,
+					XAIE_DISABLE);
+		}
+
+		Chain->IsActive = XAIE_ENABLE;
+		Chain->Status = XAie_StartTransaction(DevInst,
+				XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+		Chain->HasTxn = (Chain->Status == XAIE_OK) ? XAIE_ENABLE :
+			XAIE_DISABLE;
+	}
+
+	if(Chain->Status == XAIE_OK) {
+		Chain->Status = _XAie_BrokerExecuteBatch(DevInst, Slot,
+				XAIE_ENABLE);
+	}
+
+	if(IsChained != 0U) {
+		return Chain->Status;
+	}
+
+	return _XAie_BrokerEndChain(DevInst, Chain, Chain->Status);
+}
+
+static u64 _XAie_BrokerTimeNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return (u64)Ts.tv_sec * 1000000000ULL + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the function to reclaim the slots of clients which exited. The slots
+* of completed batches not collected by an exited client are freed. The slot
+* the broker waits for is skipped if its client exited before submitting it,
+* or if it has no owner for XAIE_BROKER_RESERVE_TIMEOUT_NS.
+*
+* @param	Ring: Ring of the broker.
+* @param	Stall: Slot the broker waited for at the previous call.
+*
+* @return	1 if the slot the broker waits for is skipped, 0 otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static u8 _XAie_BrokerReclaimSlots(XAie_BrokerRing *Ring,
+		XAie_BrokerStall *Stall)
+{
+	u64 Pos = Ring->DeqPos, Seq;
+	XAie_BrokerSlot *Slot;
+	u32 Owner;
+
+	for(u32 i = 0U; i < XAIE_BROKER_NUM_SLOTS; i++) {
+		Slot = &Ring->Slots[i];
+		Seq = atomic_load_explicit(&Slot->Seq, memory_order_acquire);
+		Owner = atomic_load_explicit(&Slot->Owner,
+				memory_order_relaxed);
+		if((Seq < 2U) || ((Seq - 2U) % XAIE_BROKER_NUM_SLOTS != i) ||
+				(Owner == 0U) ||
+				(_XAie_BrokerPidAlive(Owner) != 0U)) {
+			continue;
+		}
+
+		atomic_store_explicit(&Slot->Owner, 0U, memory_order_relaxed);
+		if(atomic_compare_exchange_strong_explicit(&Slot->Seq, &Seq,
+					Seq - 2U + XAIE_BROKER_NUM_SLOTS,
+					memory_order_release,
+					memory_order_relaxed)) {
+			XAIE_WARN("Reclaimed completed batch of exited client "
+					"%u\n", Owner);
+		}
+	}
+
+	Slot = &Ring->Slots[Pos % XAIE_BROKER_NUM_SLOTS];
+	if((atomic_load_explicit(&Ring->EnqPos, memory_order_relaxed) == Pos)
+			|| (atomic_load_explicit(&Slot->Seq,
+					memory_order_acquire) != Pos)) {
+		/* Slot is not reserved or already submitted */
+		return 0U;
+	}
+
+	Owner = atomic_load_explicit(&Slot->Owner, memory_order_relaxed);
+	if(Owner != 0U) {
+		if(_XAie_BrokerPidAlive(Owner) != 0U) {
+			return 0U;
+		}
+	} else {
+		u64 Now = _XAie_BrokerTimeNs();
+
+		if(Stall->Pos != Pos) {
+			Stall->Pos = Pos;
+			Stall->StartNs = Now;
+			return 0U;
+		}
+
+		if(Now - Stall->StartNs < XAIE_BROKER_RESERVE_TIMEOUT_NS) {
+			return 0U;
+		}
+	}
+
+	Seq = Pos;
+	if(!atomic_compare_exchange_strong_explicit(&Slot->Seq, &Seq,
+				Pos + XAIE_BROKER_NUM_SLOTS,
+				memory_order_release, memory_order_relaxed)) {
+		/* Submitted in the meantime */
+		return 0U;
+	}
+
+	atomic_store_explicit(&Slot->Owner, 0U, memory_order_relaxed);
+	XAIE_WARN("Reclaimed batch reserved by exited client %u\n", Owner);
+	Ring->DeqPos = Pos + 1U;
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API serves the IO operations of the clients of the broker backend with
+* the device instance of the calling process. It creates the shared memory
+* object of the broker and executes the batches of the clients until Stop is
+* set.
+*
+* @param	DevInst - Device instance pointer of the broker.
+* @param	Name - Name of the shared memory object. If NULL, the
+*		XAIE_BROKER_NAME environment variable is used, or
+*		"/xaie_broker" if it is not set.
+* @param	Stop - Pointer to the stop request. The API returns once it is
+*		set to a non zero value, e.g. by a signal handler.
+*
+* @return	XAIE_OK when stopped, error code on failure.
+*
+* @note		The clients attach when they initialize the broker backend and
+*		shall be finished before the broker is stopped. The operations
+*		of the clients are executed from the calling thread. While the
+*		broker is idle, it frees the slots of the clients which exited
+*		without collecting or submitting their batches.
+*
+******************************************************************************/
+AieRC XAie_BrokerServe(XAie_DevInst *DevInst, const char *Name,
+		const volatile u8 *Stop)
+{
+	struct timespec Sleep = {0, XAIE_BROKER_IDLE_SLEEP_NS};
+	XAie_BrokerStall Stall = {UINT64_MAX, 0U};
+	XAie_BrokerChain Chain = {0};
+	XAie_BrokerRing *Ring;
+	u32 IdleCount = 0U;
+	int Fd;
+
+	if((DevInst == XAIE_NULL) || (Stop == NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Name = _XAie_BrokerGetName(Name);
+
+	/* Remove the ring of a broker which did not exit cleanly */
+	shm_unlink(Name);
+	Fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+	if(Fd < 0) {
+		XAIE_ERROR("Failed to create broker %s, %d: %s\n", Name, errno,
+				strerror(errno));
+		return XAIE_ERR;
+	}
+
+	if(ftruncate(Fd, sizeof(*Ring)) != 0) {
+		XAIE_ERROR("Failed to size broker %s, %d: %s\n", Name, errno,
+				strerror(errno));
+		close(Fd);
+		shm_unlink(Name);
+		return XAIE_ERR;
+	}
+
+	Ring = mmap(NULL, sizeof(*Ring), PROT_READ | PROT_WRITE, MAP_SHARED,
+			Fd, 0);
+	close(Fd);
+	if(Ring == MAP_FAILED) {
+		XAIE_ERROR("Failed to map broker %s, %d: %s\n", Name, errno,
+				strerror(errno));
+		shm_unlink(Name);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < XAIE_BROKER_NUM_SLOTS; i++) {
+		atomic_init(&Ring->Slots[i].Seq, i);
+		atomic_init(&Ring->Slots[i].Owner, 0U);
+	}
+	atomic_init(&Ring->EnqPos, 0U);
+	Ring->DeqPos = 0U;
+	Ring->Version = XAIE_BROKER_VERSION;
+	Ring->BrokerPid = (u32)getpid();
+	atomic_init(&Ring->IsServing, 1U);
+	atomic_thread_fence(memory_order_release);
+	Ring->Magic = XAIE_BROKER_MAGIC;
+
+	while(*Stop == 0U) {
+		u64 Pos = Ring->DeqPos;
+		XAie_BrokerSlot *Slot = &Ring->Slots[Pos % XAIE_BROKER_NUM_SLOTS];
+		AieRC RC;
+
+		if(atomic_load_explicit(&Slot->Seq, memory_order_acquire) !=
+				Pos + 1U) {
+			if(++IdleCount < XAIE_BROKER_SPIN_COUNT) {
+				sched_yield();
+				continue;
+			}
+
+			nanosleep(&Sleep, NULL);
+			if(((IdleCount % XAIE_BROKER_RECLAIM_INTERVAL) == 0U) &&
+					(_XAie_BrokerReclaimSlots(Ring,
+						&Stall) != 0U) &&
+					(Chain.IsActive != XAIE_DISABLE)) {
+				/* Client of the chained batches exited */
+				_XAie_BrokerEndChain(DevInst, &Chain, XAIE_ERR);
+			}
+			continue;
+		}
+
+		IdleCount = 0U;
+		RC = _XAie_BrokerExecuteSlot(DevInst, Slot, &Chain);
+		if(Slot->Flags & XAIE_BROKER_SLOT_POSTED) {
+			if((RC != XAIE_OK) &&
+				!(Slot->Flags & XAIE_BROKER_SLOT_CHAINED)) {
+				XAIE_ERROR("Posted broker batch failed, %d\n",
+						RC);
+			}
+			atomic_store_explicit(&Slot->Owner, 0U,
+					memory_order_relaxed);
+			atomic_store_explicit(&Slot->Seq,
+					Pos + XAIE_BROKER_NUM_SLOTS,
+					memory_order_release);
+		} else {
+			Slot->Status = RC;
+			atomic_store_explicit(&Slot->Seq, Pos + 2U,
+					memory_order_release);
+		}
+		Ring->DeqPos = Pos + 1U;
+	}
+
+	if(Chain.IsActive != XAIE_DISABLE) {
+		_XAie_BrokerEndChain(DevInst, &Chain, XAIE_ERR);
+	}
+	atomic_store_explicit(&Ring->IsServing, 0U, memory_order_release);
+	munmap(Ring, sizeof(*Ring));
+	shm_unlink(Name);
+
+	return XAIE_OK;
+}
+
+#else
+
+static AieRC XAie_BrokerIO_Finish(void *IOInst)
+{
+	/* no-op */
+	(void)IOInst;
+	return XAIE_OK;
+}
+
+static AieRC XAie_BrokerIO_Init(XAie_DevInst *DevInst)
+{
+	/* no-op */
+	(void)DevInst;
+	XAIE_ERROR("Driver is not compiled with broker "
+			"backend (__AIEBROKER__)\n");
+	return XAIE_INVALID_BACKEND;
+}
+
+static AieRC XAie_BrokerIO_Write32(void *IOInst, u64 RegOff, u32 Value)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Value;
+
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Mask;
+	(void)Value;
+
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask,
+		u32 Value, u32 TimeOutUs)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Mask;
+	(void)Value;
+	(void)TimeOutUs;
+
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_BlockWrite32(void *IOInst, u64 RegOff,
+		const u32 *Data, u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
+		u32 Size)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)RegOff;
+	(void)Data;
+	(void)Size;
+
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
+		XAie_BackendOpCode Op, void *Arg)
+{
+	(void)IOInst;
+	(void)DevInst;
+	(void)Op;
+	(void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_BrokerServe(XAie_DevInst *DevInst, const char *Name,
+		const volatile u8 *Stop)
+{
+	(void)DevInst;
+	(void)Name;
+	(void)Stop;
+	XAIE_ERROR("Driver is not compiled with broker "
+			"backend (__AIEBROKER__)\n");
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+#endif /* __AIEBROKER__ */
+
+static XAie_MemInst* XAie_BrokerMemAllocate(XAie_DevInst *DevInst, u64 Size,
+		XAie_MemCacheProp Cache)
+{
+	(void)DevInst;
+	(void)Size;
+	(void)Cache;
+	return NULL;
+}
+
+static AieRC XAie_BrokerMemFree(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerMemSyncForCPU(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerMemSyncForDev(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerMemAttach(XAie_MemInst *MemInst, u64 MemHandle)
+{
+	(void)MemInst;
+	(void)MemHandle;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerMemDetach(XAie_MemInst *MemInst)
+{
+	(void)MemInst;
+	return XAIE_ERR;
+}
+
+static AieRC XAie_BrokerIO_CmdWrite(void *IOInst, u8 Col, u8 Row, u8 Command,
+		u32 CmdWd0, u32 CmdWd1, const char *CmdStr)
+{
+	/* no-op */
+	(void)IOInst;
+	(void)Col;
+	(void)Row;
+	(void)Command;
+	(void)CmdWd0;
+	(void)CmdWd1;
+	(void)CmdStr;
+
+	return XAIE_ERR;
+}
+
+const XAie_Backend BrokerBackend =
+{
+	.Type = XAIE_IO_BACKEND_BROKER,
+	.Ops.Init = XAie_BrokerIO_Init,
+	.Ops.Finish = XAie_BrokerIO_Finish,
+	.Ops.Write32 = XAie_BrokerIO_Write32,
+	.Ops.Read32 = XAie_BrokerIO_Read32,
+	.Ops.MaskWrite32 = XAie_BrokerIO_MaskWrite32,
+	.Ops.MaskPoll = XAie_BrokerIO_MaskPoll,
+	.Ops.BlockWrite32 = XAie_BrokerIO_BlockWrite32,
+	.Ops.BlockSet32 = XAie_BrokerIO_BlockSet32,
+	.Ops.CmdWrite = XAie_BrokerIO_CmdWrite,
+	.Ops.RunOp = XAie_BrokerIO_RunOp,
+	.Ops.MemAllocate = XAie_BrokerMemAllocate,
+	.Ops.MemFree = XAie_BrokerMemFree,
+	.Ops.MemSyncForCPU = XAie_BrokerMemSyncForCPU,
+	.Ops.MemSyncForDev = XAie_BrokerMemSyncForDev,
+	.Ops.MemAttach = XAie_BrokerMemAttach,
+	.Ops.MemDetach = XAie_BrokerMemDetach,
+#ifdef __AIEBROKER__
+	.Ops.GetTid = XAie_BrokerIO_GetTid,
+	.Ops.SubmitTxn = XAie_BrokerIO_SubmitTxn,
+#else
+	.Ops.GetTid = XAie_IODummyGetTid,
+	.Ops.SubmitTxn = NULL,
+#endif
+};
+
+/** @} */
@@ -479,6 +479,105 @@ AieRC _XAie_FreeRscCommon(XAie_BackendTilesRsc *Args)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* The API frees the resources granted to the first NumTilesRsc requests of a
+* resource request array.
+*
+*
+* @param	Args: Contains arguments for backend operation
+* @param	NumTilesRsc: Number of requests to roll back
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RollbackRscArrayCommon(XAie_BackendTilesRscArray *Args,
+		u32 NumTilesRsc)
+{
+	for(u32 i = 0U; i < NumTilesRsc; i++) {
+		XAie_BackendTilesRsc TilesRsc = Args->TilesRsc[i];
+
+		for(u32 j = 0U; j < TilesRsc.NumRscPerTile; j++) {
+			TilesRsc.RscId = TilesRsc.Rscs[j].RscId;
+			_XAie_FreeRscCommon(&TilesRsc);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* The API grants the resources of an array of requests. Either all the
+* requests are granted or none.
+*
+*
+* @param	DevInst: Device Instance
+* @param	Args: Contains arguments for backend operation
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RequestRscArrayCommon(XAie_DevInst *DevInst,
+		XAie_BackendTilesRscArray *Args)
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < Args->NumTilesRsc; i++) {
+		RC = _XAie_RequestRscCommon(DevInst, &Args->TilesRsc[i]);
+		if(RC != XAIE_OK) {
+			_XAie_RollbackRscArrayCommon(Args, i);
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* The API releases an array of resources statically and dynamically.
+*
+*
+* @param	Args: Contains arguments for backend operation
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_ReleaseRscArrayCommon(XAie_BackendTilesRscArray *Args)
+{
+	for(u32 i = 0U; i < Args->NumTilesRsc; i++) {
+		_XAie_ReleaseRscCommon(&Args->TilesRsc[i]);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* The API releases an array of resources dynamically.
+*
+*
+* @param	Args: Contains arguments for backend operation
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_FreeRscArrayCommon(XAie_BackendTilesRscArray *Args)
+{
+	for(u32 i = 0U; i < Args->NumTilesRsc; i++) {
+		_XAie_FreeRscCommon(&Args->TilesRsc[i]);
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 * The API requests statically allocated resource.
@@ -663,4 +762,45 @@ void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 	}
 }
 
+/*****************************************************************************/
+/**
+* This API clears the bitmap for the tiles which are released.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Args: Backend tile args
+*
+* @return       None.
+*
+* @note		Internal only. The backend decides which tiles are gated, so
+*		the whole column of a released tile is marked not in use. The
+*		tiles are requested again if they are used, see
+*		XAie_PmConfigLazyTiles().
+*
+*******************************************************************************/
+void _XAie_IOCommon_MarkTilesReleased(XAie_DevInst *DevInst,
+		XAie_BackendTilesArray *Args)
+{
+	u32 StartBit, NumTiles;
+
+	if (Args->Locs == NULL) {
+		NumTiles = DevInst->NumCols * (DevInst->NumRows - 1);
+		StartBit = _XAie_GetTileBitPosFromLoc(DevInst,
+					XAie_TileLoc(0, 1));
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse, StartBit,
+				NumTiles);
+		return;
+	}
+
+	for(u32 i = 0; i < Args->NumTiles; i++) {
+		if(Args->Locs[i].Row == 0) {
+			continue;
+		}
+
+		StartBit = _XAie_GetTileBitPosFromLoc(DevInst,
+				XAie_TileLoc(Args->Locs[i].Col, 1));
+		_XAie_ClrBitInBitmap(DevInst->DevOps->TilesInUse, StartBit,
+				DevInst->NumRows - 1);
+	}
+}
+
 /** @} */
@@ -31,6 +31,8 @@ static inline u64 XAie_IODummyGetTid(void)
 
 void _XAie_IOCommon_MarkTilesInUse(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args);
+void _XAie_IOCommon_MarkTilesReleased(XAie_DevInst *DevInst,
+		XAie_BackendTilesArray *Args);
 
 #ifndef XAIE_FEATURE_RSC_ENABLE
 static inline AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst,
@@ -59,6 +61,21 @@ static inline AieRC _XAie_GetRscStatCommon(XAie_DevInst *DevInst,
 	(void)Arg;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+static inline AieRC _XAie_RequestRscArrayCommon(XAie_DevInst *DevInst,
+		XAie_BackendTilesRscArray *Arg) {
+	(void)DevInst;
+	(void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC _XAie_ReleaseRscArrayCommon(
+		XAie_BackendTilesRscArray *Arg) {
+	(void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+static inline AieRC _XAie_FreeRscArrayCommon(XAie_BackendTilesRscArray *Arg) {
+	(void)Arg;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 #else /* XAIE_FEATURE_RSC_ENABLE */
 AieRC _XAie_RequestRscCommon(XAie_DevInst *DevInst, XAie_BackendTilesRsc *Arg);
 AieRC _XAie_ReleaseRscCommon(XAie_BackendTilesRsc *Arg);
@@ -66,6 +83,10 @@ AieRC _XAie_FreeRscCommon(XAie_BackendTilesRsc *Arg);
 AieRC _XAie_RequestAllocatedRscCommon(XAie_DevInst *DevInst,
 		XAie_BackendTilesRsc *Arg);
 AieRC _XAie_GetRscStatCommon(XAie_DevInst *DevInst, XAie_BackendRscStat *Arg);
+AieRC _XAie_RequestRscArrayCommon(XAie_DevInst *DevInst,
+		XAie_BackendTilesRscArray *Arg);
+AieRC _XAie_ReleaseRscArrayCommon(XAie_BackendTilesRscArray *Arg);
+AieRC _XAie_FreeRscArrayCommon(XAie_BackendTilesRscArray *Arg);
 #endif /* XAIE_FEATURE_RSC_ENABLE */
 
 #endif /* XAIE_IO_COMMON_H */
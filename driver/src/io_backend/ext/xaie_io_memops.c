@@ -0,0 +1,419 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_memops.c
+* @{
+*
+* This file contains the copy and fill routines used by the IO backends to
+* access the AI engine memories mapped to the user space. The bulk of the
+* transfer is done with aligned 128 bit or 256 bit stores. Non-temporal stores
+* are used on x86 as the mappings are uncached or write combined, followed by
+* a store fence. The implementation is selected at runtime based on the
+* features supported by the host cpu.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdint.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "xaie_io_memops.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define XAIE_IOMEM_X86
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_NEON)
+#define XAIE_IOMEM_NEON
+#include <arm_neon.h>
+#endif
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_IOMEM_ALIGN_128	16U
+#define XAIE_IOMEM_ALIGN_256	32U
+
+/****************************** Type Definitions *****************************/
+typedef void (*XAie_IOMemCopyFn)(u32 *Dest, const u32 *Src, u32 Size);
+typedef void (*XAie_IOMemSetFn)(u32 *Dest, u32 Data, u32 Size);
+
+/************************** Variable Definitions *****************************/
+static XAie_IOMemCopyFn _XAie_IOMemCopyFn = NULL;
+static XAie_IOMemSetFn _XAie_IOMemSetFn = NULL;
+#ifdef __linux__
+static pthread_once_t _XAie_IOMemSelectOnce = PTHREAD_ONCE_INIT;
+#endif
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This function returns the number of 32-bit words to be written before the
+* destination address reaches the given alignment.
+*
+* @param	Dest: Destination address.
+* @param	Align: Alignment in bytes.
+* @param	Size: Number of 32-bit words to be written.
+*
+* @return	Number of leading words.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_IOMem_HeadWords(const u32 *Dest, u32 Align, u32 Size)
+{
+	u32 Head = (u32)((Align - ((uintptr_t)Dest & (Align - 1U))) &
+			(Align - 1U)) / sizeof(u32);
+
+	return (Head < Size) ? Head : Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies data to the device memory with 32-bit stores. It is
+* used if no vector implementation is available for the host.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOMem_Copy32Scalar(u32 *Dest, const u32 *Src, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		((volatile u32 *)Dest)[i] = Src[i];
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the device memory with 32-bit stores. It is used if no
+* vector implementation is available for the host.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Data: Value to be written.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOMem_Set32Scalar(u32 *Dest, u32 Data, u32 Size)
+{
+	for(u32 i = 0U; i < Size; i++) {
+		((volatile u32 *)Dest)[i] = Data;
+	}
+}
+
+#ifdef XAIE_IOMEM_X86
+/*****************************************************************************/
+/**
+*
+* This function copies data to the device memory with 128-bit non-temporal
+* stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("sse2")))
+static void _XAie_IOMem_Copy32Sse2(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_128, Size);
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	for(; Size >= 4U; Size -= 4U, Dest += 4U, Src += 4U) {
+		_mm_stream_si128((__m128i *)Dest,
+				_mm_loadu_si128((const __m128i *)Src));
+	}
+	_mm_sfence();
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the device memory with 128-bit non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Data: Value to be written.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("sse2")))
+static void _XAie_IOMem_Set32Sse2(u32 *Dest, u32 Data, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_128, Size);
+	__m128i Val = _mm_set1_epi32((int)Data);
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Head);
+	Dest += Head;
+	Size -= Head;
+
+	for(; Size >= 4U; Size -= 4U, Dest += 4U) {
+		_mm_stream_si128((__m128i *)Dest, Val);
+	}
+	_mm_sfence();
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies data to the device memory with 256-bit non-temporal
+* stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("avx2")))
+static void _XAie_IOMem_Copy32Avx2(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_256, Size);
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	for(; Size >= 8U; Size -= 8U, Dest += 8U, Src += 8U) {
+		_mm256_stream_si256((__m256i *)Dest,
+				_mm256_loadu_si256((const __m256i *)Src));
+	}
+	_mm_sfence();
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the device memory with 256-bit non-temporal stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Data: Value to be written.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+__attribute__((target("avx2")))
+static void _XAie_IOMem_Set32Avx2(u32 *Dest, u32 Data, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_256, Size);
+	__m256i Val = _mm256_set1_epi32((int)Data);
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Head);
+	Dest += Head;
+	Size -= Head;
+
+	for(; Size >= 8U; Size -= 8U, Dest += 8U) {
+		_mm256_stream_si256((__m256i *)Dest, Val);
+	}
+	_mm_sfence();
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Size);
+}
+#endif /* XAIE_IOMEM_X86 */
+
+#ifdef XAIE_IOMEM_NEON
+/*****************************************************************************/
+/**
+*
+* This function copies data to the device memory with aligned 128-bit stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The barrier orders the stores with the
+*		subsequent accesses to the device.
+*
+*******************************************************************************/
+static void _XAie_IOMem_Copy32Neon(u32 *Dest, const u32 *Src, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_128, Size);
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Head);
+	Dest += Head;
+	Src += Head;
+	Size -= Head;
+
+	for(; Size >= 4U; Size -= 4U, Dest += 4U, Src += 4U) {
+		vst1q_u32(Dest, vld1q_u32(Src));
+	}
+
+	_XAie_IOMem_Copy32Scalar(Dest, Src, Size);
+	__sync_synchronize();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the device memory with aligned 128-bit stores.
+*
+* @param	Dest: Pointer to the destination address.
+* @param	Data: Value to be written.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IOMem_Set32Neon(u32 *Dest, u32 Data, u32 Size)
+{
+	u32 Head = _XAie_IOMem_HeadWords(Dest, XAIE_IOMEM_ALIGN_128, Size);
+	uint32x4_t Val = vdupq_n_u32(Data);
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Head);
+	Dest += Head;
+	Size -= Head;
+
+	for(; Size >= 4U; Size -= 4U, Dest += 4U) {
+		vst1q_u32(Dest, Val);
+	}
+
+	_XAie_IOMem_Set32Scalar(Dest, Data, Size);
+	__sync_synchronize();
+}
+#endif /* XAIE_IOMEM_NEON */
+
+/*****************************************************************************/
+/**
+*
+* This function selects the copy and fill implementations for the host cpu.
+*
+* @return	None.
+*
+* @note		Internal only. Called once, see _XAie_IOMem_Init().
+*
+*******************************************************************************/
+static void _XAie_IOMem_Select(void)
+{
+	XAie_IOMemCopyFn CopyFn = _XAie_IOMem_Copy32Scalar;
+	XAie_IOMemSetFn SetFn = _XAie_IOMem_Set32Scalar;
+
+#if defined(XAIE_IOMEM_X86)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2")) {
+		CopyFn = _XAie_IOMem_Copy32Avx2;
+		SetFn = _XAie_IOMem_Set32Avx2;
+	} else if(__builtin_cpu_supports("sse2")) {
+		CopyFn = _XAie_IOMem_Copy32Sse2;
+		SetFn = _XAie_IOMem_Set32Sse2;
+	}
+#elif defined(XAIE_IOMEM_NEON)
+	CopyFn = _XAie_IOMem_Copy32Neon;
+	SetFn = _XAie_IOMem_Set32Neon;
+#endif
+
+	_XAie_IOMemSetFn = SetFn;
+	_XAie_IOMemCopyFn = CopyFn;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function selects the copy and fill implementations on first use. The
+* selection runs once, also if several threads make their first transfer at
+* the same time.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline void _XAie_IOMem_Init(void)
+{
+#ifdef __linux__
+	pthread_once(&_XAie_IOMemSelectOnce, _XAie_IOMem_Select);
+#else
+	if(_XAie_IOMemCopyFn == NULL) {
+		_XAie_IOMem_Select();
+	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies a buffer to a memory mapped AI engine memory.
+*
+* @param	Dest: Pointer to the destination address. Must be 32-bit
+*		aligned.
+* @param	Src: Pointer to the source buffer.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The stores are complete when the function
+*		returns.
+*
+*******************************************************************************/
+void _XAie_IOMem_Copy32(u32 *Dest, const u32 *Src, u32 Size)
+{
+	_XAie_IOMem_Init();
+	_XAie_IOMemCopyFn(Dest, Src, Size);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a memory mapped AI engine memory with a value.
+*
+* @param	Dest: Pointer to the destination address. Must be 32-bit
+*		aligned.
+* @param	Data: Value to be written.
+* @param	Size: Number of 32-bit words.
+*
+* @return	None.
+*
+* @note		Internal only. The stores are complete when the function
+*		returns.
+*
+*******************************************************************************/
+void _XAie_IOMem_Set32(u32 *Dest, u32 Data, u32 Size)
+{
+	_XAie_IOMem_Init();
+	_XAie_IOMemSetFn(Dest, Data, Size);
+}
+
+/** @} */
@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_memops.h
+* @{
+*
+* This file contains the copy and fill routines used by the IO backends to
+* access the AI engine memories mapped to the user space.
+*
+******************************************************************************/
+#ifndef XAIE_IO_MEMOPS_H
+#define XAIE_IO_MEMOPS_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/************************** Function Prototypes  *****************************/
+void _XAie_IOMem_Copy32(u32 *Dest, const u32 *Src, u32 Size);
+void _XAie_IOMem_Set32(u32 *Dest, u32 Data, u32 Size);
+
+#endif		/* end of protection macro */
+/** @} */
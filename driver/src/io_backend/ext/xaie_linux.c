@@ -44,10 +44,12 @@
 #include "xaie_helper.h"
 #include "xaie_io.h"
 #include "xaie_io_common.h"
+#include "xaie_io_memops.h"
 #include "xaie_npi.h"
 
 /***************************** Macro Definitions *****************************/
-#define XAIE_128BIT_ALIGN_MASK 0xFF
+#define XAIE_LINUX_WC_NUM_CMDS 256U
+#define XAIE_LINUX_MAX_WR_RANGES 8U
 
 /****************************** Type Definitions *****************************/
 #ifdef __AIELINUX__
@@ -58,6 +60,37 @@ typedef struct XAie_MemMap {
 	u64 MapSize;
 } XAie_MemMap;
 
+/*
+ * Typedef for per thread write combine buffer. Register writes of a thread are
+ * queued in the buffer and submitted to the kernel with a single transaction
+ * ioctl.
+ */
+typedef struct XAie_LinuxWcBuf {
+	struct XAie_LinuxIO *IOInst;	/* IO instance of the buffer */
+	u32 NumCmds;			/* Number of queued commands */
+	XAie_TxnCmd Cmds[XAIE_LINUX_WC_NUM_CMDS];
+	struct XAie_LinuxWcBuf *Next;
+} XAie_LinuxWcBuf;
+
+/*
+ * Typedef for a range of tile registers which can be written directly through
+ * the writable register mapping in trusted mode. Offsets are relative to the
+ * tile base address.
+ */
+typedef struct XAie_LinuxWrRange {
+	u32 Start;
+	u32 End;
+} XAie_LinuxWrRange;
+
+/*
+ * Typedef for the write policy of a tile type. Registers outside of the listed
+ * ranges are protected and always written through the kernel.
+ */
+typedef struct XAie_LinuxWrPolicy {
+	u8 NumRanges;
+	XAie_LinuxWrRange Ranges[XAIE_LINUX_MAX_WR_RANGES];
+} XAie_LinuxWrPolicy;
+
 typedef struct XAie_LinuxIO {
 	XAie_DevInst *DevInst;
 	int DeviceFd;		/* File descriptor of the device */
@@ -78,16 +111,599 @@ typedef struct XAie_LinuxIO {
 	u8 RowShift;
 	u8 ColShift;
 	u64 BaseAddr;
+	u8 WcEnable;		/* Write combining status */
+	pthread_key_t WcKey;	/* Write combine buffer of the calling thread */
+	pthread_mutex_t WcLock;	/* Lock for the write combine buffer list */
+	XAie_LinuxWcBuf *WcBufs;/* List of per thread write combine buffers */
+	pthread_mutex_t RscLock;/* Serializes the resource array operations */
+	u8 TrustedMode;		/* Direct register write status */
+	XAie_MemMap WrRegMap;	/* Writable mapping of registers */
+	XAie_LinuxWrPolicy WrPolicy[XAIEGBL_TILE_TYPE_MAX];
 } XAie_LinuxIO;
 
-typedef struct XAie_LinuxMem {
-	int BufferFd;
-} XAie_LinuxMem;
+typedef struct XAie_LinuxMem {
+	int BufferFd;
+} XAie_LinuxMem;
+
+#endif /* __AIELINUX__ */
+
+/************************** Function Definitions *****************************/
+#ifdef __AIELINUX__
+
+/*****************************************************************************/
+/**
+*
+* This function submits a buffer of transaction commands to the kernel driver
+* with a single ioctl.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Cmds: Pointer to the transaction commands.
+* @param	NumCmds: Number of commands.
+*
+* @return	XAIE_OK for success and error code for failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_SubmitCmds(XAie_LinuxIO *IOInst, XAie_TxnCmd *Cmds,
+		u32 NumCmds)
+{
+	int Ret;
+	struct aie_txn_inst Args;
+
+	Args.num_cmds = NumCmds;
+	Args.cmdsptr = (u64)Cmds;
+
+	Ret = ioctl(IOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
+	if(Ret < 0) {
+		XAIE_ERROR("Submitting transaction to device failed, %d: %s\n",
+			errno, strerror(errno));
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits the commands queued in a write combine buffer to the
+* kernel with a single transaction ioctl.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	WcBuf: Write combine buffer
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The buffer is emptied even if the submission
+*		fails as the kernel reports the failing command.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WcSubmit(XAie_LinuxIO *IOInst,
+		XAie_LinuxWcBuf *WcBuf)
+{
+	AieRC RC;
+
+	if(WcBuf->NumCmds == 0U) {
+		return XAIE_OK;
+	}
+
+	RC = _XAie_LinuxIO_SubmitCmds(IOInst, WcBuf->Cmds, WcBuf->NumCmds);
+	WcBuf->NumCmds = 0U;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is called when a thread which queued register writes exits.
+* The writes left in the buffer of the thread are submitted and the buffer is
+* freed.
+*
+* @param	Arg: Write combine buffer of the exiting thread.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_WcThreadExit(void *Arg)
+{
+	XAie_LinuxWcBuf *WcBuf = (XAie_LinuxWcBuf *)Arg;
+	XAie_LinuxIO *IOInst = WcBuf->IOInst;
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	for(XAie_LinuxWcBuf **Prev = &IOInst->WcBufs; *Prev != NULL;
+			Prev = &(*Prev)->Next) {
+		if(*Prev == WcBuf) {
+			*Prev = WcBuf->Next;
+			break;
+		}
+	}
+	if(_XAie_LinuxIO_WcSubmit(IOInst, WcBuf) != XAIE_OK) {
+		XAIE_ERROR("Failed to flush writes of exiting thread\n");
+	}
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	free(WcBuf);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates the write combine buffer of the calling thread.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	Pointer to the write combine buffer, NULL on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_LinuxWcBuf *_XAie_LinuxIO_WcAllocBuf(XAie_LinuxIO *IOInst)
+{
+	XAie_LinuxWcBuf *WcBuf;
+
+	WcBuf = (XAie_LinuxWcBuf *)malloc(sizeof(*WcBuf));
+	if(WcBuf == NULL) {
+		XAIE_ERROR("Failed to allocate write combine buffer\n");
+		return NULL;
+	}
+
+	WcBuf->IOInst = IOInst;
+	WcBuf->NumCmds = 0U;
+	if(pthread_setspecific(IOInst->WcKey, WcBuf) != 0) {
+		XAIE_ERROR("Failed to set write combine buffer\n");
+		free(WcBuf);
+		return NULL;
+	}
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	WcBuf->Next = IOInst->WcBufs;
+	IOInst->WcBufs = WcBuf;
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	return WcBuf;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function flushes the register writes queued by the calling thread. It is
+* called before every operation which has to observe the effect of the queued
+* writes, such as register reads, polls, memory accesses and run ops, and before
+* unqueued register writes.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The buffer is checked even if write combining is
+*		disabled as writes queued before another thread disabled the
+*		mode are only flushed by their own thread.
+*
+*******************************************************************************/
+static inline AieRC _XAie_LinuxIO_WcFlush(XAie_LinuxIO *IOInst)
+{
+	XAie_LinuxWcBuf *WcBuf;
+
+	WcBuf = (XAie_LinuxWcBuf *)pthread_getspecific(IOInst->WcKey);
+	if((WcBuf == NULL) || (WcBuf->NumCmds == 0U)) {
+		return XAIE_OK;
+	}
+
+	return _XAie_LinuxIO_WcSubmit(IOInst, WcBuf);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function flushes the write combine buffers of all the threads and frees
+* them.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	XAIE_OK on success, Error code of the last failure otherwise.
+*
+* @note		Internal only. Queued writes of other threads are submitted in
+*		the context of the calling thread. It is called when the backend
+*		is finished, after which no other thread may use the buffers.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WcFreeAll(XAie_LinuxIO *IOInst)
+{
+	AieRC RC = XAIE_OK;
+	XAie_LinuxWcBuf *WcBuf, *Next;
+
+	pthread_mutex_lock(&IOInst->WcLock);
+	for(WcBuf = IOInst->WcBufs; WcBuf != NULL; WcBuf = Next) {
+		AieRC lRC;
+
+		Next = WcBuf->Next;
+		lRC = _XAie_LinuxIO_WcSubmit(IOInst, WcBuf);
+		if(lRC != XAIE_OK) {
+			RC = lRC;
+		}
+		free(WcBuf);
+	}
+	IOInst->WcBufs = NULL;
+	pthread_mutex_unlock(&IOInst->WcLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a register write in the write combine buffer of the
+* calling thread. The buffer is submitted when it is full.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	RegOff: Register offset to write to.
+* @param	Mask: Mask to be applied to Value. 0 for a full register write.
+* @param	Value: 32-bit data to be written.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_WcQueue(XAie_LinuxIO *IOInst, u64 RegOff, u32 Mask,
+		u32 Value)
+{
+	XAie_LinuxWcBuf *WcBuf;
+	XAie_TxnCmd *Cmd;
+
+	WcBuf = (XAie_LinuxWcBuf *)pthread_getspecific(IOInst->WcKey);
+	if(WcBuf == NULL) {
+		WcBuf = _XAie_LinuxIO_WcAllocBuf(IOInst);
+		if(WcBuf == NULL) {
+			return XAIE_ERR;
+		}
+	}
+
+	Cmd = &WcBuf->Cmds[WcBuf->NumCmds];
+	Cmd->Opcode = XAIE_IO_WRITE;
+	Cmd->RegOff = RegOff;
+	Cmd->Mask = Mask;
+	Cmd->Value = Value;
+	Cmd->DataPtr = 0U;
+	Cmd->Size = 0U;
+	WcBuf->NumCmds++;
+
+	if(WcBuf->NumCmds == XAIE_LINUX_WC_NUM_CMDS) {
+		return _XAie_LinuxIO_WcSubmit(IOInst, WcBuf);
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the register address of individual tiles for a given
+* offset that includes row and columns offsets.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+*
+* @return	Register address.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u64 _XAie_GetRegAddr(XAie_LinuxIO *IOInst, u64 RegOff)
+{
+	return RegOff & (~(ULONG_MAX << IOInst->RowShift));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the row number for a given register offset.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+*
+* @return	Column number.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u8 _XAie_GetRowNum(XAie_LinuxIO *IOInst, u64 RegOff)
+{
+	u64 Mask = ((1 << IOInst->ColShift) - 1) &
+			~((1 << IOInst->RowShift) - 1);
+
+	return (RegOff & Mask) >> IOInst->RowShift;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the column number for a given register offset.
+*
+* @param	IOInst: IO instance pointer
+* @param	RegOff: Register offset to read from.
+*
+* @return	Column number.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u8 _XAie_GetColNum(XAie_LinuxIO *IOInst, u64 RegOff)
+{
+	return RegOff >> IOInst->ColShift;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function enables or disables the write combining mode of the backend.
+* When disabling, the queued writes of the calling thread are flushed. Other
+* threads flush their queued writes at their next flush point, including their
+* next register write, as their buffers are not shared.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigWriteCombine(XAie_LinuxIO *IOInst, u8 Enable)
+{
+	if(Enable != 0U) {
+		__atomic_store_n(&IOInst->WcEnable, XAIE_ENABLE,
+				__ATOMIC_RELEASE);
+		return XAIE_OK;
+	}
+
+	__atomic_store_n(&IOInst->WcEnable, XAIE_DISABLE, __ATOMIC_RELEASE);
+
+	return _XAie_LinuxIO_WcFlush(IOInst);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a range of registers to the write policy of a tile type.
+*
+* @param	Policy: Write policy of the tile type
+* @param	Start: Tile relative offset of the first register
+* @param	Size: Size of the range in bytes
+*
+* @return	None.
+*
+* @note		Internal only. Empty ranges are ignored.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_AddWrRange(XAie_LinuxWrPolicy *Policy, u32 Start,
+		u32 Size)
+{
+	if(Size == 0U) {
+		return;
+	}
+
+	if(Policy->NumRanges >= XAIE_LINUX_MAX_WR_RANGES) {
+		XAIE_WARN("Write policy table full, range 0x%x stays protected\n",
+				Start);
+		return;
+	}
+
+	Policy->Ranges[Policy->NumRanges].Start = Start;
+	Policy->Ranges[Policy->NumRanges].End = Start + Size;
+	Policy->NumRanges++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds the span of the configuration registers of all ports of
+* a stream switch port table to the write policy of a tile type.
+*
+* @param	Policy: Write policy of the tile type
+* @param	Ports: Stream switch port table indexed by port type
+* @param	PortOffset: Offset between two consecutive ports
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_AddStrmWrRange(XAie_LinuxWrPolicy *Policy,
+		const XAie_StrmPort *Ports, u32 PortOffset)
+{
+	u32 Start = UINT32_MAX, End = 0U;
+
+	if(Ports == NULL) {
+		return;
+	}
+
+	for(u8 PortType = 0U; PortType < SS_PORT_TYPE_MAX; PortType++) {
+		u32 PortEnd;
+
+		if(Ports[PortType].NumPorts == 0U) {
+			continue;
+		}
+
+		PortEnd = Ports[PortType].PortBaseAddr +
+			Ports[PortType].NumPorts * PortOffset;
+		if(Ports[PortType].PortBaseAddr < Start) {
+			Start = Ports[PortType].PortBaseAddr;
+		}
+		if(PortEnd > End) {
+			End = PortEnd;
+		}
+	}
+
+	if(End > Start) {
+		_XAie_LinuxIO_AddWrRange(Policy, Start, End - Start);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds the per tile type write policy table from the register
+* definitions of the device. DMA buffer descriptors, DMA channel control and
+* start queue registers, lock values and stream switch port configurations
+* are writable. Buffer descriptors of the SHIM NOC tiles carry host addresses
+* which are validated by the kernel, hence they stay protected.
+*
+* @param	IOInst: Linux IO instance pointer
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_LinuxIO_BuildWrPolicy(XAie_LinuxIO *IOInst)
+{
+	const XAie_TileMod *DevMod = IOInst->DevInst->DevProp.DevMod;
+
+	for(u8 TileType = 0U; TileType < XAIEGBL_TILE_TYPE_MAX; TileType++) {
+		XAie_LinuxWrPolicy *Policy = &IOInst->WrPolicy[TileType];
+		const XAie_DmaMod *DmaMod = DevMod[TileType].DmaMod;
+		const XAie_LockMod *LockMod = DevMod[TileType].LockMod;
+		const XAie_StrmMod *StrmMod = DevMod[TileType].StrmSw;
+
+		Policy->NumRanges = 0U;
+
+		if(DmaMod != NULL) {
+			if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
+				_XAie_LinuxIO_AddWrRange(Policy,
+						DmaMod->BaseAddr,
+						DmaMod->NumBds *
+						DmaMod->IdxOffset);
+			}
+			_XAie_LinuxIO_AddWrRange(Policy, DmaMod->ChCtrlBase,
+					2U * DmaMod->NumChannels *
+					DmaMod->ChIdxOffset);
+			_XAie_LinuxIO_AddWrRange(Policy,
+					DmaMod->StartQueueBase,
+					2U * DmaMod->NumChannels *
+					DmaMod->ChIdxOffset);
+		}
+
+		/* Locks are set through reads for AIE, no set value regs */
+		if((LockMod != NULL) && (LockMod->LockSetValOff != 0U)) {
+			_XAie_LinuxIO_AddWrRange(Policy,
+					LockMod->LockSetValBase,
+					LockMod->NumLocks *
+					LockMod->LockSetValOff);
+		}
+
+		if(StrmMod != NULL) {
+			_XAie_LinuxIO_AddStrmWrRange(Policy,
+					StrmMod->MstrConfig,
+					StrmMod->PortOffset);
+			_XAie_LinuxIO_AddStrmWrRange(Policy,
+					StrmMod->SlvConfig,
+					StrmMod->PortOffset);
+			_XAie_LinuxIO_AddStrmWrRange(Policy,
+					StrmMod->SlvSlotConfig,
+					StrmMod->SlotOffsetPerPort);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the direct write address of a register if trusted mode
+* is enabled and the register is writable as per the write policy table.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	RegOff: Register offset
+*
+* @return	Virtual address of the register, NULL if the register has to be
+*		written through the kernel.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline volatile u32 *_XAie_LinuxIO_GetWrAddr(XAie_LinuxIO *IOInst,
+		u64 RegOff)
+{
+	const XAie_LinuxWrPolicy *Policy;
+	XAie_DevInst *DevInst = IOInst->DevInst;
+	XAie_LocType Loc;
+	u64 RegAddr;
+	u8 TileType;
+
+	if(IOInst->TrustedMode == 0U) {
+		return NULL;
+	}
 
-#endif /* __AIELINUX__ */
+	Loc.Row = _XAie_GetRowNum(IOInst, RegOff);
+	Loc.Col = _XAie_GetColNum(IOInst, RegOff);
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType >= XAIEGBL_TILE_TYPE_MAX) {
+		return NULL;
+	}
 
-/************************** Function Definitions *****************************/
-#ifdef __AIELINUX__
+	RegAddr = _XAie_GetRegAddr(IOInst, RegOff);
+	Policy = &IOInst->WrPolicy[TileType];
+	for(u8 i = 0U; i < Policy->NumRanges; i++) {
+		if((RegAddr >= Policy->Ranges[i].Start) &&
+				(RegAddr < Policy->Ranges[i].End)) {
+			return (volatile u32 *)((char *)IOInst->WrRegMap.VAddr +
+					RegOff);
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function enables or disables trusted mode. In trusted mode, the register
+* space of the partition is mapped writable and full word writes to
+* whitelisted registers are done with stores from the user space. Partial
+* masked writes and writes to all other registers go through the kernel.
+*
+* @param	IOInst: Linux IO instance pointer
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+*
+* @return	XAIE_OK on success, XAIE_FEATURE_NOT_SUPPORTED if the kernel
+*		does not allow a writable mapping of the register space.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_ConfigTrustedMode(XAie_LinuxIO *IOInst, u8 Enable)
+{
+	if(Enable == 0U) {
+		IOInst->TrustedMode = XAIE_DISABLE;
+		return XAIE_OK;
+	}
+
+	if(IOInst->WrRegMap.VAddr == NULL) {
+		void *VAddr;
+
+		VAddr = mmap(NULL, IOInst->RegMap.MapSize,
+				PROT_READ | PROT_WRITE, MAP_SHARED,
+				IOInst->PartitionFd, 0);
+		if(VAddr == MAP_FAILED) {
+			XAIE_ERROR("Failed to map register space for write"
+					" operations, %d: %s\n",
+					errno, strerror(errno));
+			return XAIE_FEATURE_NOT_SUPPORTED;
+		}
+
+		IOInst->WrRegMap.VAddr = VAddr;
+		IOInst->WrRegMap.MapSize = IOInst->RegMap.MapSize;
+		_XAie_LinuxIO_BuildWrPolicy(IOInst);
+	}
+
+	IOInst->TrustedMode = XAIE_ENABLE;
+
+	return XAIE_OK;
+}
 
 /*****************************************************************************/
 /**
@@ -106,6 +722,16 @@ static AieRC XAie_LinuxIO_Finish(void *IOInst)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
 
+	/* No thread exit handler runs once the key is deleted */
+	pthread_key_delete(LinuxIOInst->WcKey);
+	_XAie_LinuxIO_WcFreeAll(LinuxIOInst);
+	pthread_mutex_destroy(&LinuxIOInst->WcLock);
+	pthread_mutex_destroy(&LinuxIOInst->RscLock);
+
+	if(LinuxIOInst->WrRegMap.VAddr != NULL) {
+		munmap(LinuxIOInst->WrRegMap.VAddr,
+				LinuxIOInst->WrRegMap.MapSize);
+	}
 	munmap(LinuxIOInst->RegMap.VAddr, LinuxIOInst->RegMap.MapSize);
 	munmap(LinuxIOInst->ProgMem.VAddr, LinuxIOInst->ProgMem.MapSize);
 	munmap(LinuxIOInst->DataMem.VAddr, LinuxIOInst->DataMem.MapSize);
@@ -331,9 +957,26 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 	IOInst->ColShift = DevInst->DevProp.ColShift;
 	IOInst->BaseAddr = DevInst->BaseAddr;
 	IOInst->DeviceFd = Fd;
+	IOInst->WcEnable = XAIE_DISABLE;
+	IOInst->WcBufs = NULL;
+	IOInst->TrustedMode = XAIE_DISABLE;
+	IOInst->WrRegMap.VAddr = NULL;
+	IOInst->WrRegMap.MapSize = 0U;
+	if(pthread_key_create(&IOInst->WcKey, _XAie_LinuxIO_WcThreadExit)
+			!= 0) {
+		XAIE_ERROR("Failed to create write combine key\n");
+		close(Fd);
+		free(IOInst);
+		return XAIE_ERR;
+	}
+	pthread_mutex_init(&IOInst->WcLock, NULL);
+	pthread_mutex_init(&IOInst->RscLock, NULL);
 
 	RC = _XAie_LinuxIO_GetPartition(DevInst, IOInst);
 	if(RC != XAIE_OK) {
+		pthread_key_delete(IOInst->WcKey);
+		pthread_mutex_destroy(&IOInst->WcLock);
+		pthread_mutex_destroy(&IOInst->RscLock);
 		free(IOInst);
 		return RC;
 	}
@@ -343,6 +986,9 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 
 	RC = _XAie_LinuxIO_MapMemory(DevInst, IOInst);
 	if(RC != XAIE_OK) {
+		pthread_key_delete(IOInst->WcKey);
+		pthread_mutex_destroy(&IOInst->WcLock);
+		pthread_mutex_destroy(&IOInst->RscLock);
 		free(IOInst);
 		return XAIE_ERR;
 	}
@@ -370,9 +1016,33 @@ static AieRC XAie_LinuxIO_Init(XAie_DevInst *DevInst)
 static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	volatile u32 *WrAddr;
 	int Ret;
+	AieRC RC;
 	struct aie_reg_args Args;
 
+	WrAddr = _XAie_LinuxIO_GetWrAddr(LinuxIOInst, RegOff);
+	if(WrAddr != NULL) {
+		/* Keep ordering with the writes queued by this thread */
+		RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		*WrAddr = Value;
+		__sync_synchronize();
+		return XAIE_OK;
+	}
+
+	if(__atomic_load_n(&LinuxIOInst->WcEnable, __ATOMIC_ACQUIRE) != 0U) {
+		return _XAie_LinuxIO_WcQueue(LinuxIOInst, RegOff, 0U, Value);
+	}
+
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Args.op = AIE_REG_WRITE;
 	Args.offset = RegOff;
 	Args.val = Value;
@@ -409,6 +1079,12 @@ static AieRC XAie_LinuxIO_Write32(void *IOInst, u64 RegOff, u32 Value)
 static AieRC XAie_LinuxIO_Read32(void *IOInst, u64 RegOff, u32 *Data)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC;
+
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
 
 	*Data = *((u32 *)(LinuxIOInst->RegMap.VAddr + RegOff));
 
@@ -435,9 +1111,39 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 		u32 Value)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	volatile u32 *WrAddr;
 	int Ret;
+	AieRC RC;
 	struct aie_reg_args Args;
 
+	/*
+	 * A read-modify-write through the user space mapping is not atomic
+	 * with respect to the kernel and other processes writing the same
+	 * register. Only full word writes use the direct path.
+	 */
+	if(Mask == 0xFFFFFFFFU) {
+		WrAddr = _XAie_LinuxIO_GetWrAddr(LinuxIOInst, RegOff);
+		if(WrAddr != NULL) {
+			RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			*WrAddr = Value;
+			__sync_synchronize();
+			return XAIE_OK;
+		}
+	}
+
+	if(__atomic_load_n(&LinuxIOInst->WcEnable, __ATOMIC_ACQUIRE) != 0U) {
+		return _XAie_LinuxIO_WcQueue(LinuxIOInst, RegOff, Mask, Value);
+	}
+
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
 	Args.op = AIE_REG_WRITE;
 	Args.offset = RegOff;
 	Args.val = Value;
@@ -476,9 +1182,14 @@ static AieRC XAie_LinuxIO_MaskWrite32(void *IOInst, u64 RegOff, u32 Mask,
 static AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value,
 		u32 TimeOutUs)
 {
-	AieRC Ret = XAIE_ERR;
+	AieRC Ret;
 	u32 Count, MinTimeOutUs, RegVal;
 
+	Ret = _XAie_LinuxIO_WcFlush((XAie_LinuxIO *)IOInst);
+	if(Ret != XAIE_OK) {
+		return Ret;
+	}
+
 	/*
 	 * Any value less than 200 us becomes noticable overhead. This is based
 	 * on some profiling, and it may vary between platforms.
@@ -487,81 +1198,27 @@ static AieRC XAie_LinuxIO_MaskPoll(void *IOInst, u64 RegOff, u32 Mask, u32 Value
 	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
 
 	while (Count > 0U) {
-		XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
+		Ret = XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
+		if(Ret != XAIE_OK) {
+			return Ret;
+		}
 		if((RegVal & Mask) == Value) {
-			Ret = XAIE_OK;
-			break;
+			return XAIE_OK;
 		}
 		usleep(MinTimeOutUs);
 		Count--;
 	}
 
 	/* Check for the break from timed-out loop */
-	XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
-	if((Ret == XAIE_ERR) && ((RegVal & Mask) ==
-			 Value)) {
-		Ret = XAIE_OK;
+	Ret = XAie_LinuxIO_Read32(IOInst, RegOff, &RegVal);
+	if(Ret != XAIE_OK) {
+		return Ret;
+	}
+	if((RegVal & Mask) == Value) {
+		return XAIE_OK;
 	}
 
-	return Ret;
-}
-
-/*****************************************************************************/
-/**
-*
-* This function returns the register address of individual tiles for a given
-* offset that includes row and columns offsets.
-*
-* @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-*
-* @return	Register address.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static inline u64 _XAie_GetRegAddr(XAie_LinuxIO *IOInst, u64 RegOff)
-{
-	return RegOff & (~(ULONG_MAX << IOInst->RowShift));
-}
-
-/*****************************************************************************/
-/**
-*
-* This function returns the row number for a given register offset.
-*
-* @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-*
-* @return	Column number.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static inline u8 _XAie_GetRowNum(XAie_LinuxIO *IOInst, u64 RegOff)
-{
-	u64 Mask = ((1 << IOInst->ColShift) - 1) &
-			~((1 << IOInst->RowShift) - 1);
-
-	return (RegOff & Mask) >> IOInst->RowShift;
-}
-
-/*****************************************************************************/
-/**
-*
-* This function returns the column number for a given register offset.
-*
-* @param	IOInst: IO instance pointer
-* @param	RegOff: Register offset to read from.
-*
-* @return	Column number.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static inline u8 _XAie_GetColNum(XAie_LinuxIO *IOInst, u64 RegOff)
-{
-	return RegOff >> IOInst->ColShift;
+	return XAIE_ERR;
 }
 
 /*****************************************************************************/
@@ -596,68 +1253,6 @@ static inline u64 _XAie_GetMemOffset(XAie_LinuxIO *IOInst, u8 TileType, u8 Col,
 	return 0;
 }
 
-/*****************************************************************************/
-/**
-*
-* This function copies data to the device using memcpy. The function accepts
-* a 32 bit aligned address. 128bit unaligned addresses are managed within the
-* funtion.
-*
-* @param	Dest: Pointer to the destination address.
-* @param	Src: Pointer to the source buffer.
-* @param	Size: Number of 32-bit words.
-*
-* @return	None.
-*
-* @note		Internal only.
-*
-*******************************************************************************/
-static void _XAie_CopyDataToMem(u32 *Dest, const u32 *Src, u32 Size)
-{
-	u32 StartExtraWrds = 0, EndExtraWrds = 0;
-
-	if((u64)Dest & XAIE_128BIT_ALIGN_MASK) {
-		StartExtraWrds = ((XAIE_128BIT_ALIGN_MASK + 1) -
-				(((u64)Dest) & XAIE_128BIT_ALIGN_MASK)) / 4;
-	}
-
-	if(StartExtraWrds > 0) {
-		for(u8 i = 0; i < StartExtraWrds && Size > 0;  i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if((u64)(Dest + Size) & XAIE_128BIT_ALIGN_MASK) {
-		EndExtraWrds = (((u64)(Dest + Size)) &
-				XAIE_128BIT_ALIGN_MASK) / 4;
-	}
-
-	if(Size >= (XAIE_128BIT_ALIGN_MASK + 1)) {
-		memcpy((void *)Dest, (void *)Src,
-				(Size - EndExtraWrds) * sizeof(u32));
-		Dest += Size - EndExtraWrds;
-		Src += Size - EndExtraWrds;
-		Size -= Size - EndExtraWrds;
-	}
-
-	if(Size > 0) {
-		for(u8 i = 0; Size > 0; i++) {
-			*Dest = *Src;
-			Dest++;
-			Src++;
-			Size--;
-		}
-	}
-
-	if(Size != 0) {
-		XAIE_ERROR("Copying data to memory failed. %u words not"
-				"written to device\n", Size);
-	}
-}
-
 /*****************************************************************************/
 /**
 *
@@ -735,11 +1330,17 @@ static AieRC XAie_LinuxIO_BlockWrite32(void *IOInst, u64 RegOff,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL) {
-		_XAie_CopyDataToMem(VirtAddr, Data, Size);
+		RC = _XAie_LinuxIO_WcFlush(Inst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		_XAie_IOMem_Copy32(VirtAddr, Data, Size);
 		return XAIE_OK;
 	}
 
@@ -773,13 +1374,17 @@ static AieRC XAie_LinuxIO_BlockSet32(void *IOInst, u64 RegOff, u32 Data,
 {
 	XAie_LinuxIO *Inst = (XAie_LinuxIO *)IOInst;
 	u32 *VirtAddr;
+	AieRC RC;
 
 	/* Handle PM and DM sections */
 	VirtAddr =  _XAie_GetVirtAddrFromOffset(Inst, RegOff, Size);
 	if(VirtAddr != NULL) {
-		for(u32 i = 0; i < Size; i++) {
-			*VirtAddr++ = Data;
+		RC = _XAie_LinuxIO_WcFlush(Inst);
+		if(RC != XAIE_OK) {
+			return RC;
 		}
+
+		_XAie_IOMem_Set32(VirtAddr, Data, Size);
 		return XAIE_OK;
 	}
 
@@ -1250,6 +1855,89 @@ static AieRC _XAie_LinuxIO_FreeRsc(void *IOInst, XAie_BackendTilesRsc *Args)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* The API grants the resources of an array of requests. Either all the requests
+* are granted or none.
+*
+*
+* @param	IOInst: IO instance pointer
+* @param	Args: Contains arguments for backend operation
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only. The kernel driver grants one request per ioctl.
+*		The requests are issued under the resource lock of the instance
+*		so the threads sharing it observe the array as a whole, and the
+*		resources granted to the previous requests are freed if a
+*		request fails.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_RequestRscArray(void *IOInst,
+		XAie_BackendTilesRscArray *Args)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC = XAIE_OK;
+
+	pthread_mutex_lock(&LinuxIOInst->RscLock);
+	for(u32 i = 0U; i < Args->NumTilesRsc; i++) {
+		RC = _XAie_LinuxIO_RequestRsc(IOInst, &Args->TilesRsc[i]);
+		if(RC == XAIE_OK) {
+			continue;
+		}
+
+		for(u32 j = 0U; j < i; j++) {
+			XAie_BackendTilesRsc TilesRsc = Args->TilesRsc[j];
+
+			for(u32 k = 0U; k < TilesRsc.NumRscPerTile; k++) {
+				TilesRsc.RscId = TilesRsc.Rscs[k].RscId;
+				_XAie_LinuxIO_FreeRsc(IOInst, &TilesRsc);
+			}
+		}
+		break;
+	}
+	pthread_mutex_unlock(&LinuxIOInst->RscLock);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* The API releases or frees an array of resources.
+*
+*
+* @param	IOInst: IO instance pointer
+* @param	Args: Contains arguments for backend operation
+* @param	IsRelease: 1 to release the resources statically and
+*			   dynamically, 0 to free them dynamically only.
+*
+* @return	XAIE_OK on success
+*
+* @note		Internal only. The kernel driver releases one resource per
+*		ioctl. The resources are released under the resource lock of
+*		the instance.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_PutRscArray(void *IOInst,
+		XAie_BackendTilesRscArray *Args, u8 IsRelease)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	AieRC RC = XAIE_OK;
+
+	pthread_mutex_lock(&LinuxIOInst->RscLock);
+	for(u32 i = 0U; i < Args->NumTilesRsc; i++) {
+		if(IsRelease != 0U) {
+			RC |= _XAie_LinuxIO_ReleaseRsc(IOInst,
+					&Args->TilesRsc[i]);
+		} else {
+			RC |= _XAie_LinuxIO_FreeRsc(IOInst, &Args->TilesRsc[i]);
+		}
+	}
+	pthread_mutex_unlock(&LinuxIOInst->RscLock);
+
+	return RC;
+}
+
 /*****************************************************************************/
 /**
 * The API requests statically allocated resource.
@@ -1332,6 +2020,42 @@ AieRC _XAie_LinuxIO_GetRscStat(void *IOInst, XAie_BackendRscStat *Arg)
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read a block of 32bit registers from the
+* mapped register space of the partition.
+*
+* @param	IOInst: IO instance pointer
+* @param	Req: Block read request.
+*
+* @return	XAIE_OK.
+*
+* @note		Internal only. The write combine buffer is flushed by the
+*		caller.
+*
+*******************************************************************************/
+static AieRC _XAie_LinuxIO_BlockRead32(void *IOInst,
+		XAie_BackendBlockRdReq *Req)
+{
+	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
+	volatile u32 *RdAddr;
+
+	/* Handle PM and DM sections */
+	RdAddr = _XAie_GetVirtAddrFromOffset(LinuxIOInst, Req->RegOff,
+			Req->Size);
+	if(RdAddr == NULL) {
+		RdAddr = (volatile u32 *)(LinuxIOInst->RegMap.VAddr +
+				Req->RegOff);
+	}
+
+	for(u32 i = 0U; i < Req->Size; i++) {
+		Req->Data[i] = RdAddr[i];
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 
@@ -1352,7 +2076,24 @@ static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 {
 	AieRC RC;
 
+	if(Op == XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE) {
+		return _XAie_LinuxIO_ConfigWriteCombine(IOInst, *((u8 *)Arg));
+	}
+	if(Op == XAIE_BACKEND_OP_CONFIG_TRUSTED_MODE) {
+		return _XAie_LinuxIO_ConfigTrustedMode(IOInst, *((u8 *)Arg));
+	}
+
+	RC = _XAie_LinuxIO_WcFlush((XAie_LinuxIO *)IOInst);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to flush write combine buffer\n");
+		return RC;
+	}
+
 	switch(Op) {
+	case XAIE_BACKEND_OP_WRITE_FENCE:
+		return XAIE_OK;
+	case XAIE_BACKEND_OP_BLOCK_READ32:
+		return _XAie_LinuxIO_BlockRead32(IOInst, Arg);
 	case XAIE_BACKEND_OP_CONFIG_SHIMDMABD:
 		return _XAie_LinuxIO_ConfigShimDmaBd(IOInst, Arg);
 	case XAIE_BACKEND_OP_REQUEST_TILES:
@@ -1362,13 +2103,23 @@ static AieRC XAie_LinuxIO_RunOp(void *IOInst, XAie_DevInst *DevInst,
 					(XAie_BackendTilesArray *)Arg);
 		return RC;
 	case XAIE_BACKEND_OP_RELEASE_TILES:
-		return _XAie_LinuxIO_ReleaseTiles(IOInst, Arg);
+		RC = _XAie_LinuxIO_ReleaseTiles(IOInst, Arg);
+		if(RC == XAIE_OK)
+			_XAie_IOCommon_MarkTilesReleased(DevInst,
+					(XAie_BackendTilesArray *)Arg);
+		return RC;
 	case XAIE_BACKEND_OP_REQUEST_RESOURCE:
 		return _XAie_LinuxIO_RequestRsc(IOInst, Arg);
 	case XAIE_BACKEND_OP_RELEASE_RESOURCE:
 		return _XAie_LinuxIO_ReleaseRsc(IOInst, Arg);
 	case XAIE_BACKEND_OP_FREE_RESOURCE:
 		return _XAie_LinuxIO_FreeRsc(IOInst, Arg);
+	case XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY:
+		return _XAie_LinuxIO_RequestRscArray(IOInst, Arg);
+	case XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY:
+		return _XAie_LinuxIO_PutRscArray(IOInst, Arg, 1U);
+	case XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY:
+		return _XAie_LinuxIO_PutRscArray(IOInst, Arg, 0U);
 	case XAIE_BACKEND_OP_REQUEST_ALLOCATED_RESOURCE:
 		return _XAie_LinuxIO_RequestAllocatedRsc(IOInst, Arg);
 	case XAIE_BACKEND_OP_GET_RSC_STAT:
@@ -1395,26 +2146,22 @@ static u64 XAie_LinuxGetTid(void)
 *
 * @return	XAIE_OK for success and error code for failure.
 *
-* @note		Internal only.
+* @note		Internal only. Register writes queued by the calling thread in
+*		write combining mode are submitted first.
 *
 *******************************************************************************/
 static AieRC XAie_LinuxSubmitTxn(void *IOInst, XAie_TxnInst *TxnInst)
 {
 	XAie_LinuxIO *LinuxIOInst = (XAie_LinuxIO *)IOInst;
-	int Ret;
-	struct aie_txn_inst Args;
-
-	Args.num_cmds = TxnInst->NumCmds;
-	Args.cmdsptr = (u64)TxnInst->CmdBuf;
+	AieRC RC;
 
-	Ret = ioctl(LinuxIOInst->PartitionFd, AIE_TRANSACTION_IOCTL, &Args);
-	if(Ret < 0) {
-		XAIE_ERROR("Submitting transaction to device failed, %d: %s\n",
-			errno, strerror(errno));
-		return XAIE_ERR;
+	RC = _XAie_LinuxIO_WcFlush(LinuxIOInst);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	return XAIE_OK;
+	return _XAie_LinuxIO_SubmitCmds(LinuxIOInst, TxnInst->CmdBuf,
+			TxnInst->NumCmds);
 }
 
 #else
@@ -22,7 +22,16 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#endif /* __linux__ */
+
 #include <stdlib.h>
+#include <string.h>
 
 #include "xaie_clock.h"
 #include "xaie_feature_config.h"
@@ -42,6 +51,15 @@
 #define XAIE_ISOLATE_ALL_MASK	((1U << 4) - 1)
 
 #define XAIE_ERROR_NPI_INTR_ID	0x1U
+
+/**************************** Type Definitions *******************************/
+/* Phase of a partition initialization or teardown sequence */
+typedef struct {
+	XAie_PartPhase Phase;
+	u8 Enable;
+	u32 Opts;	/* Initialization options of the phase, 0 for always */
+} XAie_PartPhaseStep;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
@@ -330,126 +348,277 @@ static AieRC _XAie_PrivilegeSetL2ErrIrq(XAie_DevInst *DevInst)
 
 /*****************************************************************************/
 /**
-* This API initializes the AI engine partition
+* This API sets the L2 error IRQ channels and enables the NPI interrupt of
+* the partition
 *
 * @param	DevInst: AI engine partition device instance pointer
-* @param	Opts: Initialization options
 *
 * @return       XAIE_OK on success, error code on failure
 *
-* @note		This operation does the following steps to initialize an AI
-*		engine partition:
-*		- Clock gate all columns
-*		- Reset Columns
-*		- Ungate all Columns
-*		- Remove columns reset
-*		- Reset shims
-*		- Setup AXI MM not to return errors for AXI decode or slave
-*		  errors, raise events instead.
-*		- ungate all columns
-*		- Setup partition isolation.
-*		- zeroize memory if it is requested
+* @note		This function is internal to this file.
 *
 *******************************************************************************/
-AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
+static AieRC _XAie_PrivilegeSetPartIrq(XAie_DevInst *DevInst)
 {
-	u32 OptFlags;
 	AieRC RC;
 
-	if(Opts != NULL) {
-		OptFlags = Opts->InitOpts;
-	} else {
-		OptFlags = XAIE_PART_INIT_OPT_DEFAULT;
-	}
-
-	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
+	RC = _XAie_PrivilegeSetL2ErrIrq(DevInst);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to initialize partition, enable protected registers failed.\n");
+		XAIE_ERROR("Failed to configure L2 error IRQ channels\n");
 		return RC;
 	}
 
-	if((OptFlags & XAIE_PART_INIT_OPT_COLUMN_RST) != 0) {
-		/* Gate all tiles before resetting columns to quiet traffic*/
-		RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
-		}
+	/* Enable NPI interrupt to PS GIC */
+	RC = _XAie_NpiIrqEnable(DevInst, XAIE_ERROR_NPI_INTR_ID,
+				XAIE_ERROR_NPI_INTR_ID);
+	if (RC != XAIE_OK) {
+		XAIE_ERROR("Failed to enable NPI interrupt\n");
+	}
 
-		RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_ENABLE);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
-		}
+	return RC;
+}
 
-		/* Enable clock buffer before removing column reset */
-		RC = _XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
-		}
+static inline u64 _XAie_PrivilegeGetNs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000000UL + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
 
-		RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_DISABLE);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
-		}
+/*****************************************************************************/
+/**
+* This API runs the operation of a partition initialization or teardown phase
+* on all the columns of the partition.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Phase: Phase to run
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE, for the phases which
+*			set or clear a configuration.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		This function is internal to this file.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegePhaseOp(XAie_DevInst *DevInst,
+		XAie_PartPhase Phase, u8 Enable)
+{
+	switch(Phase) {
+	case XAIE_PART_PHASE_PROT_REGS:
+		return _XAie_PrivilegeSetPartProtectedRegs(DevInst, Enable);
+	case XAIE_PART_PHASE_CLOCK:
+		return _XAie_PmSetPartitionClock(DevInst, Enable);
+	case XAIE_PART_PHASE_COL_RST:
+		return _XAie_PrivilegeSetPartColReset(DevInst, Enable);
+	case XAIE_PART_PHASE_SHIM_RST:
+		return _XAie_PrivilegeRstPartShims(DevInst);
+	case XAIE_PART_PHASE_AXIMM_ERR:
+		return _XAie_PrivilegeSetPartBlockAxiMmNsuErr(DevInst, Enable,
+				Enable);
+	case XAIE_PART_PHASE_CLOCK_AFTER_RST:
+		return DevInst->DevOps->SetPartColClockAfterRst(DevInst,
+				Enable);
+	case XAIE_PART_PHASE_ISOLATE:
+		return DevInst->DevOps->SetPartIsolationAfterRst(DevInst);
+	case XAIE_PART_PHASE_MEM_ZERO:
+		return DevInst->DevOps->PartMemZeroInit(DevInst);
+	case XAIE_PART_PHASE_IRQ:
+		return _XAie_PrivilegeSetPartIrq(DevInst);
+	default:
+		return XAIE_INVALID_ARGS;
+	}
+}
 
+/*****************************************************************************/
+/**
+* This API runs a partition initialization or teardown phase and adds its
+* time to the timing breakdown of the device instance.
+*
+* The column writes of a phase do not depend on each other. If the backend
+* takes transactions and the calling code is not recording one, the phase is
+* recorded as one transaction with auto flush and submitted to the backend
+* at once, instead of one backend access per register. The submission at the
+* end of the phase is the barrier to the next phase. The NPI operations and
+* register polls of a phase flush the writes recorded before them, so the
+* order within a phase is kept as well.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Phase: Phase to run
+* @param	Enable: XAIE_ENABLE or XAIE_DISABLE
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		This function is internal to this file.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeRunPhase(XAie_DevInst *DevInst,
+		XAie_PartPhase Phase, u8 Enable)
+{
+	XAie_PartPhaseTimes *Times = &DevInst->PartTimes;
+	XAie_TxnInst *TxnInst;
+	u8 Batch = XAIE_DISABLE;
+	u64 StartNs;
+	AieRC RC;
+
+	StartNs = _XAie_PrivilegeGetNs();
+
+	if((DevInst->Backend->Ops.SubmitTxn != NULL) &&
+			(DevInst->TxnList.Next == NULL)) {
+		RC = _XAie_Txn_Start(DevInst,
+				XAIE_TRANSACTION_ENABLE_AUTO_FLUSH);
+		Batch = (RC == XAIE_OK) ? XAIE_ENABLE : XAIE_DISABLE;
 	}
 
-	if((OptFlags & XAIE_PART_INIT_OPT_SHIM_RST) != 0) {
-		RC = _XAie_PrivilegeRstPartShims(DevInst);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
+	RC = _XAie_PrivilegePhaseOp(DevInst, Phase, Enable);
+
+	if(Batch == XAIE_ENABLE) {
+		TxnInst = _XAie_TxnDetach(DevInst);
+		if(TxnInst == NULL) {
+			return XAIE_ERR;
 		}
-	}
 
-	if((OptFlags & XAIE_PART_INIT_OPT_BLOCK_NOCAXIMMERR) != 0) {
-		RC = _XAie_PrivilegeSetPartBlockAxiMmNsuErr(DevInst,
-			XAIE_ENABLE, XAIE_ENABLE);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-			return RC;
+		if((RC == XAIE_OK) && (TxnInst->NumCmds > 0U)) {
+			RC = _XAie_TxnExecute(DevInst, TxnInst);
+		} else {
+			/* Nothing left to submit or the phase failed */
+			_XAie_Txn_FreePayloads(TxnInst);
+			free(TxnInst->CmdBuf);
+			free(TxnInst);
 		}
+		Times->NumBatched++;
 	}
 
-	RC = DevInst->DevOps->SetPartColClockAfterRst(DevInst, XAIE_ENABLE);
+	Times->PhaseNs[Phase] += _XAie_PrivilegeGetNs() - StartNs;
+	Times->PhaseRuns[Phase]++;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API runs the phases of a partition initialization or teardown in order.
+* The protected registers are enabled before the first phase and disabled
+* after the last one, or after the phase which failed.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Steps: Phases to run
+* @param	NumSteps: Number of phases
+* @param	OptFlags: Partition initialization options. A phase with
+*			options is skipped if none of its options is set.
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		This function is internal to this file.
+*
+*******************************************************************************/
+static AieRC _XAie_PrivilegeRunPhases(XAie_DevInst *DevInst,
+		const XAie_PartPhaseStep *Steps, u32 NumSteps, u32 OptFlags)
+{
+	u64 StartNs;
+	AieRC RC;
+
+	memset(&DevInst->PartTimes, 0, sizeof(DevInst->PartTimes));
+	StartNs = _XAie_PrivilegeGetNs();
+
+	RC = _XAie_PrivilegeRunPhase(DevInst, XAIE_PART_PHASE_PROT_REGS,
+			XAIE_ENABLE);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+		XAIE_ERROR("Enable protected registers failed.\n");
 		return RC;
 	}
 
-	if ((OptFlags & XAIE_PART_INIT_OPT_ISOLATE) != 0) {
-		RC = DevInst->DevOps->SetPartIsolationAfterRst(DevInst);
-		if(RC != XAIE_OK) {
-			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+	for(u32 i = 0U; i < NumSteps; i++) {
+		if((Steps[i].Opts != 0U) &&
+				((OptFlags & Steps[i].Opts) == 0U)) {
+			continue;
 		}
-	}
 
-	if ((OptFlags & XAIE_PART_INIT_OPT_ZEROIZEMEM) != 0) {
-		RC = DevInst->DevOps->PartMemZeroInit(DevInst);
+		RC = _XAie_PrivilegeRunPhase(DevInst, Steps[i].Phase,
+				Steps[i].Enable);
 		if(RC != XAIE_OK) {
 			_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+			DevInst->PartTimes.TotalNs = _XAie_PrivilegeGetNs() -
+				StartNs;
 			return RC;
 		}
 	}
 
-	RC = _XAie_PrivilegeSetL2ErrIrq(DevInst);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to configure L2 error IRQ channels\n");
-		return RC;
+	RC = _XAie_PrivilegeRunPhase(DevInst, XAIE_PART_PHASE_PROT_REGS,
+			XAIE_DISABLE);
+	DevInst->PartTimes.TotalNs = _XAie_PrivilegeGetNs() - StartNs;
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API initializes the AI engine partition
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Opts: Initialization options
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		This operation does the following steps to initialize an AI
+*		engine partition:
+*		- Clock gate all columns
+*		- Reset Columns
+*		- Ungate all Columns
+*		- Remove columns reset
+*		- Reset shims
+*		- Setup AXI MM not to return errors for AXI decode or slave
+*		  errors, raise events instead.
+*		- ungate all columns
+*		- Setup partition isolation.
+*		- zeroize memory if it is requested
+*		The time spent in each step is returned by
+*		XAie_GetPartitionPhaseTimes().
+*
+*******************************************************************************/
+AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
+{
+	static const XAie_PartPhaseStep InitSteps[] = {
+		/* Gate all tiles before resetting columns to quiet traffic*/
+		{XAIE_PART_PHASE_CLOCK, XAIE_DISABLE,
+			XAIE_PART_INIT_OPT_COLUMN_RST},
+		{XAIE_PART_PHASE_COL_RST, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_COLUMN_RST},
+		/* Enable clock buffer before removing column reset */
+		{XAIE_PART_PHASE_CLOCK, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_COLUMN_RST},
+		{XAIE_PART_PHASE_COL_RST, XAIE_DISABLE,
+			XAIE_PART_INIT_OPT_COLUMN_RST},
+		{XAIE_PART_PHASE_SHIM_RST, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_SHIM_RST},
+		{XAIE_PART_PHASE_AXIMM_ERR, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_BLOCK_NOCAXIMMERR},
+		{XAIE_PART_PHASE_CLOCK_AFTER_RST, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_ISOLATE, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_ISOLATE},
+		{XAIE_PART_PHASE_MEM_ZERO, XAIE_ENABLE,
+			XAIE_PART_INIT_OPT_ZEROIZEMEM},
+		{XAIE_PART_PHASE_IRQ, XAIE_ENABLE, 0U},
+	};
+	u32 OptFlags;
+	AieRC RC;
+
+	if(Opts != NULL) {
+		OptFlags = Opts->InitOpts;
+	} else {
+		OptFlags = XAIE_PART_INIT_OPT_DEFAULT;
 	}
 
-	/* Enable NPI interrupt to PS GIC */
-	RC = _XAie_NpiIrqEnable(DevInst, XAIE_ERROR_NPI_INTR_ID,
-				XAIE_ERROR_NPI_INTR_ID);
-	if (RC != XAIE_OK) {
-		XAIE_ERROR("Failed to enable NPI interrupt\n");
-		return RC;
+	RC = _XAie_PrivilegeRunPhases(DevInst, InitSteps,
+			sizeof(InitSteps) / sizeof(InitSteps[0]), OptFlags);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to initialize partition.\n");
 	}
 
-	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 	return RC;
 }
 
@@ -472,72 +641,74 @@ AieRC _XAie_PrivilegeInitPart(XAie_DevInst *DevInst, XAie_PartInitOpts *Opts)
 *		- Ungate all columns
 *		- Zeroize memories
 *		- Clock gate all columns
+*		The time spent in each step is returned by
+*		XAie_GetPartitionPhaseTimes().
 *
 *******************************************************************************/
 AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst)
 {
+	static const XAie_PartPhaseStep TeardownSteps[] = {
+		{XAIE_PART_PHASE_CLOCK, XAIE_DISABLE, 0U},
+		{XAIE_PART_PHASE_COL_RST, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_CLOCK, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_COL_RST, XAIE_DISABLE, 0U},
+		{XAIE_PART_PHASE_SHIM_RST, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_CLOCK_AFTER_RST, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_MEM_ZERO, XAIE_ENABLE, 0U},
+		{XAIE_PART_PHASE_CLOCK, XAIE_DISABLE, 0U},
+	};
 	AieRC RC;
 
-	RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
+	RC = _XAie_PrivilegeRunPhases(DevInst, TeardownSteps,
+			sizeof(TeardownSteps) / sizeof(TeardownSteps[0]), 0U);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Failed to teardown partition, enable protected registers failed.\n");
-		return RC;
+		XAIE_ERROR("Failed to teardown partition.\n");
 	}
 
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
-	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
-	}
-
-	RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_ENABLE);
-	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
-	}
-
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_ENABLE);
-	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
-	}
-
-	RC = _XAie_PrivilegeSetPartColReset(DevInst, XAIE_DISABLE);
-	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
-	}
+	return RC;
+}
 
-	RC = _XAie_PrivilegeRstPartShims(DevInst);
-	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
+/*****************************************************************************/
+/**
+* This API enables clock for all the tiles passed as argument to this API.
+*
+* @param	DevInst: AI engine partition device instance pointer
+* @param	Args: Backend tile args
+*
+* @return       XAIE_OK on success, error code on failure
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_PrivilegeRequestTiles(XAie_DevInst *DevInst,
+		XAie_BackendTilesArray *Args)
+{
+	AieRC RC;
+	/* TODO: Configure previlege registers only for non-AIE devices. */
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to initialize partition, enable"
+					" protected registers failed.\n");
+			 return RC;
+		}
 	}
 
-	RC = DevInst->DevOps->SetPartColClockAfterRst(DevInst, XAIE_ENABLE);
+	RC = DevInst->DevOps->RequestTiles(DevInst, Args);
 	if(RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
-	}
-
-	RC = DevInst->DevOps->PartMemZeroInit(DevInst);
-	if (RC != XAIE_OK) {
-		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
+		XAIE_ERROR("Request tiles failed\n");
 	}
 
-	RC = _XAie_PmSetPartitionClock(DevInst, XAIE_DISABLE);
-	if(RC != XAIE_OK) {
+	if (DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
-		return RC;
 	}
 
-	return _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
+	return RC;
 }
 
 /*****************************************************************************/
 /**
-* This API enables clock for all the tiles passed as argument to this API.
+* This API gates clock for all the tiles passed as argument to this API.
 *
 * @param	DevInst: AI engine partition device instance pointer
 * @param	Args: Backend tile args
@@ -547,26 +718,26 @@ AieRC _XAie_PrivilegeTeardownPart(XAie_DevInst *DevInst)
 * @note		Internal only.
 *
 *******************************************************************************/
-AieRC _XAie_PrivilegeRequestTiles(XAie_DevInst *DevInst,
+AieRC _XAie_PrivilegeReleaseTiles(XAie_DevInst *DevInst,
 		XAie_BackendTilesArray *Args)
 {
 	AieRC RC;
-	/* TODO: Configure previlege registers only for non-AIE devices. */
+
 	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
 		RC = _XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_ENABLE);
 		if(RC != XAIE_OK) {
-			XAIE_ERROR("Failed to initialize partition, enable"
+			XAIE_ERROR("Failed to release tiles, enable"
 					" protected registers failed.\n");
-			 return RC;
+			return RC;
 		}
 	}
 
-	RC = DevInst->DevOps->RequestTiles(DevInst, Args);
+	RC = DevInst->DevOps->ReleaseTiles(DevInst, Args);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Request tiles failed\n");
+		XAIE_ERROR("Release tiles failed\n");
 	}
 
-	if (DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
 		_XAie_PrivilegeSetPartProtectedRegs(DevInst, XAIE_DISABLE);
 	}
 
@@ -594,5 +765,13 @@ AieRC _XAie_PrivilegeRequestTiles(XAie_DevInst *DevInst,
 	(void)Args;
 	return XAIE_FEATURE_NOT_SUPPORTED;
 }
+
+AieRC _XAie_PrivilegeReleaseTiles(XAie_DevInst *DevInst,
+		XAie_BackendTilesArray *Args)
+{
+	(void)DevInst;
+	(void)Args;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE && !XAIE_FEATURE_LITE */
 /** @} */
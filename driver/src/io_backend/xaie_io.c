@@ -25,6 +25,9 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_io.h"
@@ -42,6 +45,8 @@
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_BAREMETAL
 #elif defined (__AIESOCKET__)
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_SOCKET
+#elif defined (__AIEBROKER__)
+	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_BROKER
 #else
 	#define __AIEDEBUG__
 	#define XAIE_DEFAULT_BACKEND XAIE_IO_BACKEND_DEBUG
@@ -82,6 +87,28 @@
 #else
 	#define DEBUGBACKEND NULL
 #endif
+#if defined (__AIEBROKER__)
+	#define BROKERBACKEND &BrokerBackend
+#else
+	#define BROKERBACKEND NULL
+#endif
+
+#define XAIE_IO_MAX_CUSTOM_BACKENDS	8U
+#define XAIE_IO_BACKEND_NAME_LEN	32U
+#define XAIE_IO_MAX_STACK_DEPTH		4U
+#define XAIE_IO_BACKEND_ENV		"XAIE_IO_BACKEND"
+#define XAIE_IO_BACKEND_SEPARATOR	','
+
+/****************************** Type Definitions *****************************/
+/*
+ * Typedef for a backend registered by the application. A copy of the backend
+ * is kept for each type of backend it can be stacked on, so that the stacked
+ * backend reports the type of the backend below it.
+ */
+typedef struct {
+	char Name[XAIE_IO_BACKEND_NAME_LEN];
+	XAie_Backend Backend[XAIE_IO_BACKEND_MAX];
+} XAie_CustomBackend;
 
 /************************** Variable Definitions *****************************/
 extern const XAie_Backend MetalBackend;
@@ -91,6 +118,7 @@ extern const XAie_Backend BaremetalBackend;
 extern const XAie_Backend DebugBackend;
 extern const XAie_Backend LinuxBackend;
 extern const XAie_Backend SocketBackend;
+extern const XAie_Backend BrokerBackend;
 
 static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 {
@@ -101,33 +129,228 @@ static const XAie_Backend *IOBackend[XAIE_IO_BACKEND_MAX] =
 	DEBUGBACKEND,
 	LINUXBACKEND,
 	SOCKETBACKEND,
+	BROKERBACKEND,
+	NULL,
 };
 
+static const char *IOBackendName[XAIE_IO_BACKEND_MAX] =
+{
+	"metal",
+	"sim",
+	"cdo",
+	"baremetal",
+	"debug",
+	"linux",
+	"socket",
+	"broker",
+	NULL,
+};
+
+static XAie_CustomBackend CustomBackend[XAIE_IO_MAX_CUSTOM_BACKENDS];
+static u32 NumCustomBackends;
+
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
 *
-* This is the api initialize global IO instance. The default IO backend is
-* libmetal.
+* This is the api to find a backend by name.
+*
+* @param	Name - Name of the backend. Not required to be null terminated.
+* @param	Len - Length of the name.
+* @param	Type - Type of the backend below it if the backend is stacked,
+*		XAIE_IO_BACKEND_CUSTOM otherwise.
+*
+* @return	Backend pointer, NULL if the backend is not found or cannot be
+*		stacked.
+*
+* @note		Internal Only.
+*
+******************************************************************************/
+static const XAie_Backend* _XAie_FindBackend(const char *Name, u32 Len,
+		XAie_BackendType Type)
+{
+	for(u32 i = 0U; i < XAIE_IO_BACKEND_MAX; i++) {
+		if((IOBackendName[i] == NULL) ||
+				(strlen(IOBackendName[i]) != Len) ||
+				(strncmp(IOBackendName[i], Name, Len) != 0)) {
+			continue;
+		}
+
+		/* Built-in backends are always at the bottom of the stack */
+		if(Type != XAIE_IO_BACKEND_CUSTOM) {
+			XAIE_ERROR("Backend %s cannot be stacked\n",
+					IOBackendName[i]);
+			return NULL;
+		}
+
+		return IOBackend[i];
+	}
+
+	for(u32 i = 0U; i < NumCustomBackends; i++) {
+		if((strlen(CustomBackend[i].Name) == Len) &&
+				(strncmp(CustomBackend[i].Name, Name, Len) ==
+				 0)) {
+			return &CustomBackend[i].Backend[Type];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api to register an IO backend with the driver. The backend can
+* be selected by its name with XAie_Config.BackendName, the XAIE_IO_BACKEND
+* environment variable or XAie_SetIOBackendByName().
+*
+* @param	Name - Name of the backend.
+* @param	Ops - Backend operations. SubmitTxn is optional, all other
+*		operations are mandatory.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if the arguments are
+*		invalid or the name is in use, XAIE_ERR if no more backends
+*		can be registered.
+*
+* @note		The operations are copied. Registration is not thread safe and
+*		shall be done before the device instances are initialized.
+*
+******************************************************************************/
+AieRC XAie_RegisterBackend(const char *Name, const XAie_BackendOps *Ops)
+{
+	XAie_CustomBackend *Custom;
+	u32 Len;
+
+	if((Name == NULL) || (Ops == NULL) || (Ops->Init == NULL) ||
+			(Ops->Finish == NULL) || (Ops->Write32 == NULL) ||
+			(Ops->Read32 == NULL) || (Ops->MaskWrite32 == NULL) ||
+			(Ops->MaskPoll == NULL) || (Ops->BlockWrite32 == NULL) ||
+			(Ops->BlockSet32 == NULL) || (Ops->CmdWrite == NULL) ||
+			(Ops->RunOp == NULL) || (Ops->MemAllocate == NULL) ||
+			(Ops->MemFree == NULL) || (Ops->MemSyncForCPU == NULL) ||
+			(Ops->MemSyncForDev == NULL) ||
+			(Ops->MemAttach == NULL) || (Ops->MemDetach == NULL) ||
+			(Ops->GetTid == NULL)) {
+		XAIE_ERROR("Invalid backend arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Len = strlen(Name);
+	if((Len == 0U) || (Len >= XAIE_IO_BACKEND_NAME_LEN) ||
+			(strchr(Name, XAIE_IO_BACKEND_SEPARATOR) != NULL)) {
+		XAIE_ERROR("Invalid backend name %s\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(_XAie_FindBackend(Name, Len, XAIE_IO_BACKEND_CUSTOM) != NULL) {
+		XAIE_ERROR("Backend %s is already registered\n", Name);
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumCustomBackends >= XAIE_IO_MAX_CUSTOM_BACKENDS) {
+		XAIE_ERROR("Too many backends registered\n");
+		return XAIE_ERR;
+	}
+
+	Custom = &CustomBackend[NumCustomBackends];
+	strcpy(Custom->Name, Name);
+	for(u32 Type = 0U; Type < XAIE_IO_BACKEND_MAX; Type++) {
+		Custom->Backend[Type].Type = (XAie_BackendType)Type;
+		Custom->Backend[Type].Ops = *Ops;
+	}
+	NumCustomBackends++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the api initialize global IO instance. The backend stack is selected
+* by name. If no name is given, the XAIE_IO_BACKEND environment variable is
+* used and if it is not set, the default backend of the build is used.
 *
 * @param	DevInst - Device instance pointer.
+* @param	Name - Comma separated list of backend names, top most backend
+*		first, or NULL.
 *
 * @return	XAIE_OK on success and error code on failure.
 *
 * @note		Internal Only.
 *
 ******************************************************************************/
-AieRC XAie_IOInit(XAie_DevInst *DevInst)
+AieRC XAie_IOInit(XAie_DevInst *DevInst, const char *Name)
 {
 	AieRC RC;
 	const XAie_Backend *Backend = IOBackend[XAIE_DEFAULT_BACKEND];
+	const XAie_Backend *Stack[XAIE_IO_MAX_STACK_DEPTH];
+	const char *Names[XAIE_IO_MAX_STACK_DEPTH];
+	u32 Lens[XAIE_IO_MAX_STACK_DEPTH];
+	u32 Depth = 0U;
+
+	if(Name == NULL) {
+		Name = getenv(XAIE_IO_BACKEND_ENV);
+	}
+
+	if(Name == NULL) {
+		RC = Backend->Ops.Init(DevInst);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		DevInst->Backend = Backend;
+
+		XAIE_DBG("Initialized with backend %d\n", Backend->Type);
+
+		return XAIE_OK;
+	}
 
-	RC = Backend->Ops.Init(DevInst);
-	if(RC != XAIE_OK) {
-		return RC;
+	while(1) {
+		const char *End = strchr(Name, XAIE_IO_BACKEND_SEPARATOR);
+
+		if(Depth >= XAIE_IO_MAX_STACK_DEPTH) {
+			XAIE_ERROR("Too many stacked backends\n");
+			return XAIE_INVALID_BACKEND;
+		}
+
+		Names[Depth] = Name;
+		Lens[Depth] = (End == NULL) ? strlen(Name) :
+			(u32)(End - Name);
+		Depth++;
+
+		if(End == NULL) {
+			break;
+		}
+		Name = End + 1;
 	}
 
-	DevInst->Backend = Backend;
+	/* Initialize the backends from the bottom of the stack */
+	for(u32 i = Depth; i > 0U; i--) {
+		XAie_BackendType Type = XAIE_IO_BACKEND_CUSTOM;
+
+		if(i < Depth) {
+			Type = Stack[i]->Type;
+		}
+
+		Backend = _XAie_FindBackend(Names[i - 1U], Lens[i - 1U], Type);
+		if(Backend == NULL) {
+			XAIE_ERROR("Invalid backend %.*s\n", (int)Lens[i - 1U],
+					Names[i - 1U]);
+			RC = XAIE_INVALID_BACKEND;
+		} else {
+			RC = Backend->Ops.Init(DevInst);
+		}
+
+		if(RC != XAIE_OK) {
+			if(i < Depth) {
+				DevInst->Backend->Ops.Finish(DevInst->IOInst);
+			}
+			return RC;
+		}
+
+		Stack[i - 1U] = Backend;
+		DevInst->Backend = Backend;
+	}
 
 	XAIE_DBG("Initialized with backend %d\n", Backend->Type);
 
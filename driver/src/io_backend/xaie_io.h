@@ -53,6 +53,13 @@ typedef enum {
 	XAIE_BACKEND_OP_PARTITION_TEARDOWN,
 	XAIE_BACKEND_OP_GET_RSC_STAT,
 	XAIE_BACKEND_OP_UPDATE_NPI_ADDR,
+	XAIE_BACKEND_OP_CONFIG_WRITE_COMBINE,
+	XAIE_BACKEND_OP_WRITE_FENCE,
+	XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY,
+	XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY,
+	XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY,
+	XAIE_BACKEND_OP_CONFIG_TRUSTED_MODE,
+	XAIE_BACKEND_OP_BLOCK_READ32,
 } XAie_BackendOpCode;
 
 /*
@@ -73,6 +80,15 @@ typedef struct XAie_BackendNpiMaskPollReq {
 	u32 TimeOutUs;
 } XAie_BackendNpiMaskPollReq;
 
+/*
+ * Typedef for structure for block read request
+ */
+typedef struct XAie_BackendBlockRdReq {
+	u64 RegOff;
+	u32 *Data;
+	u32 Size;
+} XAie_BackendBlockRdReq;
+
 /*
  * Typedef for structure for tiles array
  */
@@ -102,6 +118,15 @@ typedef struct XAie_BackendTilesRsc {
 	XAie_UserRsc *Rscs;
 } XAie_BackendTilesRsc;
 
+/*
+ * Typedef for structure for an array of tiles resource requests. Requests of
+ * the array are granted all together or not at all.
+ */
+typedef struct XAie_BackendTilesRscArray {
+	XAie_BackendTilesRsc *TilesRsc;
+	u32 NumTilesRsc;
+} XAie_BackendTilesRscArray;
+
 /*
  * Typedef for enum of AIE resoure statistics type
  */
@@ -145,7 +170,10 @@ typedef struct XAie_BackendRscStat {
  * MemAttach    : Backend operation to attach memory to AI engine device.
  * MemDetach    : Backend operation to detach memory from AI engine device
  * GetTid	: Backend operation to get unique thread id.
- * SubmitTxn	: Backend operation to submit transaction.
+ * SubmitTxn	: Backend operation to submit transaction. The commands and
+ *		 their payloads are owned by the driver. The backend shall only
+ *		 read them and shall not keep references to them after it
+ *		 returns.
  */
 typedef struct XAie_BackendOps {
 	AieRC (*Init)(XAie_DevInst *DevInst);
@@ -172,7 +200,19 @@ typedef struct XAie_BackendOps {
 	AieRC (*SubmitTxn)(void *IOInst, XAie_TxnInst *TxnInst);
 } XAie_BackendOps;
 
-/* Typedef to capture all backend information */
+/*
+ * Typedef to capture all backend information.
+ *
+ * Backends registered with XAie_RegisterBackend() can be stacked on top of
+ * another backend by selecting them with a comma separated list of names, top
+ * most backend first, e.g. "profiler,linux". The backends are initialized from
+ * the bottom. When the Init operation of a stacked backend is called,
+ * DevInst->Backend and DevInst->IOInst refer to the backend below it. The
+ * stacked backend shall save them, set DevInst->IOInst to its own instance and
+ * forward the operations it does not handle. Its Finish operation shall finish
+ * the backend below it. A stacked backend inherits the type of the backend
+ * below it.
+ */
 struct XAie_Backend {
 	XAie_BackendType Type;
 	XAie_BackendOps Ops;
@@ -190,8 +230,9 @@ typedef struct XAie_ShimDmaBdArgs {
 } XAie_ShimDmaBdArgs;
 
 /************************** Function Prototypes  *****************************/
-AieRC XAie_IOInit(XAie_DevInst *DevInst);
+AieRC XAie_IOInit(XAie_DevInst *DevInst, const char *Name);
 const XAie_Backend* _XAie_GetBackendPtr(XAie_BackendType Backend);
+AieRC XAie_RegisterBackend(const char *Name, const XAie_BackendOps *Ops);
 
 /*****************************************************************************/
 /**
@@ -0,0 +1,872 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_stats.c
+* @{
+*
+* This file contains routines to collect statistics of the IO operations issued
+* to the backend. Each thread accounts its operations to its own statistics
+* block without taking any lock. The block carries a sequence count which is
+* odd while the thread updates it, so that a query copies a consistent
+* snapshot of the block, and a reset generation, so that a reset does not have
+* to write to the blocks of the other threads. The blocks of all the threads
+* are merged when the statistics are queried.
+*
+* Every operation is counted, but reading the clock costs more than a write
+* combined register write, so only every Nth operation of a thread is timed,
+* see XAie_SetIoStatsSampling(). The timed operations can also be attributed
+* to the public API of the driver called by the application. On Linux, the API
+* of a timed operation is found by walking the call stack up to the outermost
+* frame within the driver library and its name is resolved with dladdr() when
+* the statistics are queried. This requires the driver to be built as a shared
+* library. The operations of a public API which tail calls an internal
+* function, and of the internal worker threads, are reported with an unknown
+* API. Build with -fno-optimize-sibling-calls to avoid the former.
+*
+* The statistics are collected only if the driver is compiled with
+* XAIE_FEATURE_IO_STATS_ENABLE. Otherwise, the IO operations are not
+* instrumented and the APIs of this file return XAIE_FEATURE_NOT_SUPPORTED.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+#ifdef __linux__
+
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <link.h>
+#include <pthread.h>
+#include <time.h>
+
+#if defined(__has_include)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define XAIE_IO_STATS_BACKTRACE
+#endif
+#endif
+
+#endif /* __linux__ */
+
+#include <stdlib.h>
+#include <string.h>
+#endif /* XAIE_FEATURE_IO_STATS_ENABLE */
+
+#include "xaie_helper.h"
+#include "xaie_io_stats.h"
+
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+/***************************** Macro Definitions *****************************/
+#define XAIE_IO_STATS_MAX_FRAMES	64
+#define XAIE_IO_STATS_CALLER_BITS	8U
+#define XAIE_IO_STATS_MAX_CALLERS	(1U << XAIE_IO_STATS_CALLER_BITS)
+#define XAIE_IO_STATS_DEFAULT_PERIOD	256U
+
+/****************************** Type Definitions *****************************/
+/*
+ * Statistics of a thread. Callers is an open addressed hash table keyed by the
+ * return address into the public API, an entry with a zero count is free. The
+ * return addresses are resolved when the statistics are queried.
+ */
+typedef struct XAie_IoStatsBlock {
+	XAie_IoOpStats Ops[XAIE_IO_STATS_OP_MAX];
+	XAie_IoCallerStats Callers[XAIE_IO_STATS_MAX_CALLERS];
+	u32 NumCallers;
+	u64 NumLost;
+	u32 Seq;			/* Odd while the owner updates the block */
+	u32 Epoch;			/* Reset generation of the statistics */
+	u32 NumUntimed;			/* Operations since the last timed one */
+	struct XAie_IoStatsBlock *Next;
+} XAie_IoStatsBlock;
+
+/************************** Variable Definitions *****************************/
+#ifdef __linux__
+/*
+ * Only the pointer to the block is thread local. The initial exec model keeps
+ * its access to a single load, the block is too large for the static TLS area
+ * reserved for the libraries loaded with dlopen().
+ */
+static _Thread_local XAie_IoStatsBlock *ThreadStats
+	__attribute__((tls_model("initial-exec")));
+static pthread_mutex_t StatsLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t StatsKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t StatsKey;
+#else
+static XAie_IoStatsBlock *ThreadStats;
+static XAie_IoStatsBlock MainStats;
+#endif
+/* Statistics of the exited threads, protected by StatsLock */
+static XAie_IoStatsBlock RetiredStats;
+static XAie_IoStatsBlock *StatsList = &RetiredStats;
+static u32 StatsEpoch;
+static u32 StatsPeriod = XAIE_IO_STATS_DEFAULT_PERIOD;
+static u8 StatsCallers;
+
+#ifdef XAIE_IO_STATS_BACKTRACE
+static pthread_once_t StatsLibOnce = PTHREAD_ONCE_INIT;
+static uintptr_t StatsLibStart;
+static uintptr_t StatsLibEnd;
+#endif
+
+/************************** Function Definitions *****************************/
+static inline void _XAie_IoStatsLock(void)
+{
+#ifdef __linux__
+	pthread_mutex_lock(&StatsLock);
+#endif
+}
+
+static inline void _XAie_IoStatsUnlock(void)
+{
+#ifdef __linux__
+	pthread_mutex_unlock(&StatsLock);
+#endif
+}
+
+static inline u64 _XAie_IoStatsGetNs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000000UL + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*
+ * The owner of a block brackets its updates with these routines. Only the
+ * owner writes to Seq, so no read-modify-write is required.
+ */
+static inline void _XAie_IoStatsWriteBegin(XAie_IoStatsBlock *Block)
+{
+	__atomic_store_n(&Block->Seq, Block->Seq + 1U, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void _XAie_IoStatsWriteEnd(XAie_IoStatsBlock *Block)
+{
+	__atomic_store_n(&Block->Seq, Block->Seq + 1U, __ATOMIC_RELEASE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API copies a consistent snapshot of the statistics block of a thread
+* which may be updating it concurrently.
+*
+* @param	Dst: Block to return the snapshot.
+* @param	Src: Statistics block of a thread.
+*
+* @return	None.
+*
+* @note		Internal only. The copy is retried until no update of the
+*		owner overlapped it.
+*
+*******************************************************************************/
+static void _XAie_IoStatsSnapshot(XAie_IoStatsBlock *Dst,
+		const XAie_IoStatsBlock *Src)
+{
+	u32 Seq;
+
+	do {
+		Seq = __atomic_load_n(&Src->Seq, __ATOMIC_ACQUIRE);
+		if((Seq & 1U) != 0U) {
+			continue;
+		}
+		memcpy(Dst, Src, sizeof(*Dst));
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	} while(((Seq & 1U) != 0U) ||
+			(Seq != __atomic_load_n(&Src->Seq, __ATOMIC_RELAXED)));
+}
+
+#ifdef XAIE_IO_STATS_BACKTRACE
+/*****************************************************************************/
+/**
+*
+* This is the callback of dl_iterate_phdr() which records the address range of
+* the executable segments of the object containing the driver.
+*
+* @param	Info: Information of a loaded object.
+* @param	Size: Size of Info.
+* @param	Data: Unused.
+*
+* @return	1 if the object contains the driver, 0 otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static int _XAie_IoStatsFindLib(struct dl_phdr_info *Info, size_t Size,
+		void *Data)
+{
+	uintptr_t Self = (uintptr_t)&_XAie_IoStatsFindLib;
+	uintptr_t Start = UINTPTR_MAX, End = 0U;
+
+	(void)Size;
+	(void)Data;
+
+	for(ElfW(Half) i = 0U; i < Info->dlpi_phnum; i++) {
+		const ElfW(Phdr) *Phdr = &Info->dlpi_phdr[i];
+		uintptr_t SegStart, SegEnd;
+
+		if((Phdr->p_type != PT_LOAD) || !(Phdr->p_flags & PF_X)) {
+			continue;
+		}
+
+		SegStart = (uintptr_t)Info->dlpi_addr + Phdr->p_vaddr;
+		SegEnd = SegStart + Phdr->p_memsz;
+		if(SegStart < Start) {
+			Start = SegStart;
+		}
+		if(SegEnd > End) {
+			End = SegEnd;
+		}
+	}
+
+	if((Self < Start) || (Self >= End)) {
+		return 0;
+	}
+
+	StatsLibStart = Start;
+	StatsLibEnd = End;
+
+	return 1;
+}
+
+static void _XAie_IoStatsLibInit(void)
+{
+	dl_iterate_phdr(_XAie_IoStatsFindLib, NULL);
+}
+
+static inline u8 _XAie_IoStatsInLib(void *Addr)
+{
+	return ((uintptr_t)Addr >= StatsLibStart) &&
+		((uintptr_t)Addr < StatsLibEnd);
+}
+#endif /* XAIE_IO_STATS_BACKTRACE */
+
+/*****************************************************************************/
+/**
+*
+* This API returns the return address into the public API of the driver which
+* issued the current IO operation.
+*
+* @return	Return address into the public API, NULL if it cannot be
+*		determined.
+*
+* @note		Internal only. The call stack is walked from the innermost
+*		frame while the frames are within the driver library. This also
+*		gives the right API for the driver calls made from a callback
+*		invoked by the driver. Only called for the timed operations.
+*
+*******************************************************************************/
+static const void *_XAie_IoStatsCaller(void)
+{
+#ifdef XAIE_IO_STATS_BACKTRACE
+	void *Frames[XAIE_IO_STATS_MAX_FRAMES];
+	const void *Caller = XAIE_NULL;
+	int NumFrames;
+
+	pthread_once(&StatsLibOnce, _XAie_IoStatsLibInit);
+
+	NumFrames = backtrace(Frames, XAIE_IO_STATS_MAX_FRAMES);
+	for(int i = 1; i < NumFrames; i++) {
+		if(!_XAie_IoStatsInLib(Frames[i])) {
+			break;
+		}
+		Caller = Frames[i];
+	}
+
+	return Caller;
+#else
+	return XAIE_NULL;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API accounts operations to the caller table of a statistics block.
+*
+* @param	Block: Statistics block to update.
+* @param	Caller: Key of the caller.
+* @param	Name: Name of the caller or NULL.
+* @param	Count: Number of operations, non zero.
+* @param	Ns: Duration of the operations.
+*
+* @return	None.
+*
+* @note		Internal only. If the table is full, the operations are
+*		counted as lost.
+*
+*******************************************************************************/
+static void _XAie_IoStatsAddCaller(XAie_IoStatsBlock *Block,
+		const void *Caller, const char *Name, u64 Count, u64 Ns)
+{
+	u32 Index = (u32)(((u64)(uintptr_t)Caller * 0x9E3779B97F4A7C15UL) >>
+			(64U - XAIE_IO_STATS_CALLER_BITS));
+
+	for(u32 i = 0U; i < XAIE_IO_STATS_MAX_CALLERS; i++) {
+		XAie_IoCallerStats *Entry = &Block->Callers[Index];
+
+		if(Entry->Count == 0U) {
+			Entry->Api = Caller;
+			Entry->ApiName = Name;
+			Block->NumCallers++;
+		}
+
+		if(Entry->Api == Caller) {
+			Entry->Count += Count;
+			Entry->TotalNs += Ns;
+			return;
+		}
+
+		Index = (Index + 1U) & (XAIE_IO_STATS_MAX_CALLERS - 1U);
+	}
+
+	Block->NumLost += Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API adds the statistics of a block to another block.
+*
+* @param	Dst: Merged statistics.
+* @param	Src: Statistics of a thread.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IoStatsMerge(XAie_IoStatsBlock *Dst,
+		const XAie_IoStatsBlock *Src)
+{
+	for(u32 Op = 0U; Op < XAIE_IO_STATS_OP_MAX; Op++) {
+		XAie_IoOpStats *DstOp = &Dst->Ops[Op];
+		const XAie_IoOpStats *SrcOp = &Src->Ops[Op];
+
+		DstOp->Count += SrcOp->Count;
+		DstOp->Bytes += SrcOp->Bytes;
+		DstOp->NumTimed += SrcOp->NumTimed;
+		DstOp->TotalNs += SrcOp->TotalNs;
+		if(SrcOp->MaxNs > DstOp->MaxNs) {
+			DstOp->MaxNs = SrcOp->MaxNs;
+		}
+		for(u32 i = 0U; i < XAIE_IO_STATS_HIST_BUCKETS; i++) {
+			DstOp->Hist[i] += SrcOp->Hist[i];
+		}
+	}
+
+	for(u32 i = 0U; (i < XAIE_IO_STATS_MAX_CALLERS) &&
+			(Src->NumCallers != 0U); i++) {
+		if(Src->Callers[i].Count != 0U) {
+			_XAie_IoStatsAddCaller(Dst, Src->Callers[i].Api,
+					Src->Callers[i].ApiName,
+					Src->Callers[i].Count,
+					Src->Callers[i].TotalNs);
+		}
+	}
+	Dst->NumLost += Src->NumLost;
+}
+
+static void _XAie_IoStatsClear(XAie_IoStatsBlock *Block)
+{
+	memset(Block->Ops, 0, sizeof(Block->Ops));
+	if(Block->NumCallers != 0U) {
+		memset(Block->Callers, 0, sizeof(Block->Callers));
+		Block->NumCallers = 0U;
+	}
+	Block->NumLost = 0U;
+}
+
+static int _XAie_IoStatsCompare(const void *A, const void *B)
+{
+	const XAie_IoCallerStats *CallerA = (const XAie_IoCallerStats *)A;
+	const XAie_IoCallerStats *CallerB = (const XAie_IoCallerStats *)B;
+
+	if(CallerA->TotalNs != CallerB->TotalNs) {
+		return (CallerA->TotalNs > CallerB->TotalNs) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API merges the statistics of all the threads and resolves the return
+* addresses of the callers to the public APIs.
+*
+* @param	Stats: Statistics to return the merged operations.
+* @param	Callers: Pointer to return the array of the callers sorted by
+*		decreasing time. The number of callers is Stats->NumCallers.
+*
+* @return	XAIE_OK on success, XAIE_ERR on memory allocation failure.
+*
+* @note		Internal only. The array of the callers has to be freed by the
+*		caller.
+*
+*******************************************************************************/
+static AieRC _XAie_IoStatsCollect(XAie_IoStats *Stats,
+		XAie_IoCallerStats **Callers)
+{
+	XAie_IoStatsBlock *Snap, *Merged, *Resolved;
+	u32 NumCallers = 0U;
+
+	Snap = (XAie_IoStatsBlock *)malloc(sizeof(*Snap));
+	Merged = (XAie_IoStatsBlock *)calloc(1U, sizeof(*Merged));
+	Resolved = (XAie_IoStatsBlock *)calloc(1U, sizeof(*Resolved));
+	*Callers = (XAie_IoCallerStats *)malloc(sizeof(Resolved->Callers));
+	if((Snap == XAIE_NULL) || (Merged == XAIE_NULL) ||
+			(Resolved == XAIE_NULL) || (*Callers == XAIE_NULL)) {
+		XAIE_ERROR("Failed to allocate memory for the statistics\n");
+		free(Snap);
+		free(Merged);
+		free(Resolved);
+		free(*Callers);
+		return XAIE_ERR;
+	}
+
+	_XAie_IoStatsLock();
+	for(XAie_IoStatsBlock *Block = StatsList; Block != XAIE_NULL;
+			Block = Block->Next) {
+		if(Block == &RetiredStats) {
+			_XAie_IoStatsMerge(Merged, Block);
+			continue;
+		}
+
+		/* Blocks not updated since the last reset are stale */
+		_XAie_IoStatsSnapshot(Snap, Block);
+		if(Snap->Epoch == StatsEpoch) {
+			_XAie_IoStatsMerge(Merged, Snap);
+		}
+	}
+	_XAie_IoStatsUnlock();
+
+	Resolved->NumLost = Merged->NumLost;
+	for(u32 i = 0U; i < XAIE_IO_STATS_MAX_CALLERS; i++) {
+		const void *Api = XAIE_NULL;
+		const char *Name = XAIE_NULL;
+#ifdef __linux__
+		Dl_info Info;
+#endif
+
+		if(Merged->Callers[i].Count == 0U) {
+			continue;
+		}
+#ifdef __linux__
+		if((Merged->Callers[i].Api != XAIE_NULL) &&
+				(dladdr(Merged->Callers[i].Api, &Info) != 0) &&
+				(Info.dli_saddr != NULL)) {
+			Api = Info.dli_saddr;
+			Name = Info.dli_sname;
+		}
+#endif
+		_XAie_IoStatsAddCaller(Resolved, Api, Name,
+				Merged->Callers[i].Count,
+				Merged->Callers[i].TotalNs);
+	}
+
+	for(u32 i = 0U; i < XAIE_IO_STATS_MAX_CALLERS; i++) {
+		if(Resolved->Callers[i].Count != 0U) {
+			(*Callers)[NumCallers++] = Resolved->Callers[i];
+		}
+	}
+	if(NumCallers > 1U) {
+		qsort(*Callers, NumCallers, sizeof(**Callers),
+				_XAie_IoStatsCompare);
+	}
+
+	memcpy(Stats->Ops, Merged->Ops, sizeof(Stats->Ops));
+	Stats->NumCallers = NumCallers;
+	Stats->NumLost = Resolved->NumLost;
+
+	free(Snap);
+	free(Merged);
+	free(Resolved);
+
+	return XAIE_OK;
+}
+
+#ifdef __linux__
+/*****************************************************************************/
+/**
+*
+* This API is called when a thread which issued IO operations exits. The
+* statistics of the thread are kept in the retired block and its block is
+* removed from the list and freed.
+*
+* @param	Arg: Statistics block of the exiting thread.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_IoStatsThreadExit(void *Arg)
+{
+	XAie_IoStatsBlock *Block = (XAie_IoStatsBlock *)Arg;
+
+	_XAie_IoStatsLock();
+	if(Block->Epoch == StatsEpoch) {
+		_XAie_IoStatsMerge(&RetiredStats, Block);
+	}
+	for(XAie_IoStatsBlock **Prev = &StatsList; *Prev != XAIE_NULL;
+			Prev = &(*Prev)->Next) {
+		if(*Prev == Block) {
+			*Prev = Block->Next;
+			break;
+		}
+	}
+	_XAie_IoStatsUnlock();
+
+	/*
+	 * The destructors of other keys may still issue operations, they get
+	 * a new block which is retired on the next round of destructors.
+	 */
+	ThreadStats = XAIE_NULL;
+	free(Block);
+}
+
+static void _XAie_IoStatsKeyInit(void)
+{
+	pthread_key_create(&StatsKey, _XAie_IoStatsThreadExit);
+}
+#endif /* __linux__ */
+
+/*****************************************************************************/
+/**
+*
+* This API allocates the statistics block of the calling thread and adds it
+* to the list of the blocks merged by the queries.
+*
+* @return	Statistics block of the calling thread, NULL on failure.
+*
+* @note		Internal only. Called on the first operation of a thread.
+*
+*******************************************************************************/
+static XAie_IoStatsBlock *_XAie_IoStatsRegister(void)
+{
+	XAie_IoStatsBlock *Block;
+
+#ifdef __linux__
+	Block = (XAie_IoStatsBlock *)calloc(1U, sizeof(*Block));
+	if(Block == XAIE_NULL) {
+		XAIE_ERROR("Failed to allocate the IO statistics block\n");
+		return XAIE_NULL;
+	}
+
+	pthread_once(&StatsKeyOnce, _XAie_IoStatsKeyInit);
+	pthread_setspecific(StatsKey, Block);
+#else
+	Block = &MainStats;
+#endif
+	_XAie_IoStatsLock();
+	Block->Epoch = StatsEpoch;
+	Block->Next = StatsList;
+	StatsList = Block;
+	_XAie_IoStatsUnlock();
+
+	ThreadStats = Block;
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks the start of a backend IO operation.
+*
+* @return	Start time stamp of the operation, 0 if the operation is not
+*		timed.
+*
+* @note		Internal only. Used by the XAIE_IO_STATS() macro.
+*
+*******************************************************************************/
+u64 _XAie_IoStatsBegin(void)
+{
+	XAie_IoStatsBlock *Block = ThreadStats;
+	u32 Period = __atomic_load_n(&StatsPeriod, __ATOMIC_RELAXED);
+
+	if(Period == 0U) {
+		return 0U;
+	}
+
+	/* The first operation of a thread is timed */
+	if(Block == XAIE_NULL) {
+		return _XAie_IoStatsGetNs();
+	}
+
+	if(++Block->NumUntimed < Period) {
+		return 0U;
+	}
+	Block->NumUntimed = 0U;
+
+	return _XAie_IoStatsGetNs();
+}
+
+/*****************************************************************************/
+/**
+*
+* This API accounts a completed backend IO operation to the statistics of the
+* calling thread.
+*
+* @param	Op: Backend IO operation.
+* @param	Bytes: Number of bytes written or read by the operation.
+* @param	StartNs: Time stamp returned by _XAie_IoStatsBegin().
+* @param	RC: Return code of the operation.
+*
+* @return	RC.
+*
+* @note		Internal only. Used by the XAIE_IO_STATS() macro. No lock is
+*		taken and the caller is only looked up for the timed operations.
+*
+*******************************************************************************/
+AieRC _XAie_IoStatsEnd(XAie_IoStatsOp Op, u64 Bytes, u64 StartNs, AieRC RC)
+{
+	XAie_IoStatsBlock *Block = ThreadStats;
+	XAie_IoOpStats *OpStats;
+	const void *Caller = XAIE_NULL;
+	u32 Bucket = 0U, Epoch;
+	u8 Callers = 0U;
+	u64 Ns = 0U;
+
+	if(Block == XAIE_NULL) {
+		/* The statistics are disabled */
+		if(StartNs == 0U) {
+			return RC;
+		}
+
+		Block = _XAie_IoStatsRegister();
+		if(Block == XAIE_NULL) {
+			return RC;
+		}
+	}
+	OpStats = &Block->Ops[Op];
+	Epoch = __atomic_load_n(&StatsEpoch, __ATOMIC_ACQUIRE);
+
+	/*
+	 * The operations which are not timed skip the sequence count. A query
+	 * may then see the count of such an operation without its bytes.
+	 */
+	if(StartNs == 0U) {
+		if(__atomic_load_n(&StatsPeriod, __ATOMIC_RELAXED) == 0U) {
+			return RC;
+		}
+		if(Block->Epoch == Epoch) {
+			OpStats->Count++;
+			OpStats->Bytes += Bytes;
+			return RC;
+		}
+	} else {
+		Ns = _XAie_IoStatsGetNs() - StartNs;
+		Bucket = (Ns == 0U) ? 0U : (u32)(63 - __builtin_clzll(Ns));
+		if(Bucket >= XAIE_IO_STATS_HIST_BUCKETS) {
+			Bucket = XAIE_IO_STATS_HIST_BUCKETS - 1U;
+		}
+
+		Callers = __atomic_load_n(&StatsCallers, __ATOMIC_RELAXED);
+		if(Callers != 0U) {
+			Caller = _XAie_IoStatsCaller();
+		}
+	}
+
+	_XAie_IoStatsWriteBegin(Block);
+	if(Block->Epoch != Epoch) {
+		_XAie_IoStatsClear(Block);
+		Block->Epoch = Epoch;
+	}
+	OpStats->Count++;
+	OpStats->Bytes += Bytes;
+	if(StartNs != 0U) {
+		OpStats->NumTimed++;
+		OpStats->TotalNs += Ns;
+		OpStats->Hist[Bucket]++;
+		if(Ns > OpStats->MaxNs) {
+			OpStats->MaxNs = Ns;
+		}
+		if(Callers != 0U) {
+			_XAie_IoStatsAddCaller(Block, Caller, XAIE_NULL, 1U,
+					Ns);
+		}
+	}
+	_XAie_IoStatsWriteEnd(Block);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of the backend IO operations issued by all
+* the threads of the process since the start or the last reset.
+*
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS if Stats is NULL, XAIE_ERR
+*		on memory allocation failure.
+*
+* @note		The statistics of the public APIs are returned by
+*		XAie_GetIoCallerStats().
+*
+*******************************************************************************/
+AieRC XAie_GetIoStats(XAie_IoStats *Stats)
+{
+	XAie_IoCallerStats *Callers;
+	AieRC RC;
+
+	if(Stats == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_IoStatsCollect(Stats, &Callers);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+	free(Callers);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the timed backend IO operations issued by each public API
+* of the driver, sorted by decreasing time spent in the backend.
+*
+* @param	Callers: Array to return the statistics of the APIs.
+* @param	NumCallers: Pointer to the number of elements of Callers. It
+*		returns the number of APIs which issued IO operations.
+*
+* @return	XAIE_OK on success, XAIE_INVALID_ARGS on invalid arguments,
+*		XAIE_INSUFFICIENT_BUFFER_SIZE if Callers cannot hold all the
+*		APIs. The first elements of Callers are filled in that case.
+*		XAIE_ERR on memory allocation failure.
+*
+* @note		The operations are accounted to the APIs only if enabled by
+*		XAie_SetIoStatsSampling().
+*
+*******************************************************************************/
+AieRC XAie_GetIoCallerStats(XAie_IoCallerStats *Callers, u32 *NumCallers)
+{
+	XAie_IoCallerStats *Merged;
+	XAie_IoStats Stats;
+	AieRC RC;
+	u32 NumCopy;
+
+	if((NumCallers == XAIE_NULL) ||
+			((Callers == XAIE_NULL) && (*NumCallers != 0U))) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_IoStatsCollect(&Stats, &Merged);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	NumCopy = Stats.NumCallers;
+	if(NumCopy > *NumCallers) {
+		NumCopy = *NumCallers;
+		RC = XAIE_INSUFFICIENT_BUFFER_SIZE;
+	}
+	if(NumCopy > 0U) {
+		memcpy(Callers, Merged, NumCopy * sizeof(*Callers));
+	}
+	*NumCallers = Stats.NumCallers;
+	free(Merged);
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API resets the statistics of the backend IO operations of all the
+* threads of the process.
+*
+* @return	XAIE_OK.
+*
+* @note		An operation which completes while the statistics are reset is
+*		either fully accounted or not accounted at all. The statistics
+*		of a thread are cleared by the thread on its next operation.
+*
+*******************************************************************************/
+AieRC XAie_ResetIoStats(void)
+{
+	_XAie_IoStatsLock();
+	_XAie_IoStatsClear(&RetiredStats);
+	__atomic_store_n(&StatsEpoch, StatsEpoch + 1U, __ATOMIC_RELEASE);
+	_XAie_IoStatsUnlock();
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets which backend IO operations are timed. All the operations are
+* counted, but reading the clock costs about as much as a write combined
+* register write, so by default only every 256th operation of a thread is
+* timed.
+*
+* @param	Period: Every Period-th operation of a thread is timed. 1 times
+*		all the operations and 0 disables the statistics.
+* @param	Callers: XAIE_ENABLE to attribute the timed operations to the
+*		public API of the driver which issued them, XAIE_DISABLE
+*		otherwise. Finding the API walks the call stack, which costs
+*		more than most of the operations, so it is disabled by default.
+*
+* @return	XAIE_OK.
+*
+* @note		A new non zero period applies to each thread after its next
+*		timed operation.
+*
+*******************************************************************************/
+AieRC XAie_SetIoStatsSampling(u32 Period, u8 Callers)
+{
+	__atomic_store_n(&StatsPeriod, Period, __ATOMIC_RELAXED);
+	__atomic_store_n(&StatsCallers, (Callers == XAIE_ENABLE) ? 1U : 0U,
+			__ATOMIC_RELAXED);
+
+	return XAIE_OK;
+}
+
+#else
+
+AieRC XAie_GetIoStats(XAie_IoStats *Stats)
+{
+	(void)Stats;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_GetIoCallerStats(XAie_IoCallerStats *Callers, u32 *NumCallers)
+{
+	(void)Callers;
+	(void)NumCallers;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_ResetIoStats(void)
+{
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+AieRC XAie_SetIoStatsSampling(u32 Period, u8 Callers)
+{
+	(void)Period;
+	(void)Callers;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+
+#endif /* XAIE_FEATURE_IO_STATS_ENABLE */
+/** @} */
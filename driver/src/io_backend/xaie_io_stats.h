@@ -0,0 +1,107 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_io_stats.h
+* @{
+*
+* Header file for the IO operation statistics. The statistics are collected
+* only if the driver is compiled with XAIE_FEATURE_IO_STATS_ENABLE.
+*
+******************************************************************************/
+#ifndef XAIE_IO_STATS_H
+#define XAIE_IO_STATS_H
+
+/***************************** Include Files *********************************/
+#include "xaie_feature_config.h"
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_IO_STATS_HIST_BUCKETS	32U
+
+/****************************** Type Definitions *****************************/
+/*
+ * This enum captures the backend IO operations which are instrumented.
+ */
+typedef enum {
+	XAIE_IO_STATS_WRITE32,
+	XAIE_IO_STATS_READ32,
+	XAIE_IO_STATS_MASKWRITE32,
+	XAIE_IO_STATS_MASKPOLL,
+	XAIE_IO_STATS_BLOCKWRITE32,
+	XAIE_IO_STATS_BLOCKSET32,
+	XAIE_IO_STATS_CMDWRITE,
+	XAIE_IO_STATS_RUNOP,
+	XAIE_IO_STATS_SUBMITTXN,
+	XAIE_IO_STATS_OP_MAX
+} XAie_IoStatsOp;
+
+/*
+ * This typedef captures the statistics of a backend IO operation. The times
+ * are of the timed calls only, see XAie_SetIoStatsSampling(). Hist[i] counts
+ * the timed calls which took between 2^i and 2^(i + 1) - 1 nanoseconds. The
+ * last bucket also counts all the longer calls.
+ */
+typedef struct {
+	u64 Count;	/* Number of calls */
+	u64 Bytes;	/* Number of bytes written or read */
+	u64 NumTimed;	/* Number of timed calls */
+	u64 TotalNs;	/* Time spent in the backend by the timed calls */
+	u64 MaxNs;	/* Longest timed call */
+	u64 Hist[XAIE_IO_STATS_HIST_BUCKETS];
+} XAie_IoOpStats;
+
+/*
+ * This typedef captures the timed backend IO operations issued on behalf of a
+ * public API of the driver. Api is the entry address of the API and ApiName
+ * its symbol name. Both are NULL for the operations whose API could not be
+ * determined.
+ */
+typedef struct {
+	const void *Api;
+	const char *ApiName;
+	u64 Count;
+	u64 TotalNs;
+} XAie_IoCallerStats;
+
+/*
+ * This typedef captures the IO statistics of the process.
+ */
+typedef struct {
+	XAie_IoOpStats Ops[XAIE_IO_STATS_OP_MAX];
+	u32 NumCallers;	/* Number of entries of XAie_GetIoCallerStats() */
+	u64 NumLost;	/* Timed operations not accounted to an API as the
+			   table of the APIs is full */
+} XAie_IoStats;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_GetIoStats(XAie_IoStats *Stats);
+AieRC XAie_GetIoCallerStats(XAie_IoCallerStats *Callers, u32 *NumCallers);
+AieRC XAie_ResetIoStats(void);
+AieRC XAie_SetIoStatsSampling(u32 Period, u8 Callers);
+
+/*
+ * Internal. Instruments a backend IO operation. Call is evaluated between the
+ * two time stamps and its return value is returned. The start time stamp is
+ * kept on the stack, so the instrumented operations can be nested.
+ */
+#ifdef XAIE_FEATURE_IO_STATS_ENABLE
+u64 _XAie_IoStatsBegin(void);
+AieRC _XAie_IoStatsEnd(XAie_IoStatsOp Op, u64 Bytes, u64 StartNs, AieRC RC);
+
+#define XAIE_IO_STATS(Op, Bytes, Call)					      \
+	({								      \
+		u64 _StatsStartNs = _XAie_IoStatsBegin();		      \
+		AieRC _StatsRC = (Call);				      \
+		_XAie_IoStatsEnd((Op), (Bytes), _StatsStartNs, _StatsRC);     \
+	})
+#else
+#define XAIE_IO_STATS(Op, Bytes, Call) (Call)
+#endif /* XAIE_FEATURE_IO_STATS_ENABLE */
+
+#endif		/* end of protection macro */
+/** @} */
@@ -145,5 +145,368 @@ static inline void _XAie_MapL2MaskToL1(XAie_DevInst *DevInst, u32 Index,
 
 }
 
+/*****************************************************************************/
+/**
+*
+* This API returns the offset of the lock request registers of a tile.
+*
+* @param	Loc: Location of the tile.
+*
+* @return	Offset of the lock request registers.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u32 _XAie_LLockRegOff(XAie_LocType Loc)
+{
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		return XAIE_NOC_MOD_LOCK_REQUEST_REGOFF;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		return XAIE_MEM_TILE_MOD_LOCK_REQUEST_REGOFF;
+	}
+
+	return XAIE_MEM_MOD_LOCK_REQUEST_REGOFF;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of locks of a tile.
+*
+* @param	Loc: Location of the tile.
+*
+* @return	Number of locks.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline u8 _XAie_LLockGetNumLocks(XAie_LocType Loc)
+{
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		return XAIE_NOC_MOD_NUM_LOCKS;
+	} else if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		return XAIE_MEM_TILE_MOD_NUM_LOCKS;
+	}
+
+	return XAIE_MEM_MOD_NUM_LOCKS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires a lock. It is the lightweight equivalent of
+* XAie_LockAcquire().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile, memory tile or shim NoC tile.
+* @param	Lock: Lock id and the value to acquire with.
+* @param	TimeOut: Timeout in microseconds.
+*
+* @return	XAIE_OK if the lock is acquired, XAIE_LOCK_RESULT_FAILED on
+*		timeout.
+*
+* @note		The location and the lock id are only checked if
+*		XAIE_ENABLE_INPUT_CHECK is defined.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LLockAcquire(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
+{
+	u64 RegAddr;
+
+	XAIE_ERROR_RETURN((Loc.Row >= XAIE_NUM_ROWS ||
+			Loc.Col >= DevInst->NumCols), XAIE_INVALID_TILE,
+			"Invalid tile location\n");
+	XAIE_ERROR_RETURN((Lock.LockId >= _XAie_LLockGetNumLocks(Loc)),
+			XAIE_INVALID_LOCK_ID, "Invalid lock id\n");
+
+	RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		_XAie_LLockRegOff(Loc) + Lock.LockId * XAIE_LOCK_ID_OFF +
+		XAIE_LOCK_ACQ_OFF +
+		(((u32)Lock.LockVal & XAIE_LOCK_VALUE_MASK) <<
+		 XAIE_LOCK_VALUE_SHIFT);
+
+	if(_XAie_LPartPoll32(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
+				XAIE_LOCK_RESULT_SUCCESS, TimeOut)) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a lock. It is the lightweight equivalent of
+* XAie_LockRelease().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile, memory tile or shim NoC tile.
+* @param	Lock: Lock id and the value to release with.
+* @param	TimeOut: Timeout in microseconds.
+*
+* @return	XAIE_OK if the lock is released, XAIE_LOCK_RESULT_FAILED on
+*		timeout.
+*
+* @note		The location and the lock id are only checked if
+*		XAIE_ENABLE_INPUT_CHECK is defined.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LLockRelease(XAie_DevInst *DevInst,
+		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
+{
+	u64 RegAddr;
+
+	XAIE_ERROR_RETURN((Loc.Row >= XAIE_NUM_ROWS ||
+			Loc.Col >= DevInst->NumCols), XAIE_INVALID_TILE,
+			"Invalid tile location\n");
+	XAIE_ERROR_RETURN((Lock.LockId >= _XAie_LLockGetNumLocks(Loc)),
+			XAIE_INVALID_LOCK_ID, "Invalid lock id\n");
+
+	RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		_XAie_LLockRegOff(Loc) + Lock.LockId * XAIE_LOCK_ID_OFF +
+		(((u32)Lock.LockVal & XAIE_LOCK_VALUE_MASK) <<
+		 XAIE_LOCK_VALUE_SHIFT);
+
+	if(_XAie_LPartPoll32(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
+				XAIE_LOCK_RESULT_SUCCESS, TimeOut)) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the address of a buffer descriptor. It is the lightweight
+* equivalent of XAie_DmaUpdateBdAddr().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile, memory tile or shim NoC tile.
+* @param	Addr: Buffer address. Local memory address in bytes for AIE
+*		and memory tiles, host address for shim NoC tiles.
+* @param	BdNum: Hardware BD number.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The address is encoded the same way as XAie_DmaWriteBd()
+*		does. The arguments are only checked if XAIE_ENABLE_INPUT_CHECK
+*		is defined.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LDmaUpdateBdAddr(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u64 Addr, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		BdNum * XAIE_DMA_BD_IDX_OFF;
+
+	XAIE_ERROR_RETURN((Loc.Row >= XAIE_NUM_ROWS ||
+			Loc.Col >= DevInst->NumCols), XAIE_INVALID_TILE,
+			"Invalid tile location\n");
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		XAIE_ERROR_RETURN((BdNum >= XAIE_NOC_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+		XAIE_ERROR_RETURN((Addr & XAIE_NOC_MOD_DMA_BD_ADDR_ALIGN_MASK),
+				XAIE_INVALID_ADDRESS, "Invalid address\n");
+
+		RegAddr += XAIE_NOC_MOD_DMA_BD_REGOFF;
+		_XAie_LPartWrite32(DevInst,
+				RegAddr + XAIE_NOC_MOD_DMA_BD_ADDR_LOW_IDX * 4U,
+				XAie_SetField(Addr >>
+					XAIE_NOC_MOD_DMA_BD_ADDR_LOW_LSB,
+					XAIE_NOC_MOD_DMA_BD_ADDR_LOW_LSB,
+					XAIE_NOC_MOD_DMA_BD_ADDR_LOW_MASK));
+		_XAie_LPartMaskWrite32(DevInst,
+				RegAddr + XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_IDX * 4U,
+				XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK,
+				XAie_SetField(Addr >> 32U,
+					XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_LSB,
+					XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK));
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR_RETURN((Addr & XAIE_TILE_DMA_BD_ADDR_ALIGN_MASK),
+			XAIE_INVALID_ADDRESS, "Invalid address\n");
+
+	if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_TILE_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+		RegAddr += XAIE_MEM_TILE_MOD_DMA_BD_REGOFF +
+			XAIE_MEM_TILE_MOD_DMA_BD_ADDR_IDX * 4U;
+		_XAie_LPartMaskWrite32(DevInst, RegAddr,
+				XAIE_MEM_TILE_MOD_DMA_BD_ADDR_MASK,
+				XAie_SetField(Addr >> XAIE_TILE_DMA_BD_ADDR_SHIFT,
+					XAIE_MEM_TILE_MOD_DMA_BD_ADDR_LSB,
+					XAIE_MEM_TILE_MOD_DMA_BD_ADDR_MASK));
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_MOD_DMA_NUM_BDS),
+			XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+	RegAddr += XAIE_MEM_MOD_DMA_BD_REGOFF +
+		XAIE_MEM_MOD_DMA_BD_ADDR_IDX * 4U;
+	_XAie_LPartMaskWrite32(DevInst, RegAddr, XAIE_MEM_MOD_DMA_BD_ADDR_MASK,
+			XAie_SetField(Addr >> XAIE_TILE_DMA_BD_ADDR_SHIFT,
+				XAIE_MEM_MOD_DMA_BD_ADDR_LSB,
+				XAIE_MEM_MOD_DMA_BD_ADDR_MASK));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API updates the length of a buffer descriptor. It is the lightweight
+* equivalent of XAie_DmaUpdateBdLen().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile, memory tile or shim NoC tile.
+* @param	Len: Length of the buffer in bytes.
+* @param	BdNum: Hardware BD number.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The arguments are only checked if XAIE_ENABLE_INPUT_CHECK is
+*		defined.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LDmaUpdateBdLen(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u32 Len, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col) +
+		BdNum * XAIE_DMA_BD_IDX_OFF;
+	u32 WordLen = Len >> XAIE_DMA_32BIT_TXFER_LEN;
+
+	XAIE_ERROR_RETURN((Loc.Row >= XAIE_NUM_ROWS ||
+			Loc.Col >= DevInst->NumCols), XAIE_INVALID_TILE,
+			"Invalid tile location\n");
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		XAIE_ERROR_RETURN((BdNum >= XAIE_NOC_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+		/* BD length register does not have other fields */
+		RegAddr += XAIE_NOC_MOD_DMA_BD_REGOFF +
+			XAIE_NOC_MOD_DMA_BD_LEN_IDX * 4U;
+		_XAie_LPartWrite32(DevInst, RegAddr,
+				XAie_SetField(WordLen,
+					XAIE_NOC_MOD_DMA_BD_LEN_LSB,
+					XAIE_NOC_MOD_DMA_BD_LEN_MASK));
+		return XAIE_OK;
+	}
+
+	if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_TILE_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+		RegAddr += XAIE_MEM_TILE_MOD_DMA_BD_REGOFF +
+			XAIE_MEM_TILE_MOD_DMA_BD_LEN_IDX * 4U;
+		_XAie_LPartMaskWrite32(DevInst, RegAddr,
+				XAIE_MEM_TILE_MOD_DMA_BD_LEN_MASK,
+				XAie_SetField(WordLen,
+					XAIE_MEM_TILE_MOD_DMA_BD_LEN_LSB,
+					XAIE_MEM_TILE_MOD_DMA_BD_LEN_MASK));
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_MOD_DMA_NUM_BDS),
+			XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+	RegAddr += XAIE_MEM_MOD_DMA_BD_REGOFF + XAIE_MEM_MOD_DMA_BD_LEN_IDX * 4U;
+	_XAie_LPartMaskWrite32(DevInst, RegAddr, XAIE_MEM_MOD_DMA_BD_LEN_MASK,
+			XAie_SetField(WordLen, XAIE_MEM_MOD_DMA_BD_LEN_LSB,
+				XAIE_MEM_MOD_DMA_BD_LEN_MASK));
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API pushes a buffer descriptor to the start queue of a DMA channel. It
+* is the lightweight equivalent of XAie_DmaChannelPushBdToQueue().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile, memory tile or shim NoC tile.
+* @param	ChNum: Channel number of the DMA.
+* @param	Dir: Direction of the DMA channel, DMA_S2MM or DMA_MM2S.
+* @param	BdNum: Hardware BD number.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The arguments are only checked if XAIE_ENABLE_INPUT_CHECK is
+*		defined. The memory tile BD to channel mapping is not checked.
+*
+******************************************************************************/
+__FORCE_INLINE__
+static inline AieRC XAie_LDmaChannelPushBdToQueue(XAie_DevInst *DevInst,
+		XAie_LocType Loc, u8 ChNum, XAie_DmaDirection Dir, u8 BdNum)
+{
+	u64 RegAddr = _XAie_LGetTileAddr(Loc.Row, Loc.Col);
+
+	XAIE_ERROR_RETURN((Loc.Row >= XAIE_NUM_ROWS ||
+			Loc.Col >= DevInst->NumCols), XAIE_INVALID_TILE,
+			"Invalid tile location\n");
+	XAIE_ERROR_RETURN((Dir >= DMA_MAX), XAIE_INVALID_ARGS,
+			"Invalid DMA direction\n");
+
+	if(Loc.Row == XAIE_SHIM_ROW) {
+		XAIE_ERROR_RETURN((ChNum >= XAIE_NOC_MOD_DMA_NUM_CH),
+				XAIE_INVALID_CHANNEL_NUM,
+				"Invalid channel number\n");
+		XAIE_ERROR_RETURN((BdNum >= XAIE_NOC_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+		RegAddr += XAIE_NOC_MOD_DMA_START_QUEUE_REGOFF +
+			(ChNum + Dir * XAIE_NOC_MOD_DMA_NUM_CH) *
+			XAIE_DMA_CH_IDX_OFF;
+		_XAie_LPartWrite32(DevInst, RegAddr,
+				XAie_SetField(BdNum,
+					XAIE_NOC_MOD_DMA_START_BD_LSB,
+					XAIE_NOC_MOD_DMA_START_BD_MASK));
+		return XAIE_OK;
+	}
+
+	if(Loc.Row < XAIE_AIE_TILE_ROW_START) {
+		XAIE_ERROR_RETURN((ChNum >= XAIE_MEM_TILE_MOD_DMA_NUM_CH),
+				XAIE_INVALID_CHANNEL_NUM,
+				"Invalid channel number\n");
+		XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_TILE_MOD_DMA_NUM_BDS),
+				XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+		RegAddr += XAIE_MEM_TILE_MOD_DMA_START_QUEUE_REGOFF +
+			(ChNum + Dir * XAIE_MEM_TILE_MOD_DMA_NUM_CH) *
+			XAIE_DMA_CH_IDX_OFF;
+		_XAie_LPartWrite32(DevInst, RegAddr,
+				XAie_SetField(BdNum,
+					XAIE_MEM_TILE_MOD_DMA_START_BD_LSB,
+					XAIE_MEM_TILE_MOD_DMA_START_BD_MASK));
+		return XAIE_OK;
+	}
+
+	XAIE_ERROR_RETURN((ChNum >= XAIE_MEM_MOD_DMA_NUM_CH),
+			XAIE_INVALID_CHANNEL_NUM, "Invalid channel number\n");
+	XAIE_ERROR_RETURN((BdNum >= XAIE_MEM_MOD_DMA_NUM_BDS),
+			XAIE_INVALID_BD_NUM, "Invalid BD number\n");
+
+	RegAddr += XAIE_MEM_MOD_DMA_START_QUEUE_REGOFF +
+		(ChNum + Dir * XAIE_MEM_MOD_DMA_NUM_CH) * XAIE_DMA_CH_IDX_OFF;
+	_XAie_LPartWrite32(DevInst, RegAddr,
+			XAie_SetField(BdNum, XAIE_MEM_MOD_DMA_START_BD_LSB,
+				XAIE_MEM_MOD_DMA_START_BD_MASK));
+
+	return XAIE_OK;
+}
+
 #endif		/* end of protection macro */
 /** @} */
@@ -111,6 +111,57 @@
 
 #define XAIE_MEM_TILE_BASE_EVENT_STATUS			0
 
+/* Lock request registers. A request returns 1 in bit 0 on success. */
+#define XAIE_MEM_MOD_LOCK_REQUEST_REGOFF		XAIEGBL_MEM_LOCK0RELNV
+#define XAIE_NOC_MOD_LOCK_REQUEST_REGOFF		XAIEGBL_NOC_LOCK0RELNV
+#define XAIE_LOCK_ID_OFF				0x80U
+#define XAIE_LOCK_ACQ_OFF				0x40U
+#define XAIE_LOCK_WITH_VALUE_OFF			0x20U
+#define XAIE_LOCK_VALUE_OFF				0x10U
+#define XAIE_LOCK_RESULT_MASK				0x1U
+#define XAIE_LOCK_RESULT_SUCCESS			0x1U
+#define XAIE_MEM_MOD_NUM_LOCKS				16U
+#define XAIE_NOC_MOD_NUM_LOCKS				16U
+
+/* DMA buffer descriptors and start queues */
+#define XAIE_DMA_32BIT_TXFER_LEN			2U
+#define XAIE_DMA_CH_IDX_OFF				0x8U
+
+#define XAIE_MEM_MOD_DMA_BD_REGOFF			XAIEGBL_MEM_DMABD0ADDA
+#define XAIE_MEM_MOD_DMA_BD_IDX_OFF			0x20U
+#define XAIE_MEM_MOD_DMA_NUM_BDS			16U
+#define XAIE_MEM_MOD_DMA_NUM_CH				2U
+#define XAIE_MEM_MOD_DMA_BD_ADDR_IDX			0U
+#define XAIE_MEM_MOD_DMA_BD_ADDR_LSB			XAIEGBL_MEM_DMABD0ADDA_BASADDA_LSB
+#define XAIE_MEM_MOD_DMA_BD_ADDR_MASK			XAIEGBL_MEM_DMABD0ADDA_BASADDA_MASK
+#define XAIE_MEM_MOD_DMA_BD_ADDR_ALIGN_MASK		0x3U
+#define XAIE_MEM_MOD_DMA_BD_ADDR_SHIFT			2U
+#define XAIE_MEM_MOD_DMA_BD_LEN_IDX			6U
+#define XAIE_MEM_MOD_DMA_BD_LEN_LSB			XAIEGBL_MEM_DMABD0CTRL_LEN_LSB
+#define XAIE_MEM_MOD_DMA_BD_LEN_MASK			XAIEGBL_MEM_DMABD0CTRL_LEN_MASK
+#define XAIE_MEM_MOD_DMA_BD_LEN_OFFSET			1U
+#define XAIE_MEM_MOD_DMA_START_QUEUE_REGOFF		XAIEGBL_MEM_DMAS2MM0STAQUE
+#define XAIE_MEM_MOD_DMA_START_BD_LSB			XAIEGBL_MEM_DMAS2MM0STAQUE_STABD_LSB
+#define XAIE_MEM_MOD_DMA_START_BD_MASK			XAIEGBL_MEM_DMAS2MM0STAQUE_STABD_MASK
+
+#define XAIE_NOC_MOD_DMA_BD_REGOFF			XAIEGBL_NOC_DMABD0ADDLOW
+#define XAIE_NOC_MOD_DMA_BD_IDX_OFF			0x14U
+#define XAIE_NOC_MOD_DMA_NUM_BDS			16U
+#define XAIE_NOC_MOD_DMA_NUM_CH				2U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_IDX		0U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_LSB		XAIEGBL_NOC_DMABD0ADDLOW_ADDLOW_LSB
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_MASK		XAIEGBL_NOC_DMABD0ADDLOW_ADDLOW_MASK
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_IDX		2U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_LSB		XAIEGBL_NOC_DMABD0CTRL_ADDHIG_LSB
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK		XAIEGBL_NOC_DMABD0CTRL_ADDHIG_MASK
+#define XAIE_NOC_MOD_DMA_BD_ADDR_ALIGN_MASK		0xFU
+#define XAIE_NOC_MOD_DMA_BD_LEN_IDX			1U
+#define XAIE_NOC_MOD_DMA_BD_LEN_LSB			XAIEGBL_NOC_DMABD0BUFLEN_BUFLEN_LSB
+#define XAIE_NOC_MOD_DMA_BD_LEN_MASK			XAIEGBL_NOC_DMABD0BUFLEN_BUFLEN_MASK
+#define XAIE_NOC_MOD_DMA_START_QUEUE_REGOFF		XAIEGBL_NOC_DMAS2MM0STAQUE
+#define XAIE_NOC_MOD_DMA_START_BD_LSB			XAIEGBL_NOC_DMAS2MM0STAQUE_STABD_LSB
+#define XAIE_NOC_MOD_DMA_START_BD_MASK			XAIEGBL_NOC_DMAS2MM0STAQUE_STABD_MASK
+
 /* Tile control isolation bits are the same across tiles */
 #define XAIE_TILE_CNTR_ISOLATE_EAST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_EAST_MASK
 #define XAIE_TILE_CNTR_ISOLATE_WEST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_WEST_MASK
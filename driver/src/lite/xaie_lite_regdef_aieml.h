@@ -122,6 +122,72 @@
 #define XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_LSB		XAIEMLGBL_MEM_TILE_MODULE_MEMORY_CONTROL_MEMORY_ZEROISATION_LSB
 #define XAIE_MEM_TILE_MEM_CNTR_ZEROISATION_MASK		XAIEMLGBL_MEM_TILE_MODULE_MEMORY_CONTROL_MEMORY_ZEROISATION_MASK
 
+/* Lock request registers. A request returns 1 in bit 0 on success. */
+#define XAIE_MEM_MOD_LOCK_REQUEST_REGOFF		XAIEMLGBL_MEMORY_MODULE_LOCK_REQUEST
+#define XAIE_NOC_MOD_LOCK_REQUEST_REGOFF		XAIEMLGBL_NOC_MODULE_LOCK_REQUEST
+#define XAIE_MEM_TILE_MOD_LOCK_REQUEST_REGOFF		XAIEMLGBL_MEM_TILE_MODULE_LOCK_REQUEST
+#define XAIE_LOCK_ID_OFF				0x400U
+#define XAIE_LOCK_ACQ_OFF				0x200U
+#define XAIE_LOCK_VALUE_MASK				0x7FU
+#define XAIE_LOCK_VALUE_SHIFT				2U
+#define XAIE_LOCK_RESULT_MASK				0x1U
+#define XAIE_LOCK_RESULT_SUCCESS			0x1U
+#define XAIE_MEM_MOD_NUM_LOCKS				16U
+#define XAIE_NOC_MOD_NUM_LOCKS				16U
+#define XAIE_MEM_TILE_MOD_NUM_LOCKS			64U
+
+/* DMA buffer descriptors and start queues */
+#define XAIE_DMA_32BIT_TXFER_LEN			2U
+#define XAIE_DMA_BD_IDX_OFF				0x20U
+#define XAIE_DMA_CH_IDX_OFF				0x8U
+
+#define XAIE_MEM_MOD_DMA_BD_REGOFF			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0
+#define XAIE_MEM_MOD_DMA_NUM_BDS			16U
+#define XAIE_MEM_MOD_DMA_NUM_CH				2U
+#define XAIE_MEM_MOD_DMA_BD_ADDR_IDX			0U
+#define XAIE_MEM_MOD_DMA_BD_ADDR_LSB			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BASE_ADDRESS_LSB
+#define XAIE_MEM_MOD_DMA_BD_ADDR_MASK			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BASE_ADDRESS_MASK
+#define XAIE_MEM_MOD_DMA_BD_LEN_IDX			0U
+#define XAIE_MEM_MOD_DMA_BD_LEN_LSB			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BUFFER_LENGTH_LSB
+#define XAIE_MEM_MOD_DMA_BD_LEN_MASK			XAIEMLGBL_MEMORY_MODULE_DMA_BD0_0_BUFFER_LENGTH_MASK
+#define XAIE_MEM_MOD_DMA_START_QUEUE_REGOFF		XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_0_START_QUEUE
+#define XAIE_MEM_MOD_DMA_START_BD_LSB			XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_0_START_QUEUE_START_BD_ID_LSB
+#define XAIE_MEM_MOD_DMA_START_BD_MASK			XAIEMLGBL_MEMORY_MODULE_DMA_S2MM_0_START_QUEUE_START_BD_ID_MASK
+
+#define XAIE_MEM_TILE_MOD_DMA_BD_REGOFF			XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0
+#define XAIE_MEM_TILE_MOD_DMA_NUM_BDS			48U
+#define XAIE_MEM_TILE_MOD_DMA_NUM_CH			6U
+#define XAIE_MEM_TILE_MOD_DMA_BD_ADDR_IDX		1U
+#define XAIE_MEM_TILE_MOD_DMA_BD_ADDR_LSB		XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_1_BASE_ADDRESS_LSB
+#define XAIE_MEM_TILE_MOD_DMA_BD_ADDR_MASK		XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_1_BASE_ADDRESS_MASK
+#define XAIE_MEM_TILE_MOD_DMA_BD_LEN_IDX		0U
+#define XAIE_MEM_TILE_MOD_DMA_BD_LEN_LSB		XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0_BUFFER_LENGTH_LSB
+#define XAIE_MEM_TILE_MOD_DMA_BD_LEN_MASK		XAIEMLGBL_MEM_TILE_MODULE_DMA_BD0_0_BUFFER_LENGTH_MASK
+#define XAIE_MEM_TILE_MOD_DMA_START_QUEUE_REGOFF	XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_0_START_QUEUE
+#define XAIE_MEM_TILE_MOD_DMA_START_BD_LSB		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_0_START_QUEUE_START_BD_ID_LSB
+#define XAIE_MEM_TILE_MOD_DMA_START_BD_MASK		XAIEMLGBL_MEM_TILE_MODULE_DMA_S2MM_0_START_QUEUE_START_BD_ID_MASK
+
+/* AIE tile and memory tile DMAs address local memory in 32bit words */
+#define XAIE_TILE_DMA_BD_ADDR_ALIGN_MASK		0x3U
+#define XAIE_TILE_DMA_BD_ADDR_SHIFT			2U
+
+#define XAIE_NOC_MOD_DMA_BD_REGOFF			XAIEMLGBL_NOC_MODULE_DMA_BD0_0
+#define XAIE_NOC_MOD_DMA_NUM_BDS			16U
+#define XAIE_NOC_MOD_DMA_NUM_CH				2U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_IDX		1U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_LSB		XAIEMLGBL_NOC_MODULE_DMA_BD0_1_BASE_ADDRESS_LOW_LSB
+#define XAIE_NOC_MOD_DMA_BD_ADDR_LOW_MASK		XAIEMLGBL_NOC_MODULE_DMA_BD0_1_BASE_ADDRESS_LOW_MASK
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_IDX		2U
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_LSB		XAIEMLGBL_NOC_MODULE_DMA_BD0_2_BASE_ADDRESS_HIGH_LSB
+#define XAIE_NOC_MOD_DMA_BD_ADDR_HIGH_MASK		XAIEMLGBL_NOC_MODULE_DMA_BD0_2_BASE_ADDRESS_HIGH_MASK
+#define XAIE_NOC_MOD_DMA_BD_ADDR_ALIGN_MASK		0x3U
+#define XAIE_NOC_MOD_DMA_BD_LEN_IDX			0U
+#define XAIE_NOC_MOD_DMA_BD_LEN_LSB			XAIEMLGBL_NOC_MODULE_DMA_BD0_0_BUFFER_LENGTH_LSB
+#define XAIE_NOC_MOD_DMA_BD_LEN_MASK			XAIEMLGBL_NOC_MODULE_DMA_BD0_0_BUFFER_LENGTH_MASK
+#define XAIE_NOC_MOD_DMA_START_QUEUE_REGOFF		XAIEMLGBL_NOC_MODULE_DMA_S2MM_0_TASK_QUEUE
+#define XAIE_NOC_MOD_DMA_START_BD_LSB			XAIEMLGBL_NOC_MODULE_DMA_S2MM_0_TASK_QUEUE_START_BD_ID_LSB
+#define XAIE_NOC_MOD_DMA_START_BD_MASK			XAIEMLGBL_NOC_MODULE_DMA_S2MM_0_TASK_QUEUE_START_BD_ID_MASK
+
 /* Tile control isolation bits are the same across tiles */
 #define XAIE_TILE_CNTR_ISOLATE_EAST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_EAST_MASK
 #define XAIE_TILE_CNTR_ISOLATE_WEST_MASK		XAIE_CORE_MOD_TILE_CNTR_ISOLATE_WEST_MASK
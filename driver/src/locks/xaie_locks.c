@@ -22,14 +22,88 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#endif /* __linux__ */
+
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_locks.h"
 #include "xaiegbl_defs.h"
 
+#if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
+#include "xaie_locks_aieml.h"
+#elif XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIE
+#include "xaie_locks_aie.h"
+#endif
+
 #ifdef XAIE_FEATURE_LOCK_ENABLE
 /************************** Constant Definitions *****************************/
+/*
+ * All the tile types of a generation share the same lock operations, single
+ * generation builds call them directly.
+ */
+#if XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIEML
+#define XAIE_LOCK_ACQUIRE(LockMod)	_XAieMl_LockAcquire
+#define XAIE_LOCK_RELEASE(LockMod)	_XAieMl_LockRelease
+#define XAIE_LOCK_GET_REGOFF(LockMod)	_XAieMl_LockGetRegOff
+#elif XAIE_DEV_SINGLE_GEN == XAIE_DEV_GEN_AIE
+#define XAIE_LOCK_ACQUIRE(LockMod)	_XAie_LockAcquire
+#define XAIE_LOCK_RELEASE(LockMod)	_XAie_LockRelease
+#define XAIE_LOCK_GET_REGOFF(LockMod)	_XAie_LockGetRegOff
+#else
+#define XAIE_LOCK_ACQUIRE(LockMod)	((LockMod)->Acquire)
+#define XAIE_LOCK_RELEASE(LockMod)	((LockMod)->Release)
+#define XAIE_LOCK_GET_REGOFF(LockMod)	((LockMod)->GetRegOff)
+#endif
+
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API checks a lock request and returns the lock module of its tile.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE Tile
+* @param	Lock: Lock data structure with LockId and LockValue.
+* @param	LockMod: Pointer to return the lock module.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockGetMod(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_Lock Lock, const XAie_LockMod **LockMod)
+{
+	u8  TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	*LockMod = _XAie_GetDevMod(DevInst)[TileType].LockMod;
+
+	if(Lock.LockId > (*LockMod)->NumLocks) {
+		XAIE_ERROR("Invalid Lock Id\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if((Lock.LockVal > (*LockMod)->LockValUpperBound) ||
+			(Lock.LockVal < (*LockMod)->LockValLowerBound)) {
+		XAIE_ERROR("Lock value out of range\n");
+		return XAIE_INVALID_LOCK_VALUE;
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -56,8 +130,8 @@
 AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut)
 {
-	u8  TileType;
 	const XAie_LockMod *LockMod;
+	AieRC RC;
 
 	if((DevInst == XAIE_NULL) ||
 			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
@@ -65,26 +139,12 @@ AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
-		XAIE_ERROR("Invalid Tile Type\n");
-		return XAIE_INVALID_TILE;
+	RC = _XAie_LockGetMod(DevInst, Loc, Lock, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
-
-	if(Lock.LockId > LockMod->NumLocks) {
-		XAIE_ERROR("Invalid Lock Id\n");
-		return XAIE_INVALID_LOCK_ID;
-	}
-
-	if((Lock.LockVal > LockMod->LockValUpperBound) ||
-			(Lock.LockVal < LockMod->LockValLowerBound)) {
-		XAIE_ERROR("Lock value out of range\n");
-		return XAIE_INVALID_LOCK_VALUE;
-	}
-
-	return LockMod->Acquire(DevInst, LockMod, Loc, Lock, TimeOut);
+	return XAIE_LOCK_ACQUIRE(LockMod)(DevInst, LockMod, Loc, Lock, TimeOut);
 }
 
 /*****************************************************************************/
@@ -113,8 +173,8 @@ AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut)
 {
-	u8  TileType;
 	const XAie_LockMod *LockMod;
+	AieRC RC;
 
 	if((DevInst == XAIE_NULL) ||
 			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
@@ -122,26 +182,12 @@ AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
-		XAIE_ERROR("Invalid Tile Type\n");
-		return XAIE_INVALID_TILE;
-	}
-
-	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
-
-	if(Lock.LockId > LockMod->NumLocks) {
-		XAIE_ERROR("Invalid Lock Id\n");
-		return XAIE_INVALID_LOCK_ID;
+	RC = _XAie_LockGetMod(DevInst, Loc, Lock, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
 	}
 
-	if((Lock.LockVal > LockMod->LockValUpperBound) ||
-			(Lock.LockVal < LockMod->LockValLowerBound)) {
-		XAIE_ERROR("Lock value out of range\n");
-		return XAIE_INVALID_LOCK_VALUE;
-	}
-
-	return LockMod->Release(DevInst, LockMod, Loc, Lock, TimeOut);
+	return XAIE_LOCK_RELEASE(LockMod)(DevInst, LockMod, Loc, Lock, TimeOut);
 }
 
 /*****************************************************************************/
@@ -169,13 +215,13 @@ AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock)
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	LockMod = DevInst->DevProp.DevMod[TileType].LockMod;
+	LockMod = _XAie_GetDevMod(DevInst)[TileType].LockMod;
 
 	if(Lock.LockId > LockMod->NumLocks) {
 		XAIE_ERROR("Invalid Lock Id\n");
@@ -185,5 +231,303 @@ AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock)
 	return LockMod->SetValue(DevInst, LockMod, Loc, Lock);
 }
 
+static inline u64 _XAie_LockGetUs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000UL + (u64)Ts.tv_nsec / 1000UL;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires or releases a set of locks with a shared timeout. Every
+* pending request is issued once per sweep, without timeout, so the requests
+* to different tiles are back to back. If requests are still pending after a
+* sweep, the first pending one is polled with a timeout of at most
+* XAIE_LOCK_MULTI_POLL_US, which lets the backend wait before the next sweep.
+* The timeout is checked against the elapsed wall clock time, so the time
+* spent in the sweeps counts as well as the time spent in the polls. Where no
+* clock is available, only the polls are counted.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests.
+* @param	NumReqs: Number of lock requests.
+* @param	TimeOut: Timeout shared by all the requests in usecs.
+* @param	Done: Array of NumReqs entries, entry i is set to 1 once request
+*		i succeeded. Requests whose entry is already 1 are skipped.
+* @param	IsAcquire: 1 to acquire the locks, 0 to release them.
+*
+* @return	XAIE_OK if all the requests succeeded, XAIE_LOCK_RESULT_FAILED if
+*		some did not succeed in time, else error code.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_LockMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u32 TimeOut, u8 *Done, u8 IsAcquire)
+{
+	AieRC RC;
+	u32 Pending, Slice, First;
+	u64 StartUs, ElapsedUs, PolledUs = 0U;
+	const XAie_LockMod *LockMod;
+
+	if((DevInst == XAIE_NULL) || (Reqs == XAIE_NULL) ||
+			(Done == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Check all the requests before issuing any */
+	for(u32 i = 0U; i < NumReqs; i++) {
+		RC = _XAie_LockGetMod(DevInst, Reqs[i].Loc, Reqs[i].Lock,
+				&LockMod);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Invalid lock request %u\n", i);
+			return RC;
+		}
+	}
+
+	StartUs = _XAie_LockGetUs();
+	while(1) {
+		Pending = 0U;
+		First = NumReqs;
+		for(u32 i = 0U; i < NumReqs; i++) {
+			if(Done[i] != 0U) {
+				continue;
+			}
+
+			LockMod = _XAie_GetDevMod(DevInst)[
+				_XAie_DevGetTTypefromLoc(DevInst,
+						Reqs[i].Loc)].LockMod;
+			if(IsAcquire) {
+				RC = XAIE_LOCK_ACQUIRE(LockMod)(DevInst,
+						LockMod, Reqs[i].Loc,
+						Reqs[i].Lock, 0U);
+			} else {
+				RC = XAIE_LOCK_RELEASE(LockMod)(DevInst,
+						LockMod, Reqs[i].Loc,
+						Reqs[i].Lock, 0U);
+			}
+
+			if(RC == XAIE_OK) {
+				Done[i] = 1U;
+			} else {
+				Pending++;
+				if(First == NumReqs) {
+					First = i;
+				}
+			}
+		}
+
+		if(Pending == 0U) {
+			return XAIE_OK;
+		}
+
+		ElapsedUs = _XAie_LockGetUs() - StartUs;
+		if(ElapsedUs < PolledUs) {
+			ElapsedUs = PolledUs;
+		}
+		if(ElapsedUs >= TimeOut) {
+			return XAIE_LOCK_RESULT_FAILED;
+		}
+
+		Slice = ((TimeOut - ElapsedUs) < XAIE_LOCK_MULTI_POLL_US) ?
+			(u32)(TimeOut - ElapsedUs) : XAIE_LOCK_MULTI_POLL_US;
+		PolledUs += Slice;
+
+		LockMod = _XAie_GetDevMod(DevInst)[
+			_XAie_DevGetTTypefromLoc(DevInst,
+					Reqs[First].Loc)].LockMod;
+		if(IsAcquire) {
+			RC = XAIE_LOCK_ACQUIRE(LockMod)(DevInst, LockMod,
+					Reqs[First].Loc, Reqs[First].Lock,
+					Slice);
+		} else {
+			RC = XAIE_LOCK_RELEASE(LockMod)(DevInst, LockMod,
+					Reqs[First].Loc, Reqs[First].Lock,
+					Slice);
+		}
+		if(RC == XAIE_OK) {
+			Done[First] = 1U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires a set of locks, possibly in different tiles, with a shared
+* timeout. The requests are issued back to back and all the pending ones are
+* retried in every polling round, instead of waiting for each lock in turn as
+* a sequence of XAie_LockAcquire() calls would do.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests, each with a tile location, a lock
+*		id and a lock value as for XAie_LockAcquire().
+* @param	NumReqs: Number of lock requests.
+* @param	TimeOut: Timeout shared by all the requests in usecs. If 0, each
+*		request is issued once.
+* @param	Done: Array of NumReqs entries. Entry i is set to 1 once lock i
+*		is acquired. Requests whose entry is already 1 are skipped, so
+*		the entries shall be cleared before the first call and a timed
+*		out call can be retried with the same array.
+*
+* @return	XAIE_OK if all the locks are acquired, XAIE_LOCK_RESULT_FAILED if
+*		some were not acquired in time, else error code.
+*
+* @note		Locks which were acquired are not released if the call fails,
+*		they are reported in Done.
+*
+******************************************************************************/
+AieRC XAie_LockAcquireMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u32 TimeOut, u8 *Done)
+{
+	return _XAie_LockMulti(DevInst, Reqs, NumReqs, TimeOut, Done, 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases a set of locks, possibly in different tiles, with a shared
+* timeout. The requests are issued back to back and all the pending ones are
+* retried in every polling round.
+*
+* @param	DevInst: Device Instance
+* @param	Reqs: Array of lock requests, each with a tile location, a lock
+*		id and a lock value as for XAie_LockRelease().
+* @param	NumReqs: Number of lock requests.
+* @param	TimeOut: Timeout shared by all the requests in usecs. If 0, each
+*		request is issued once.
+* @param	Done: Array of NumReqs entries. Entry i is set to 1 once lock i
+*		is released. Requests whose entry is already 1 are skipped.
+*
+* @return	XAIE_OK if all the locks are released, XAIE_LOCK_RESULT_FAILED if
+*		some were not released in time, else error code.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_LockReleaseMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u32 TimeOut, u8 *Done)
+{
+	return _XAie_LockMulti(DevInst, Reqs, NumReqs, TimeOut, Done, 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a lock handle. The tile, the lock id and the acquire and
+* release values are validated once and the absolute addresses of the acquire
+* and release requests are cached in the handle, so that
+* XAie_LockHandleAcquire() and XAie_LockHandleRelease() only issue the request.
+*
+* @param	DevInst: Device Instance
+* @param	Handle: Lock handle to initialize.
+* @param	Loc: Location of AIE Tile
+* @param	LockId: Lock id.
+* @param	AcqVal: Lock value of the acquire requests.
+* @param	RelVal: Lock value of the release requests.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The handle stays valid as long as the device instance does.
+*
+******************************************************************************/
+AieRC XAie_LockHandleInit(XAie_DevInst *DevInst, XAie_LockHandle *Handle,
+		XAie_LocType Loc, u8 LockId, s8 AcqVal, s8 RelVal)
+{
+	const XAie_LockMod *LockMod;
+	XAie_Lock AcqLock = XAie_LockInit(LockId, AcqVal);
+	XAie_Lock RelLock = XAie_LockInit(LockId, RelVal);
+	u64 TileAddr;
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Handle == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or Handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_LockGetMod(DevInst, Loc, AcqLock, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	RC = _XAie_LockGetMod(DevInst, Loc, RelLock, &LockMod);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	TileAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
+	Handle->DevInst = DevInst;
+	Handle->AcqRegAddr = TileAddr +
+		XAIE_LOCK_GET_REGOFF(LockMod)(LockMod, AcqLock, XAIE_ENABLE);
+	Handle->RelRegAddr = TileAddr +
+		XAIE_LOCK_GET_REGOFF(LockMod)(LockMod, RelLock, XAIE_DISABLE);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires the lock of a lock handle with the acquire value of the
+* handle. The request is issued without validating the arguments again.
+*
+* @param	Handle: Lock handle initialized with XAie_LockHandleInit().
+* @param	TimeOut: Timeout value for which the acquire request needs to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if Lock Acquired, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_LockHandleAcquire(const XAie_LockHandle *Handle, u32 TimeOut)
+{
+	if(XAie_MaskPoll(Handle->DevInst, Handle->AcqRegAddr,
+				XAIE_LOCK_REQ_RESULT_MASK,
+				XAIE_LOCK_REQ_RESULT_SUCCESS,
+				TimeOut) != XAIE_OK) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases the lock of a lock handle with the release value of the
+* handle. The request is issued without validating the arguments again.
+*
+* @param	Handle: Lock handle initialized with XAie_LockHandleInit().
+* @param	TimeOut: Timeout value for which the release request needs to be
+*		repeated. Value in usecs.
+*
+* @return	XAIE_OK if Lock Release, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_LockHandleRelease(const XAie_LockHandle *Handle, u32 TimeOut)
+{
+	if(XAie_MaskPoll(Handle->DevInst, Handle->RelRegAddr,
+				XAIE_LOCK_REQ_RESULT_MASK,
+				XAIE_LOCK_REQ_RESULT_SUCCESS,
+				TimeOut) != XAIE_OK) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return XAIE_OK;
+}
+
 #endif /* XAIE_FEATURE_LOCK_ENABLE */
 /** @} */
@@ -27,7 +27,31 @@
 /***************************** Include Files *********************************/
 #include "xaiegbl.h"
 #include "xaiegbl_defs.h"
+
+/***************************** Macro Definitions *****************************/
+/* Longest wait between two sweeps of XAie_LockAcquireMulti() */
+#define XAIE_LOCK_MULTI_POLL_US		200U
+/* Lock request registers of all the generations return the result in bit 0 */
+#define XAIE_LOCK_REQ_RESULT_MASK	0x1U
+#define XAIE_LOCK_REQ_RESULT_SUCCESS	0x1U
+
 /**************************** Type Definitions *******************************/
+/* Data structure to capture a lock request of XAie_LockAcquireMulti() */
+typedef struct {
+	XAie_LocType Loc;
+	XAie_Lock Lock;
+} XAie_LockReq;
+
+/*
+ * Lock handle with the absolute addresses of the acquire and release requests
+ * of a lock. Initialized with XAie_LockHandleInit().
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	u64 AcqRegAddr;
+	u64 RelRegAddr;
+} XAie_LockHandle;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_LockAcquire(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut);
@@ -35,5 +59,13 @@ AieRC XAie_LockRelease(XAie_DevInst *DevInst, XAie_LocType Loc, XAie_Lock Lock,
 		u32 TimeOut);
 AieRC XAie_LockSetValue(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_Lock Lock);
+AieRC XAie_LockAcquireMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u32 TimeOut, u8 *Done);
+AieRC XAie_LockReleaseMulti(XAie_DevInst *DevInst, const XAie_LockReq *Reqs,
+		u32 NumReqs, u32 TimeOut, u8 *Done);
+AieRC XAie_LockHandleInit(XAie_DevInst *DevInst, XAie_LockHandle *Handle,
+		XAie_LocType Loc, u8 LockId, s8 AcqVal, s8 RelVal);
+AieRC XAie_LockHandleAcquire(const XAie_LockHandle *Handle, u32 TimeOut);
+AieRC XAie_LockHandleRelease(const XAie_LockHandle *Handle, u32 TimeOut);
 
 #endif		/* end of protection macro */
@@ -36,6 +36,43 @@
 #define XAIE_LOCK_RESULT_MASK		0x1
 
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the register offset of a lock request. Lock requests without
+* value use the register of the lock id, requests with value use the register
+* of the lock id and value.
+*
+* @param	LockMod: Internal lock module data structure.
+* @param	Lock: Lock data structure with LockId and LockValue.
+* @param	IsAcquire: XAIE_ENABLE for an acquire request, XAIE_DISABLE
+*		for a release request.
+*
+* @return	Register offset of the lock request within the tile.
+*
+* @note 	Internal API for AIE. This API should not be called directly.
+*		It is invoked only using the function pointer part of the lock
+*		module data structure.
+*
+******************************************************************************/
+u32 _XAie_LockGetRegOff(const XAie_LockMod *LockMod, XAie_Lock Lock,
+		u8 IsAcquire)
+{
+	u32 RegOff;
+
+	RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff);
+	if(IsAcquire == XAIE_ENABLE) {
+		RegOff += LockMod->RelAcqOff;
+	}
+
+	if(Lock.LockVal != XAIE_LOCK_WITH_NO_VALUE) {
+		RegOff += XAIE_LOCK_WITH_VALUE_OFF +
+			(Lock.LockVal * LockMod->LockValOff);
+	}
+
+	return RegOff;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -66,18 +103,9 @@ AieRC _XAie_LockAcquire(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
 {
 	u64 RegAddr;
-	u32 RegOff;
 
-	if(Lock.LockVal == XAIE_LOCK_WITH_NO_VALUE) {
-		RegOff = LockMod->BaseAddr +
-			(Lock.LockId * LockMod->LockIdOff) + LockMod->RelAcqOff;
-	} else {
-		RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff) +
-			LockMod->RelAcqOff + XAIE_LOCK_WITH_VALUE_OFF +
-			(Lock.LockVal * LockMod->LockValOff);
-	}
-
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
+	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		_XAie_LockGetRegOff(LockMod, Lock, XAIE_ENABLE);
 
 	if(XAie_MaskPoll(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
 				(XAIE_LOCK_RESULT_SUCCESS <<
@@ -119,18 +147,9 @@ AieRC _XAie_LockRelease(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
 {
 	u64 RegAddr;
-	u32 RegOff;
-
-	if(Lock.LockVal == XAIE_LOCK_WITH_NO_VALUE) {
-		RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff);
-	} else {
-		RegOff = LockMod->BaseAddr +
-			(Lock.LockId * LockMod->LockIdOff) +
-			XAIE_LOCK_WITH_VALUE_OFF +
-			(Lock.LockVal * LockMod->LockValOff);
-	}
 
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
+	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		_XAie_LockGetRegOff(LockMod, Lock, XAIE_DISABLE);
 
 	if(XAie_MaskPoll(DevInst, RegAddr, XAIE_LOCK_RESULT_MASK,
 				(XAIE_LOCK_RESULT_SUCCESS <<
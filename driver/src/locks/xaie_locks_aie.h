@@ -31,6 +31,8 @@
 /************************** Constant Definitions *****************************/
 
 /************************** Function Prototypes  *****************************/
+u32 _XAie_LockGetRegOff(const XAie_LockMod *LockMod, XAie_Lock Lock,
+		u8 IsAcquire);
 AieRC _XAie_LockAcquire(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut);
 AieRC _XAie_LockRelease(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
@@ -39,6 +39,38 @@
 #define XAIEML_LOCK_RESULT_MASK		0x1U
 
 /************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the register offset of a lock request.
+*
+* @param	LockMod: Internal lock module data structure.
+* @param	Lock: Lock data structure with LockId and LockValue.
+* @param	IsAcquire: XAIE_ENABLE for an acquire request, XAIE_DISABLE
+*		for a release request.
+*
+* @return	Register offset of the lock request within the tile.
+*
+* @note 	Internal API for AIEML. This API should not be called directly.
+*		It is invoked only using the function pointer part of the lock
+*		module data structure.
+*
+******************************************************************************/
+u32 _XAieMl_LockGetRegOff(const XAie_LockMod *LockMod, XAie_Lock Lock,
+		u8 IsAcquire)
+{
+	u32 RegOff;
+
+	RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff) +
+		((Lock.LockVal & XAIEML_LOCK_VALUE_MASK) <<
+		 XAIEML_LOCK_VALUE_SHIFT);
+	if(IsAcquire == XAIE_ENABLE) {
+		RegOff += LockMod->RelAcqOff;
+	}
+
+	return RegOff;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -67,13 +99,9 @@ AieRC _XAieMl_LockRelease(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
 {
 	u64 RegAddr;
-	u32 RegOff;
 
-	RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff) +
-		((Lock.LockVal & XAIEML_LOCK_VALUE_MASK) <<
-		 XAIEML_LOCK_VALUE_SHIFT);
-
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
+	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		_XAieMl_LockGetRegOff(LockMod, Lock, XAIE_DISABLE);
 
 	if(XAie_MaskPoll(DevInst, RegAddr, XAIEML_LOCK_RESULT_MASK,
 				(XAIEML_LOCK_RESULT_SUCCESS <<
@@ -113,14 +141,9 @@ AieRC _XAieMl_LockAcquire(XAie_DevInst *DevInst, const XAie_LockMod *LockMod,
 		XAie_LocType Loc, XAie_Lock Lock, u32 TimeOut)
 {
 	u64 RegAddr;
-	u32 RegOff;
-
-	RegOff = LockMod->BaseAddr + (Lock.LockId * LockMod->LockIdOff) +
-		(LockMod->RelAcqOff) + ((Lock.LockVal &
-					XAIEML_LOCK_VALUE_MASK) <<
-				XAIEML_LOCK_VALUE_SHIFT);
 
-	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
+	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		_XAieMl_LockGetRegOff(LockMod, Lock, XAIE_ENABLE);
 
 	if(XAie_MaskPoll(DevInst, RegAddr, XAIEML_LOCK_RESULT_MASK,
 				(XAIEML_LOCK_RESULT_SUCCESS <<
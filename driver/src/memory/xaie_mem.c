@@ -64,14 +64,14 @@ AieRC XAie_DataMemWrWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)){
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
 	if(Addr >= MemMod->Size) {
 		XAIE_ERROR("Address out of range\n");
 		return XAIE_INVALID_DATA_MEM_ADDR;
@@ -112,14 +112,14 @@ AieRC XAie_DataMemRdWord(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)){
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
 	if(Addr >= MemMod->Size) {
 		XAIE_ERROR("Address out of range\n");
 		return XAIE_INVALID_DATA_MEM_ADDR;
@@ -169,14 +169,14 @@ AieRC XAie_DataMemBlockWrite(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
 
 	/* Check for any size overflow */
 	if((u64)Addr + Size > MemMod->Size) {
@@ -278,14 +278,14 @@ AieRC XAie_DataMemBlockRead(XAie_DevInst *DevInst, XAie_LocType Loc, u32 Addr,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
 			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
 
 	/* Check for any size overflow */
 	if((u64)Addr + Size > MemMod->Size) {
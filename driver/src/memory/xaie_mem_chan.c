@@ -0,0 +1,444 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mem_chan.c
+* @{
+*
+* This file contains routines to stream data from the host to a tile through
+* a ring of buffers in the tile data memory. The buffers are guarded by locks,
+* so the host fills buffer N + 1 while the tile consumes buffer N, without any
+* buffering logic in the application.
+*
+* A lock operation is a mask poll in the backend. A poll which does not
+* succeed on the first read sleeps for at least the polling interval of the
+* backend, which is far longer than the time a tile needs to release a buffer
+* in a steady stream. The channel therefore retries the acquire without a
+* timeout for a configurable number of times before it falls back to a
+* blocking poll.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#endif /* __linux__ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_mem.h"
+#include "xaie_mem_chan.h"
+
+#if defined(XAIE_FEATURE_DATAMEM_ENABLE) && defined(XAIE_FEATURE_LOCK_ENABLE)
+
+/****************************** Type Definitions *****************************/
+struct XAie_MemChan {
+	XAie_DevInst *DevInst;
+	const XAie_LockMod *LockMod;
+	XAie_MemChanCfg Cfg;
+	u8 IsSemaphore;		/* AIE-ML counting semaphores */
+	u8 Head;		/* Next buffer to fill */
+	u64 FirstNs;		/* End of the first write */
+	XAie_MemChanStats Stats;
+};
+
+/************************** Function Definitions *****************************/
+static inline u64 _XAie_MemChanGetNs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000000UL + (u64)Ts.tv_nsec;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires a lock of the channel. The lock is polled without timeout
+* up to SpinCount times before the blocking poll.
+*
+* @param	Chan: Channel
+* @param	Lock: Lock to acquire.
+* @param	TimeOut: Timeout of the blocking poll in usecs.
+* @param	Stalled: Set to 1 if the first attempt failed.
+*
+* @return	XAIE_OK if the lock is acquired, else XAIE_LOCK_RESULT_FAILED.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_MemChanAcquire(XAie_MemChan *Chan, XAie_Lock Lock,
+		u32 TimeOut, u8 *Stalled)
+{
+	const XAie_LockMod *LockMod = Chan->LockMod;
+	u32 Spin = Chan->Cfg.SpinCount;
+
+	*Stalled = 0U;
+	do {
+		if(LockMod->Acquire(Chan->DevInst, LockMod, Chan->Cfg.Loc,
+					Lock, 0U) == XAIE_OK) {
+			return XAIE_OK;
+		}
+		*Stalled = 1U;
+	} while(Spin-- > 0U);
+
+	if(TimeOut == 0U) {
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	return LockMod->Acquire(Chan->DevInst, LockMod, Chan->Cfg.Loc, Lock,
+			TimeOut);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates a host to tile channel over a ring of buffers in the data
+* memory of an AIE tile or a memory tile. For AIE-ML devices, the producer
+* lock is initialized to the number of buffers and the consumer lock to 0.
+* AIE locks cannot be initialized by value, they shall be free, i.e. acquired
+* with 0 by the host, when the channel is created.
+*
+* @param	DevInst: Device Instance
+* @param	Cfg: Channel configuration.
+* @param	Chan: Pointer to return the channel.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The tile program shall follow the lock protocol described in
+*		xaie_mem_chan.h and consume the buffers in the same round robin
+*		order as the host fills them.
+*
+*******************************************************************************/
+AieRC XAie_MemChanCreate(XAie_DevInst *DevInst, const XAie_MemChanCfg *Cfg,
+		XAie_MemChan **Chan)
+{
+	AieRC RC;
+	u8 TileType, IsSemaphore;
+	const XAie_MemMod *MemMod;
+	const XAie_LockMod *LockMod;
+	XAie_MemChan *NewChan;
+
+	if((DevInst == XAIE_NULL) || (Cfg == XAIE_NULL) ||
+			(Chan == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Cfg->Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	if((Cfg->NumBufs == 0U) || (Cfg->NumBufs > XAIE_MEM_CHAN_MAX_BUFS) ||
+			(Cfg->BufSize == 0U)) {
+		XAIE_ERROR("Invalid number or size of buffers\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
+	for(u8 i = 0U; i < Cfg->NumBufs; i++) {
+		if((u64)Cfg->BufAddr[i] + Cfg->BufSize > MemMod->Size) {
+			XAIE_ERROR("Buffer %u overflows tile data memory\n",
+					i);
+			return XAIE_INVALID_DATA_MEM_ADDR;
+		}
+	}
+
+	LockMod = _XAie_GetDevMod(DevInst)[TileType].LockMod;
+	IsSemaphore = (DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE);
+	if(IsSemaphore) {
+		if((Cfg->ProdLockId >= LockMod->NumLocks) ||
+				(Cfg->ConsLockId >= LockMod->NumLocks) ||
+				(Cfg->ProdLockId == Cfg->ConsLockId)) {
+			XAIE_ERROR("Invalid Lock Id\n");
+			return XAIE_INVALID_LOCK_ID;
+		}
+
+		if(Cfg->NumBufs > LockMod->LockValUpperBound) {
+			XAIE_ERROR("Too many buffers for lock value range\n");
+			return XAIE_INVALID_LOCK_VALUE;
+		}
+	} else if((u32)Cfg->ProdLockId + Cfg->NumBufs > LockMod->NumLocks) {
+		XAIE_ERROR("Invalid Lock Id\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if(IsSemaphore) {
+		RC = LockMod->SetValue(DevInst, LockMod, Cfg->Loc,
+				XAie_LockInit(Cfg->ProdLockId,
+					(s8)Cfg->NumBufs));
+		if(RC == XAIE_OK) {
+			RC = LockMod->SetValue(DevInst, LockMod, Cfg->Loc,
+					XAie_LockInit(Cfg->ConsLockId, 0));
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Failed to initialize channel locks\n");
+			return RC;
+		}
+	}
+
+	NewChan = (XAie_MemChan *)calloc(1U, sizeof(*NewChan));
+	if(NewChan == XAIE_NULL) {
+		XAIE_ERROR("Failed to allocate memory for channel\n");
+		return XAIE_ERR;
+	}
+
+	NewChan->DevInst = DevInst;
+	NewChan->LockMod = LockMod;
+	NewChan->Cfg = *Cfg;
+	NewChan->IsSemaphore = IsSemaphore;
+	*Chan = NewChan;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes data to the next buffer of the channel and hands the buffer
+* over to the tile. It waits for the tile to free the buffer if all the
+* buffers are in use.
+*
+* @param	Chan: Channel
+* @param	Src: Data to write.
+* @param	Size: Size of the data in bytes, at most the buffer size.
+* @param	TimeOut: Time to wait for a free buffer in usecs. If 0, the
+*		free buffer is only polled SpinCount times.
+*
+* @return	XAIE_OK on success, XAIE_LOCK_RESULT_FAILED if no buffer was
+*		freed in time, else error code.
+*
+* @note		A channel shall be used by one thread at a time.
+*
+*******************************************************************************/
+AieRC XAie_MemChanWrite(XAie_MemChan *Chan, const void *Src, u32 Size,
+		u32 TimeOut)
+{
+	AieRC RC;
+	u8 Stalled;
+	u64 StartNs, AcqNs, EndNs;
+	XAie_Lock ProdLock, ConsLock;
+	XAie_MemChanStats *Stats;
+
+	if((Chan == XAIE_NULL) || (Src == XAIE_NULL) || (Size == 0U) ||
+			(Size > Chan->Cfg.BufSize)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Chan->IsSemaphore) {
+		ProdLock = XAie_LockInit(Chan->Cfg.ProdLockId, -1);
+		ConsLock = XAie_LockInit(Chan->Cfg.ConsLockId, 1);
+	} else {
+		ProdLock = XAie_LockInit(Chan->Cfg.ProdLockId + Chan->Head, 0);
+		ConsLock = XAie_LockInit(Chan->Cfg.ProdLockId + Chan->Head, 1);
+	}
+
+	Stats = &Chan->Stats;
+	StartNs = _XAie_MemChanGetNs();
+	RC = _XAie_MemChanAcquire(Chan, ProdLock, TimeOut, &Stalled);
+	AcqNs = _XAie_MemChanGetNs();
+	if(Stalled) {
+		Stats->NumStalls++;
+		Stats->StallNs += AcqNs - StartNs;
+	}
+	if(RC != XAIE_OK) {
+		Stats->NumTimeOuts++;
+		return RC;
+	}
+
+	RC = XAie_DataMemBlockWrite(Chan->DevInst, Chan->Cfg.Loc,
+			Chan->Cfg.BufAddr[Chan->Head], Src, Size);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to write channel buffer\n");
+		/* Give the buffer back */
+		if(Chan->IsSemaphore) {
+			ProdLock.LockVal = 1;
+		}
+		Chan->LockMod->Release(Chan->DevInst, Chan->LockMod,
+				Chan->Cfg.Loc, ProdLock, 0U);
+		return RC;
+	}
+
+	RC = Chan->LockMod->Release(Chan->DevInst, Chan->LockMod,
+			Chan->Cfg.Loc, ConsLock, 0U);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to hand over channel buffer\n");
+		return RC;
+	}
+
+	Chan->Head = (u8)((Chan->Head + 1U) % Chan->Cfg.NumBufs);
+
+	EndNs = _XAie_MemChanGetNs();
+	if(Stats->NumXfers == 0U) {
+		Chan->FirstNs = EndNs;
+		Stats->MinNs = EndNs - StartNs;
+	}
+	if(EndNs - StartNs < Stats->MinNs) {
+		Stats->MinNs = EndNs - StartNs;
+	}
+	if(EndNs - StartNs > Stats->MaxNs) {
+		Stats->MaxNs = EndNs - StartNs;
+	}
+	Stats->NumXfers++;
+	Stats->Bytes += Size;
+	Stats->TotalNs += EndNs - StartNs;
+	Stats->WallNs = EndNs - Chan->FirstNs;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits until the tile has consumed all the buffers written to the
+* channel.
+*
+* @param	Chan: Channel
+* @param	TimeOut: Time to wait for each buffer in usecs.
+*
+* @return	XAIE_OK on success, XAIE_LOCK_RESULT_FAILED if the buffers were
+*		not freed in time, else error code.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemChanSync(XAie_MemChan *Chan, u32 TimeOut)
+{
+	AieRC RC;
+	u8 Stalled, LockId;
+	XAie_Lock Lock;
+
+	if(Chan == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Chan->IsSemaphore) {
+		Lock = XAie_LockInit(Chan->Cfg.ProdLockId,
+				(s8)(-(s8)Chan->Cfg.NumBufs));
+		RC = _XAie_MemChanAcquire(Chan, Lock, TimeOut, &Stalled);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Lock.LockVal = (s8)Chan->Cfg.NumBufs;
+		return Chan->LockMod->Release(Chan->DevInst, Chan->LockMod,
+				Chan->Cfg.Loc, Lock, 0U);
+	}
+
+	/* Buffers are consumed in order, the oldest one first */
+	for(u8 i = 0U; i < Chan->Cfg.NumBufs; i++) {
+		LockId = (u8)(Chan->Cfg.ProdLockId +
+				(Chan->Head + i) % Chan->Cfg.NumBufs);
+		Lock = XAie_LockInit(LockId, 0);
+		RC = _XAie_MemChanAcquire(Chan, Lock, TimeOut, &Stalled);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = Chan->LockMod->Release(Chan->DevInst, Chan->LockMod,
+				Chan->Cfg.Loc, Lock, 0U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of a channel. The throughput of the channel
+* is Bytes / WallNs.
+*
+* @param	Chan: Channel
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemChanGetStats(const XAie_MemChan *Chan, XAie_MemChanStats *Stats)
+{
+	if((Chan == XAIE_NULL) || (Stats == XAIE_NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Stats = Chan->Stats;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the statistics of a channel.
+*
+* @param	Chan: Channel
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemChanResetStats(XAie_MemChan *Chan)
+{
+	if(Chan == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	memset(&Chan->Stats, 0, sizeof(Chan->Stats));
+	Chan->FirstNs = 0U;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees a channel. The buffers and locks of the tile are left as is.
+*
+* @param	Chan: Channel
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_MemChanDestroy(XAie_MemChan *Chan)
+{
+	if(Chan == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Chan);
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE && XAIE_FEATURE_LOCK_ENABLE */
+/** @} */
@@ -0,0 +1,82 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_mem_chan.h
+* @{
+*
+* Header file for the host to tile data memory channels.
+*
+******************************************************************************/
+#ifndef XAIEMEMCHAN_H
+#define XAIEMEMCHAN_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_MEM_CHAN_MAX_BUFS		8U
+/* Number of non blocking lock attempts before sleeping in the backend */
+#define XAIE_MEM_CHAN_DEFAULT_SPIN	64U
+
+/**************************** Type Definitions *******************************/
+/*
+ * Configuration of a host to tile channel. The host fills the buffers in
+ * round robin order.
+ *
+ * For AIE-ML devices, the buffers are guarded by two semaphore locks:
+ * - ProdLockId counts the free buffers. The host acquires it with -1 before
+ *   it writes a buffer, the tile releases it with +1 when it is done with a
+ *   buffer.
+ * - ConsLockId counts the filled buffers. The host releases it with +1 after
+ *   it wrote a buffer, the tile acquires it with -1 before it reads a buffer.
+ *
+ * For AIE devices, buffer i is guarded by lock ProdLockId + i. The host
+ * acquires it with 0 and releases it with 1, the tile acquires it with 1 and
+ * releases it with 0. ConsLockId is ignored.
+ */
+typedef struct {
+	XAie_LocType Loc;		/* AIE tile or memory tile */
+	u32 BufAddr[XAIE_MEM_CHAN_MAX_BUFS]; /* Data memory address of buffers */
+	u32 BufSize;			/* Size of each buffer in bytes */
+	u8 NumBufs;
+	u8 ProdLockId;
+	u8 ConsLockId;
+	u32 SpinCount;			/* Non blocking acquires before sleeping */
+} XAie_MemChanCfg;
+
+/*
+ * Statistics of a channel. All the times are in nanoseconds and are only
+ * collected on Linux.
+ */
+typedef struct {
+	u64 NumXfers;		/* Number of buffers written */
+	u64 Bytes;		/* Number of bytes written */
+	u64 NumStalls;		/* Writes which did not find a free buffer */
+	u64 NumTimeOuts;	/* Writes which timed out waiting for a buffer */
+	u64 StallNs;		/* Time waited for free buffers */
+	u64 TotalNs;		/* Time spent in XAie_MemChanWrite() */
+	u64 MinNs;		/* Fastest write */
+	u64 MaxNs;		/* Slowest write */
+	u64 WallNs;		/* Time from the first to the last write */
+} XAie_MemChanStats;
+
+typedef struct XAie_MemChan XAie_MemChan;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_MemChanCreate(XAie_DevInst *DevInst, const XAie_MemChanCfg *Cfg,
+		XAie_MemChan **Chan);
+AieRC XAie_MemChanWrite(XAie_MemChan *Chan, const void *Src, u32 Size,
+		u32 TimeOut);
+AieRC XAie_MemChanSync(XAie_MemChan *Chan, u32 TimeOut);
+AieRC XAie_MemChanGetStats(const XAie_MemChan *Chan, XAie_MemChanStats *Stats);
+AieRC XAie_MemChanResetStats(XAie_MemChan *Chan);
+AieRC XAie_MemChanDestroy(XAie_MemChan *Chan);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -0,0 +1,507 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_rtp.c
+* @{
+*
+* This file contains routines to update the run time parameters of running
+* kernels from the host. The parameters are described once, when the update
+* engine is created: the tile, the lock requests and the data memory
+* addresses are validated and resolved to absolute addresses at that time.
+*
+* The host stages new values with XAie_RtpSet() during a frame and writes
+* them with one XAie_RtpCommit(). A staged value which is set again before the
+* commit is only written once. The commit issues the acquire of every pending
+* parameter without waiting and writes the parameters whose lock is free
+* right away, so the parameters of busy kernels do not delay the others.
+* Only when all the remaining locks are busy does the commit block on one of
+* them.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#endif /* __linux__ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_locks.h"
+#include "xaie_mem.h"
+#include "xaie_rtp.h"
+
+#if defined(XAIE_FEATURE_DATAMEM_ENABLE) && defined(XAIE_FEATURE_LOCK_ENABLE)
+
+/****************************** Type Definitions *****************************/
+typedef struct {
+	u64 DataAddr[XAIE_RTP_MAX_BUFS];	/* Absolute buffer addresses */
+	u64 AcqAddr[XAIE_RTP_MAX_BUFS];		/* Absolute acquire requests */
+	u64 RelAddr[XAIE_RTP_MAX_BUFS];		/* Absolute release requests */
+	u32 *Staged;		/* Value of the next commit */
+	u32 *Committed;		/* Last value written */
+	u32 NumWords;
+	u8 NumBufs;
+	u8 Cur;			/* Next buffer to write */
+	u8 IsDirty;		/* Staged value is not written yet */
+	u8 IsWritten;		/* Committed holds a value */
+} XAie_RtpEntry;
+
+struct XAie_Rtp {
+	XAie_DevInst *DevInst;
+	u32 NumEntries;
+	u32 Flags;
+	XAie_RtpEntry *Entries;
+	u32 *Values;		/* Storage of the staged and committed values */
+	XAie_RtpStats Stats;
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API checks a lock request of a run time parameter.
+*
+* @param	LockMod: Lock module of the tile.
+* @param	Lock: Lock request.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RtpCheckLock(const XAie_LockMod *LockMod, XAie_Lock Lock)
+{
+	if(Lock.LockId >= LockMod->NumLocks) {
+		XAIE_ERROR("Invalid Lock Id\n");
+		return XAIE_INVALID_LOCK_ID;
+	}
+
+	if((Lock.LockVal > LockMod->LockValUpperBound) ||
+			(Lock.LockVal < LockMod->LockValLowerBound)) {
+		XAIE_ERROR("Lock value out of range\n");
+		return XAIE_INVALID_LOCK_VALUE;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API validates a run time parameter descriptor and resolves its buffers
+* and lock requests to absolute addresses.
+*
+* @param	DevInst: Device Instance
+* @param	Desc: Run time parameter descriptor.
+* @param	Entry: Entry to initialize.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RtpInitEntry(XAie_DevInst *DevInst,
+		const XAie_RtpDesc *Desc, XAie_RtpEntry *Entry)
+{
+	AieRC RC;
+	u8 TileType;
+	u64 TileAddr;
+	const XAie_MemMod *MemMod;
+	const XAie_LockMod *LockMod;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Desc->Loc);
+	if((TileType != XAIEGBL_TILE_TYPE_AIETILE) &&
+			(TileType != XAIEGBL_TILE_TYPE_MEMTILE)) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	if((Desc->NumBufs == 0U) || (Desc->NumBufs > XAIE_RTP_MAX_BUFS) ||
+			(Desc->Size == 0U) ||
+			((Desc->Size & XAIE_MEM_WORD_ALIGN_MASK) != 0U)) {
+		XAIE_ERROR("Invalid number or size of buffers\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
+	LockMod = _XAie_GetDevMod(DevInst)[TileType].LockMod;
+	TileAddr = _XAie_GetTileAddr(DevInst, Desc->Loc.Row, Desc->Loc.Col);
+	for(u8 i = 0U; i < Desc->NumBufs; i++) {
+		if(((Desc->BufAddr[i] & XAIE_MEM_WORD_ALIGN_MASK) != 0U) ||
+				((u64)Desc->BufAddr[i] + Desc->Size >
+				 MemMod->Size)) {
+			XAIE_ERROR("Invalid address of buffer %u\n", i);
+			return XAIE_INVALID_DATA_MEM_ADDR;
+		}
+
+		RC = _XAie_RtpCheckLock(LockMod, Desc->Acq[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		RC = _XAie_RtpCheckLock(LockMod, Desc->Rel[i]);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		Entry->DataAddr[i] = TileAddr + MemMod->MemAddr +
+			Desc->BufAddr[i];
+		Entry->AcqAddr[i] = TileAddr +
+			LockMod->GetRegOff(LockMod, Desc->Acq[i], XAIE_ENABLE);
+		Entry->RelAddr[i] = TileAddr +
+			LockMod->GetRegOff(LockMod, Desc->Rel[i], XAIE_DISABLE);
+	}
+
+	Entry->NumWords = Desc->Size / XAIE_MEM_WORD_ALIGN_SIZE;
+	Entry->NumBufs = Desc->NumBufs;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the staged value of a parameter to its current buffer,
+* whose lock is already acquired, and hands the buffer over to the kernel.
+*
+* @param	Rtp: Update engine
+* @param	Entry: Parameter to write.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RtpWrite(XAie_Rtp *Rtp, XAie_RtpEntry *Entry)
+{
+	AieRC RC;
+
+	RC = XAie_BlockWrite32(Rtp->DevInst, Entry->DataAddr[Entry->Cur],
+			Entry->Staged, Entry->NumWords);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to write run time parameter\n");
+		return RC;
+	}
+
+	RC = XAie_MaskPoll(Rtp->DevInst, Entry->RelAddr[Entry->Cur],
+			XAIE_LOCK_REQ_RESULT_MASK, XAIE_LOCK_REQ_RESULT_SUCCESS,
+			0U);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Failed to release run time parameter buffer\n");
+		return XAIE_LOCK_RESULT_FAILED;
+	}
+
+	memcpy(Entry->Committed, Entry->Staged,
+			Entry->NumWords * XAIE_MEM_WORD_ALIGN_SIZE);
+	Entry->IsDirty = 0U;
+	Entry->IsWritten = 1U;
+	Entry->Cur = (u8)((Entry->Cur + 1U) % Entry->NumBufs);
+	Rtp->Stats.NumWrites++;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API creates an update engine for a table of run time parameters.
+*
+* @param	DevInst: Device Instance
+* @param	Descs: Array of run time parameter descriptors.
+* @param	NumDescs: Number of descriptors.
+* @param	Flags: 0 or XAIE_RTP_SKIP_UNCHANGED.
+* @param	Rtp: Pointer to return the update engine.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The parameters are identified by their index in Descs.
+*
+*******************************************************************************/
+AieRC XAie_RtpCreate(XAie_DevInst *DevInst, const XAie_RtpDesc *Descs,
+		u32 NumDescs, u32 Flags, XAie_Rtp **Rtp)
+{
+	AieRC RC;
+	u64 NumWords = 0U;
+	u32 *Values;
+	XAie_Rtp *NewRtp;
+
+	if((DevInst == XAIE_NULL) || (Descs == XAIE_NULL) ||
+			(NumDescs == 0U) || (Rtp == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	NewRtp = (XAie_Rtp *)calloc(1U, sizeof(*NewRtp));
+	if(NewRtp == XAIE_NULL) {
+		XAIE_ERROR("Failed to allocate memory for update engine\n");
+		return XAIE_ERR;
+	}
+
+	NewRtp->Entries = (XAie_RtpEntry *)calloc(NumDescs,
+			sizeof(*NewRtp->Entries));
+	if(NewRtp->Entries == XAIE_NULL) {
+		XAIE_ERROR("Failed to allocate memory for update engine\n");
+		free(NewRtp);
+		return XAIE_ERR;
+	}
+
+	for(u32 i = 0U; i < NumDescs; i++) {
+		RC = _XAie_RtpInitEntry(DevInst, &Descs[i],
+				&NewRtp->Entries[i]);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Invalid run time parameter %u\n", i);
+			free(NewRtp->Entries);
+			free(NewRtp);
+			return RC;
+		}
+		NumWords += NewRtp->Entries[i].NumWords;
+	}
+
+	NewRtp->Values = (u32 *)calloc(NumWords * 2U, sizeof(u32));
+	if(NewRtp->Values == XAIE_NULL) {
+		XAIE_ERROR("Failed to allocate memory for update engine\n");
+		free(NewRtp->Entries);
+		free(NewRtp);
+		return XAIE_ERR;
+	}
+
+	Values = NewRtp->Values;
+	for(u32 i = 0U; i < NumDescs; i++) {
+		NewRtp->Entries[i].Staged = Values;
+		Values += NewRtp->Entries[i].NumWords;
+		NewRtp->Entries[i].Committed = Values;
+		Values += NewRtp->Entries[i].NumWords;
+	}
+
+	NewRtp->DevInst = DevInst;
+	NewRtp->NumEntries = NumDescs;
+	NewRtp->Flags = Flags;
+	*Rtp = NewRtp;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stages a new value of a run time parameter. The value is written
+* by the next XAie_RtpCommit(). If the parameter is set again before the
+* commit, only the last value is written.
+*
+* @param	Rtp: Update engine
+* @param	Idx: Index of the parameter in the descriptors of the engine.
+* @param	Value: New value, of the size of the parameter.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		With XAIE_RTP_SKIP_UNCHANGED, a value equal to the last
+*		committed one cancels the staged update.
+*
+*******************************************************************************/
+AieRC XAie_RtpSet(XAie_Rtp *Rtp, u32 Idx, const void *Value)
+{
+	u32 Size;
+	XAie_RtpEntry *Entry;
+
+	if((Rtp == XAIE_NULL) || (Value == XAIE_NULL) ||
+			(Idx >= Rtp->NumEntries)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Entry = &Rtp->Entries[Idx];
+	Size = Entry->NumWords * XAIE_MEM_WORD_ALIGN_SIZE;
+	Rtp->Stats.NumSets++;
+	if(Entry->IsDirty) {
+		Rtp->Stats.NumMerged++;
+	}
+
+	if(((Rtp->Flags & XAIE_RTP_SKIP_UNCHANGED) != 0U) &&
+			Entry->IsWritten &&
+			(memcmp(Entry->Committed, Value, Size) == 0)) {
+		Entry->IsDirty = 0U;
+		Rtp->Stats.NumSkipped++;
+		return XAIE_OK;
+	}
+
+	memcpy(Entry->Staged, Value, Size);
+	Entry->IsDirty = 1U;
+
+	return XAIE_OK;
+}
+
+static inline u64 _XAie_RtpGetUs(void)
+{
+#ifdef __linux__
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (u64)Ts.tv_sec * 1000000UL + (u64)Ts.tv_nsec / 1000UL;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes all the staged run time parameters. Every pending parameter
+* is tried without waiting in each sweep, and is written as soon as its lock
+* is acquired. When no lock was free in a sweep, the commit waits for the
+* first pending parameter for up to XAIE_RTP_POLL_US before the next sweep.
+* The timeout is checked against the elapsed wall clock time, or against the
+* time spent polling where no clock is available.
+*
+* @param	Rtp: Update engine
+* @param	TimeOut: Timeout shared by all the parameters in usecs. If 0,
+*		each parameter is tried once.
+*
+* @return	XAIE_OK if all the parameters are written,
+*		XAIE_LOCK_RESULT_FAILED if some locks were not acquired in time,
+*		else error code.
+*
+* @note		The parameters which were not written stay staged, the commit
+*		can be retried. If a write fails, the lock acquired for it is
+*		not released.
+*
+*******************************************************************************/
+AieRC XAie_RtpCommit(XAie_Rtp *Rtp, u32 TimeOut)
+{
+	AieRC RC;
+	u32 Pending, First, Slice;
+	u64 StartUs, ElapsedUs, PolledUs = 0U;
+	u8 Stalled = 0U;
+	XAie_RtpEntry *Entry;
+
+	if(Rtp == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	StartUs = _XAie_RtpGetUs();
+	while(1) {
+		Pending = 0U;
+		First = Rtp->NumEntries;
+		for(u32 i = 0U; i < Rtp->NumEntries; i++) {
+			Entry = &Rtp->Entries[i];
+			if(Entry->IsDirty == 0U) {
+				continue;
+			}
+
+			RC = XAie_MaskPoll(Rtp->DevInst,
+					Entry->AcqAddr[Entry->Cur],
+					XAIE_LOCK_REQ_RESULT_MASK,
+					XAIE_LOCK_REQ_RESULT_SUCCESS, 0U);
+			if(RC == XAIE_OK) {
+				RC = _XAie_RtpWrite(Rtp, Entry);
+				if(RC != XAIE_OK) {
+					return RC;
+				}
+			} else {
+				Pending++;
+				if(First == Rtp->NumEntries) {
+					First = i;
+				}
+			}
+		}
+
+		if(Pending == 0U) {
+			return XAIE_OK;
+		}
+
+		ElapsedUs = _XAie_RtpGetUs() - StartUs;
+		if(ElapsedUs < PolledUs) {
+			ElapsedUs = PolledUs;
+		}
+		if(ElapsedUs >= TimeOut) {
+			return XAIE_LOCK_RESULT_FAILED;
+		}
+
+		if(Stalled == 0U) {
+			Stalled = 1U;
+			Rtp->Stats.NumStalls++;
+		}
+
+		Slice = ((TimeOut - ElapsedUs) < XAIE_RTP_POLL_US) ?
+			(u32)(TimeOut - ElapsedUs) : XAIE_RTP_POLL_US;
+		PolledUs += Slice;
+
+		Entry = &Rtp->Entries[First];
+		RC = XAie_MaskPoll(Rtp->DevInst, Entry->AcqAddr[Entry->Cur],
+				XAIE_LOCK_REQ_RESULT_MASK,
+				XAIE_LOCK_REQ_RESULT_SUCCESS, Slice);
+		if(RC == XAIE_OK) {
+			RC = _XAie_RtpWrite(Rtp, Entry);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of an update engine.
+*
+* @param	Rtp: Update engine
+* @param	Stats: Pointer to return the statistics.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_RtpGetStats(const XAie_Rtp *Rtp, XAie_RtpStats *Stats)
+{
+	if((Rtp == XAIE_NULL) || (Stats == XAIE_NULL)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	*Stats = Rtp->Stats;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees an update engine. The staged values which were not committed
+* are dropped, the buffers and locks of the tiles are left as is.
+*
+* @param	Rtp: Update engine
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+*******************************************************************************/
+AieRC XAie_RtpDestroy(XAie_Rtp *Rtp)
+{
+	if(Rtp == XAIE_NULL) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	free(Rtp->Values);
+	free(Rtp->Entries);
+	free(Rtp);
+
+	return XAIE_OK;
+}
+
+#endif /* XAIE_FEATURE_DATAMEM_ENABLE && XAIE_FEATURE_LOCK_ENABLE */
+/** @} */
@@ -0,0 +1,73 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_rtp.h
+* @{
+*
+* Header file for the run time parameter update engine.
+*
+******************************************************************************/
+#ifndef XAIERTP_H
+#define XAIERTP_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIE_RTP_MAX_BUFS		2U
+/* Longest wait between two sweeps of XAie_RtpCommit() */
+#define XAIE_RTP_POLL_US		200U
+
+/* Flags of XAie_RtpCreate() */
+/* Drop the updates which do not change the last committed value */
+#define XAIE_RTP_SKIP_UNCHANGED		(1U << 0)
+
+/**************************** Type Definitions *******************************/
+/*
+ * Descriptor of a run time parameter in the data memory of an AIE tile or a
+ * memory tile. With two buffers, the parameter is double buffered and the
+ * host updates the buffers in turn, starting with buffer 0.
+ *
+ * Before it writes buffer i, the host acquires Acq[i]. After the write, it
+ * releases Rel[i]. Acq[i] and Rel[i] may use the same lock id, for instance
+ * a binary AIE lock acquired with 0 and released with 1, or two lock ids,
+ * for instance the free and full semaphores of an AIE-ML buffer.
+ *
+ * Size and the buffer addresses shall be multiples of 4 bytes.
+ */
+typedef struct {
+	XAie_LocType Loc;		/* AIE tile or memory tile */
+	u32 Size;			/* Size of the parameter in bytes */
+	u8 NumBufs;			/* 1, or 2 for double buffering */
+	u32 BufAddr[XAIE_RTP_MAX_BUFS];	/* Data memory address of buffers */
+	XAie_Lock Acq[XAIE_RTP_MAX_BUFS];	/* Host acquire of buffers */
+	XAie_Lock Rel[XAIE_RTP_MAX_BUFS];	/* Host release of buffers */
+} XAie_RtpDesc;
+
+/* Statistics of an update engine */
+typedef struct {
+	u64 NumSets;		/* Calls to XAie_RtpSet() */
+	u64 NumWrites;		/* Parameters written to the tiles */
+	u64 NumMerged;		/* Updates overwritten before their commit */
+	u64 NumSkipped;		/* Updates dropped as unchanged */
+	u64 NumStalls;		/* Commits which waited for a lock */
+} XAie_RtpStats;
+
+typedef struct XAie_Rtp XAie_Rtp;
+
+/************************** Function Prototypes  *****************************/
+AieRC XAie_RtpCreate(XAie_DevInst *DevInst, const XAie_RtpDesc *Descs,
+		u32 NumDescs, u32 Flags, XAie_Rtp **Rtp);
+AieRC XAie_RtpSet(XAie_Rtp *Rtp, u32 Idx, const void *Value);
+AieRC XAie_RtpCommit(XAie_Rtp *Rtp, u32 TimeOut);
+AieRC XAie_RtpGetStats(const XAie_Rtp *Rtp, XAie_RtpStats *Stats);
+AieRC XAie_RtpDestroy(XAie_Rtp *Rtp);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -27,9 +27,13 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+
+#include "xaie_core.h"
 #include "xaie_feature_config.h"
 #include "xaie_perfcnt.h"
 #include "xaie_events.h"
+#include "xaie_events_internal.h"
 
 #ifdef XAIE_FEATURE_PERFCOUNT_ENABLE
 
@@ -70,7 +74,7 @@ AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -83,9 +87,9 @@ AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
 	}
 
 	/* Checking for valid Counter */
@@ -141,7 +145,7 @@ AieRC XAie_PerfCounterControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -154,11 +158,11 @@ AieRC XAie_PerfCounterControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	/* check if the event passed as input is corresponding to the module */
@@ -245,7 +249,7 @@ AieRC XAie_PerfCounterResetControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -258,11 +262,11 @@ AieRC XAie_PerfCounterResetControlSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	/* check if the event passed as input is corresponding to the module */
@@ -343,7 +347,7 @@ AieRC XAie_PerfCounterSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -356,9 +360,9 @@ AieRC XAie_PerfCounterSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
 	}
 
 	/* Checking for valid Counter */
@@ -410,7 +414,7 @@ AieRC XAie_PerfCounterEventValueSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -423,9 +427,9 @@ AieRC XAie_PerfCounterEventValueSet(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
 	}
 
 	/* Checking for valid Counter */
@@ -523,7 +527,7 @@ AieRC XAie_PerfCounterResetControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -536,9 +540,9 @@ AieRC XAie_PerfCounterResetControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	/* Since first event of all modules is NONE event, using it to reset */
@@ -584,7 +588,7 @@ AieRC XAie_PerfCounterControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -597,9 +601,9 @@ AieRC XAie_PerfCounterControlReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	/* Since first event of all modules is NONE event, using it to reset */
@@ -655,7 +659,7 @@ AieRC XAie_PerfCounterGetControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		return XAIE_INVALID_TILE;
 	}
@@ -667,9 +671,9 @@ AieRC XAie_PerfCounterGetControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
 	} else {
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Module];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
 	}
 
 	/* Checking for valid Counter */
@@ -756,7 +760,7 @@ AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -768,12 +772,912 @@ AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if (TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[Module].PerfCntEventBase;
+		*Event = _XAie_GetDevMod(DevInst)[TileType].EvntMod[Module].PerfCntEventBase;
 	} else {
-		*Event = DevInst->DevProp.DevMod[TileType].EvntMod[0U].PerfCntEventBase;
+		*Event = _XAie_GetDevMod(DevInst)[TileType].EvntMod[0U].PerfCntEventBase;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API allocates and reserves a partition wide broadcast network.
+*
+* @param	DevInst: Device Instance
+* @param	Net: Pointer to return the broadcast network
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_PerfCounterBcastSetup(XAie_DevInst *DevInst,
+		XAie_BcastNetwork **Net)
+{
+	AieRC RC;
+
+	*Net = (XAie_BcastNetwork *)calloc(1U, sizeof(**Net));
+	if(*Net == XAIE_NULL) {
+		XAIE_ERROR("Unable to allocate memory for broadcast network\n");
+		return XAIE_ERR;
+	}
+
+	RC = _XAie_EventBcastNetworkSetup(DevInst, *Net);
+	if(RC != XAIE_OK) {
+		free(*Net);
+		*Net = XAIE_NULL;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API releases and frees a broadcast network reserved by
+* _XAie_PerfCounterBcastSetup().
+*
+* @param	DevInst: Device Instance
+* @param	Net: Pointer to the broadcast network
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static void _XAie_PerfCounterBcastTeardown(XAie_DevInst *DevInst,
+		XAie_BcastNetwork **Net)
+{
+	if(*Net == XAIE_NULL) {
+		return;
+	}
+
+	_XAie_EventBcastNetworkTeardown(DevInst, *Net);
+	free(*Net);
+	*Net = XAIE_NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a module is reached by a partition wide broadcast network.
+*
+* @param	Net: Broadcast network
+* @param	Loc: Location of the tile
+* @param	Module: Module of the tile
+*
+* @return	XAIE_OK if the module is part of the network,
+*		XAIE_INVALID_ARGS otherwise.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_PerfCounterCheckBcastRsc(const XAie_BcastNetwork *Net,
+		XAie_LocType Loc, XAie_ModuleType Module)
+{
+	for(u32 i = 0; i < Net->NumRscs; i++) {
+		if((Net->Rscs[i].Loc.Col == Loc.Col) &&
+				(Net->Rscs[i].Loc.Row == Loc.Row) &&
+				(Net->Rscs[i].Mod == Module)) {
+			return XAIE_OK;
+		}
+	}
+
+	XAIE_ERROR("Tile(%d, %d) is not reachable by broadcast network\n",
+			Loc.Col, Loc.Row);
+	return XAIE_INVALID_ARGS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores the control configuration of the first NumCounters
+* counters of a snapshot.
+*
+* @param	DevInst: Device Instance
+* @param	Snapshot: Pointer to the snapshot
+* @param	NumCounters: Number of counters to restore
+*
+* @return	XAIE_OK on success, error code of the last failure otherwise.
+*
+* @note		Internal only. Restoring continues even if some of the
+*		counters fail.
+*
+******************************************************************************/
+static AieRC _XAie_PerfCounterSnapshotRestore(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot, u32 NumCounters)
+{
+	AieRC RC = XAIE_OK;
+
+	for(u32 i = 0; i < NumCounters; i++) {
+		XAie_PerfCounterSnapshotEntry *Entry = &Snapshot->Counters[i];
+		AieRC lRC;
+
+		lRC = XAie_PerfCounterControlSet(DevInst, Entry->Loc,
+				Entry->Module, Entry->Counter,
+				Entry->StartEvent, Entry->StopEvent);
+		if(lRC != XAIE_OK) {
+			XAIE_ERROR("Unable to restore counter %d of tile(%d, %d)\n",
+					Entry->Counter, Entry->Loc.Col,
+					Entry->Loc.Row);
+			RC = lRC;
+		}
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API arms a set of performance counters to be latched at the same
+* hardware cycle. A partition wide broadcast channel is reserved, the same way
+* XAie_SyncTimer() does, and the broadcast event of that channel is programmed
+* as the stop event of every counter in the snapshot. The start events of the
+* counters are preserved.
+*
+* @param	DevInst: Device Instance
+* @param	Snapshot: Pointer to the zero initialized snapshot. NumCounters
+*			  and Counters with Loc, Module and Counter of each
+*			  entry shall be populated by the caller.
+*
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		Error code from the resource manager if no broadcast channel
+*		is free.
+*
+* @note		Counters in occurrence mode, where the start and stop events
+*		are the same, cannot be latched and are rejected. Once
+*		triggered, the counters stay stopped until their start event
+*		occurs again or the snapshot is released.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterSnapshotArm(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot)
+{
+	AieRC RC;
+	XAie_Events Dummy, BcastEvent;
+
+	if((DevInst == XAIE_NULL) || (Snapshot == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Snapshot->NumCounters == 0U) || (Snapshot->Counters == XAIE_NULL)) {
+		XAIE_ERROR("Invalid snapshot counters\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Snapshot->IsArmed == XAIE_ENABLE) {
+		XAIE_ERROR("Snapshot is already armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	/* Save the current control configuration of the counters */
+	for(u32 i = 0; i < Snapshot->NumCounters; i++) {
+		XAie_PerfCounterSnapshotEntry *Entry = &Snapshot->Counters[i];
+
+		RC = XAie_PerfCounterGetControlConfig(DevInst, Entry->Loc,
+				Entry->Module, Entry->Counter,
+				&Entry->StartEvent, &Entry->StopEvent, &Dummy);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to read counter configuration\n");
+			return RC;
+		}
+
+		if(Entry->StartEvent == Entry->StopEvent) {
+			XAIE_ERROR("Counter %d of tile(%d, %d) is in occurrence mode\n",
+					Entry->Counter, Entry->Loc.Col,
+					Entry->Loc.Row);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	RC = _XAie_PerfCounterBcastSetup(DevInst, &Snapshot->BcastNet);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to setup broadcast for counter snapshot\n");
+		return RC;
 	}
 
+	for(u32 i = 0; i < Snapshot->NumCounters; i++) {
+		XAie_PerfCounterSnapshotEntry *Entry = &Snapshot->Counters[i];
+
+		RC = _XAie_PerfCounterCheckBcastRsc(Snapshot->BcastNet,
+				Entry->Loc, Entry->Module);
+		if(RC == XAIE_OK) {
+			BcastEvent = _XAie_EventGetBroadcastEvent(DevInst,
+					Entry->Loc, Entry->Module,
+					Snapshot->BcastNet->BcastChannelId);
+			RC = XAie_PerfCounterControlSet(DevInst, Entry->Loc,
+					Entry->Module, Entry->Counter,
+					Entry->StartEvent, BcastEvent);
+		}
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to arm counter snapshot\n");
+			_XAie_PerfCounterSnapshotRestore(DevInst, Snapshot, i);
+			_XAie_PerfCounterBcastTeardown(DevInst,
+					&Snapshot->BcastNet);
+			return RC;
+		}
+	}
+
+	Snapshot->IsArmed = XAIE_ENABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API latches all the counters of an armed snapshot by generating the
+* broadcast event from the shim tile of the first column.
+*
+* @param	DevInst: Device Instance
+* @param	Snapshot: Pointer to the armed snapshot
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterSnapshotTrigger(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot)
+{
+	if((DevInst == XAIE_NULL) || (Snapshot == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Snapshot->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or snapshot is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	return XAie_EventGenerate(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
+			Snapshot->BcastNet->ShimBcastEvent);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the latched value of all the counters of a snapshot into the
+* CounterVal field of each entry.
+*
+* @param	DevInst: Device Instance
+* @param	Snapshot: Pointer to the triggered snapshot
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The values are coherent only if no start event of the counters
+*		occurred between XAie_PerfCounterSnapshotTrigger() and this API.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterSnapshotRead(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Snapshot == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Snapshot->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or snapshot is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0; i < Snapshot->NumCounters; i++) {
+		XAie_PerfCounterSnapshotEntry *Entry = &Snapshot->Counters[i];
+
+		RC = XAie_PerfCounterGet(DevInst, Entry->Loc, Entry->Module,
+				Entry->Counter, &Entry->CounterVal);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API restores the stop events of the counters of a snapshot and releases
+* the broadcast channels reserved by XAie_PerfCounterSnapshotArm().
+*
+* @param	DevInst: Device Instance
+* @param	Snapshot: Pointer to the armed snapshot
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The broadcast network is released even if restoring a counter
+*		fails.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterSnapshotRelease(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Snapshot == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			(Snapshot->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or snapshot is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	RC = _XAie_PerfCounterSnapshotRestore(DevInst, Snapshot,
+			Snapshot->NumCounters);
+	_XAie_PerfCounterBcastTeardown(DevInst, &Snapshot->BcastNet);
+	Snapshot->IsArmed = XAIE_DISABLE;
+
 	return RC;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API blocks or unblocks the east/west propagation of the broadcast
+* channel of a core done group in the shim row, so that the done events of a
+* column are only counted by the shim tile of that column.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the core done group
+* @param	Block: XAIE_ENABLE to block, XAIE_DISABLE to unblock.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only.
+*
+******************************************************************************/
+static AieRC _XAie_CoreDoneGroupShimBlock(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group, u8 Block)
+{
+	AieRC RC = XAIE_OK;
+	u8 Dir = XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST;
+
+	for(u32 i = 0; i < DevInst->NumCols; i++) {
+		XAie_LocType Loc = XAie_TileLoc(i, 0);
+
+		for(u8 Sw = XAIE_EVENT_SWITCH_A; Sw <= XAIE_EVENT_SWITCH_B;
+				Sw++) {
+			if(Block == XAIE_ENABLE) {
+				RC |= XAie_EventBroadcastBlockDir(DevInst, Loc,
+					XAIE_PL_MOD, (XAie_BroadcastSw)Sw,
+					Group->BcastNet->BcastChannelId, Dir);
+			} else {
+				RC |= XAie_EventBroadcastUnblockDir(DevInst,
+					Loc, XAIE_PL_MOD, (XAie_BroadcastSw)Sw,
+					Group->BcastNet->BcastChannelId, Dir);
+			}
+		}
+	}
+
+	return (RC == XAIE_OK) ? XAIE_OK : XAIE_ERR;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the configuration of a core done group and releases its
+* resources.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the core done group
+*
+* @return	None.
+*
+* @note		Internal only. Clearing continues even if some of the register
+*		writes fail.
+*
+******************************************************************************/
+static void _XAie_CoreDoneGroupFree(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group)
+{
+	for(u32 i = 0; i < Group->NumCores; i++) {
+		XAie_EventBroadcastReset(DevInst, Group->Cores[i],
+				XAIE_CORE_MOD, Group->BcastNet->BcastChannelId);
+	}
+
+	_XAie_CoreDoneGroupShimBlock(DevInst, Group, XAIE_DISABLE);
+
+	for(u32 i = 0; i < Group->NumCols; i++) {
+		XAie_UserRsc *Rsc = &Group->Cols[i].CntRsc;
+
+		XAie_PerfCounterControlReset(DevInst, Rsc->Loc, XAIE_PL_MOD,
+				(u8)Rsc->RscId);
+		XAie_PerfCounterEventValueReset(DevInst, Rsc->Loc,
+				XAIE_PL_MOD, (u8)Rsc->RscId);
+		XAie_ReleasePerfcnt(DevInst, 1U, Rsc);
+	}
+
+	_XAie_PerfCounterBcastTeardown(DevInst, &Group->BcastNet);
+	free(Group->Cols);
+	Group->Cols = XAIE_NULL;
+	Group->NumCols = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API arms a group of cores so that their completion is counted by one
+* performance counter per column. A partition wide broadcast channel is
+* reserved, the same way XAie_SyncTimer() does, and every core of the group
+* broadcasts its disabled event, which occurs when the core executes its done
+* instruction, on that channel. The channel is blocked east and west in the
+* shim row, so the shim tile of each column observes the done events of the
+* cores of its own column only. A performance counter of the shim tile counts
+* these events, its event value is set to the number of cores of the column.
+*
+* Waiting for the group then polls one register per column instead of the
+* status register of every core. The group stays armed across iterations of
+* the graph, see XAie_CoreDoneGroupReset().
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the zero initialized group. NumCores and Cores
+*			shall be populated by the caller.
+*
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		XAIE_INVALID_TILE if a location is not an AIE tile
+*		Error code from the resource manager if no broadcast channel
+*		or shim counter is free.
+*
+* @note		Disabling a core of the group with XAie_CoreDisable() also
+*		counts as done.
+*
+******************************************************************************/
+AieRC XAie_CoreDoneGroupArm(XAie_DevInst *DevInst, XAie_CoreDoneGroup *Group)
+{
+	AieRC RC;
+	u32 Col;
+	XAie_Events BcastEvent;
+	XAie_UserRscReq Req;
+
+	if((DevInst == XAIE_NULL) || (Group == XAIE_NULL) ||
+			(Group->NumCores == 0U) || (Group->Cores == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Group->IsArmed == XAIE_ENABLE) {
+		XAIE_ERROR("Core done group is already armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0; i < Group->NumCores; i++) {
+		if(_XAie_DevGetTTypefromLoc(DevInst, Group->Cores[i]) !=
+				XAIEGBL_TILE_TYPE_AIETILE) {
+			XAIE_ERROR("Invalid Tile Type\n");
+			return XAIE_INVALID_TILE;
+		}
+	}
+
+	Group->Cols = (XAie_CoreDoneCol *)calloc(DevInst->NumCols,
+			sizeof(*Group->Cols));
+	if(Group->Cols == XAIE_NULL) {
+		XAIE_ERROR("Unable to allocate memory for columns\n");
+		return XAIE_ERR;
+	}
+
+	/* Columns are kept in the order of their first core */
+	Group->NumCols = 0U;
+	for(u32 i = 0; i < Group->NumCores; i++) {
+		for(Col = 0U; Col < Group->NumCols; Col++) {
+			if(Group->Cols[Col].CntRsc.Loc.Col ==
+					Group->Cores[i].Col) {
+				break;
+			}
+		}
+
+		if(Col == Group->NumCols) {
+			Group->Cols[Col].CntRsc.Loc =
+				XAie_TileLoc(Group->Cores[i].Col, 0U);
+			Group->NumCols++;
+		}
+		Group->Cols[Col].NumCores++;
+	}
+
+	for(Col = 0U; Col < Group->NumCols; Col++) {
+		Req.Loc = Group->Cols[Col].CntRsc.Loc;
+		Req.Mod = XAIE_PL_MOD;
+		Req.NumRscPerTile = 1U;
+		RC = XAie_RequestPerfcnt(DevInst, 1U, &Req, 1U,
+				&Group->Cols[Col].CntRsc);
+		if(RC != XAIE_OK) {
+			XAIE_ERROR("Unable to reserve shim counter\n");
+			for(u32 i = 0; i < Col; i++) {
+				XAie_ReleasePerfcnt(DevInst, 1U,
+						&Group->Cols[i].CntRsc);
+			}
+			free(Group->Cols);
+			Group->Cols = XAIE_NULL;
+			return RC;
+		}
+	}
+
+	RC = _XAie_PerfCounterBcastSetup(DevInst, &Group->BcastNet);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to setup broadcast for core done group\n");
+		for(Col = 0U; Col < Group->NumCols; Col++) {
+			XAie_ReleasePerfcnt(DevInst, 1U,
+					&Group->Cols[Col].CntRsc);
+		}
+		free(Group->Cols);
+		Group->Cols = XAIE_NULL;
+		return RC;
+	}
+
+	for(u32 i = 0; (RC == XAIE_OK) && (i < Group->NumCores); i++) {
+		RC = _XAie_PerfCounterCheckBcastRsc(Group->BcastNet,
+				Group->Cores[i], XAIE_CORE_MOD);
+	}
+	for(Col = 0U; (RC == XAIE_OK) && (Col < Group->NumCols); Col++) {
+		RC = _XAie_PerfCounterCheckBcastRsc(Group->BcastNet,
+				Group->Cols[Col].CntRsc.Loc, XAIE_PL_MOD);
+	}
+
+	if(RC == XAIE_OK) {
+		RC = _XAie_CoreDoneGroupShimBlock(DevInst, Group, XAIE_ENABLE);
+	}
+
+	for(u32 i = 0; (RC == XAIE_OK) && (i < Group->NumCores); i++) {
+		RC = XAie_EventBroadcast(DevInst, Group->Cores[i],
+				XAIE_CORE_MOD, Group->BcastNet->BcastChannelId,
+				XAIE_EVENT_DISABLED_CORE);
+	}
+
+	for(Col = 0U; (RC == XAIE_OK) && (Col < Group->NumCols); Col++) {
+		XAie_CoreDoneCol *C = &Group->Cols[Col];
+
+		BcastEvent = _XAie_EventGetBroadcastEvent(DevInst,
+				C->CntRsc.Loc, XAIE_PL_MOD,
+				Group->BcastNet->BcastChannelId);
+		/* Same start and stop event counts the occurrences */
+		RC = XAie_PerfCounterControlSet(DevInst, C->CntRsc.Loc,
+				XAIE_PL_MOD, (u8)C->CntRsc.RscId, BcastEvent,
+				BcastEvent);
+		if(RC == XAIE_OK) {
+			RC = XAie_PerfCounterEventValueSet(DevInst,
+					C->CntRsc.Loc, XAIE_PL_MOD,
+					(u8)C->CntRsc.RscId, C->NumCores);
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to arm core done group\n");
+		_XAie_CoreDoneGroupFree(DevInst, Group);
+		return RC;
+	}
+
+	Group->IsArmed = XAIE_ENABLE;
+
+	return XAie_CoreDoneGroupReset(DevInst, Group);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the shim counters of a core done group. It shall be called
+* before the cores of the group are started for a new iteration.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the armed group
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_CoreDoneGroupReset(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group)
+{
+	AieRC RC;
+
+	if((DevInst == XAIE_NULL) || (Group == XAIE_NULL) ||
+			(Group->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or group is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0; i < Group->NumCols; i++) {
+		XAie_CoreDoneCol *C = &Group->Cols[i];
+
+		RC = XAie_PerfCounterSet(DevInst, C->CntRsc.Loc, XAIE_PL_MOD,
+				(u8)C->CntRsc.RscId, 0U);
+		if(RC != XAIE_OK) {
+			return RC;
+		}
+
+		C->Count = 0U;
+		C->StaleUs = 0U;
+		C->IsDone = 0U;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks the done bits of the cores of a column.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the armed group
+* @param	C: Column to check
+*
+* @return	1 if all the cores of the column are done, 0 otherwise.
+*
+* @note		Internal only. Done events of cores which complete in the same
+*		cycle are merged on the broadcast channel and counted once, so
+*		a counter that stops short of the number of cores is confirmed
+*		from the core status.
+*
+******************************************************************************/
+static u8 _XAie_CoreDoneGroupConfirm(XAie_DevInst *DevInst,
+		const XAie_CoreDoneGroup *Group, const XAie_CoreDoneCol *C)
+{
+#ifdef XAIE_FEATURE_CORE_ENABLE
+	u8 DoneBit;
+
+	for(u32 i = 0; i < Group->NumCores; i++) {
+		if(Group->Cores[i].Col != C->CntRsc.Loc.Col) {
+			continue;
+		}
+
+		if((XAie_CoreReadDoneBit(DevInst, Group->Cores[i],
+					&DoneBit) != XAIE_OK) ||
+				(DoneBit == 0U)) {
+			return 0U;
+		}
+	}
+
+	return 1U;
+#else
+	(void)DevInst;
+	(void)Group;
+	(void)C;
+
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API waits until all the cores of a core done group are done. The shim
+* counter of every pending column is read once per sweep. If columns are still
+* pending after a sweep, the counter of the first one is polled with a timeout
+* of at most XAIE_CORE_DONE_POLL_US, which lets the backend wait before the
+* next sweep.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the armed group
+* @param	TimeOut: Timeout shared by all the columns in usecs. If 0, the
+*		counters are read once.
+*
+* @return	XAIE_OK if all the cores are done, XAIE_CORE_STATUS_TIMEOUT if
+*		some are not done in time, else error code.
+*
+* @note		The done state of the columns is kept in the group, so a timed
+*		out wait can be resumed until the group is reset.
+*
+******************************************************************************/
+AieRC XAie_CoreDoneGroupWait(XAie_DevInst *DevInst, XAie_CoreDoneGroup *Group,
+		u32 TimeOut)
+{
+	AieRC RC;
+	u8 TileType;
+	u32 Count, Slice, Pending;
+	u64 RegAddr;
+	const XAie_PerfMod *PerfMod;
+	XAie_CoreDoneCol *First;
+
+	if((DevInst == XAIE_NULL) || (Group == XAIE_NULL) ||
+			(Group->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or group is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	while(1) {
+		Pending = 0U;
+		First = XAIE_NULL;
+		Slice = (TimeOut < XAIE_CORE_DONE_POLL_US) ? TimeOut :
+			XAIE_CORE_DONE_POLL_US;
+
+		for(u32 i = 0; i < Group->NumCols; i++) {
+			XAie_CoreDoneCol *C = &Group->Cols[i];
+
+			if(C->IsDone) {
+				continue;
+			}
+
+			RC = XAie_PerfCounterGet(DevInst, C->CntRsc.Loc,
+					XAIE_PL_MOD, (u8)C->CntRsc.RscId,
+					&Count);
+			if(RC != XAIE_OK) {
+				return RC;
+			}
+
+			if(Count != C->Count) {
+				C->Count = Count;
+				C->StaleUs = 0U;
+			}
+
+			if((Count >= C->NumCores) ||
+					((C->StaleUs >= XAIE_CORE_DONE_CONFIRM_US) &&
+					 _XAie_CoreDoneGroupConfirm(DevInst,
+						 Group, C))) {
+				C->IsDone = 1U;
+				continue;
+			}
+
+			if(C->StaleUs >= XAIE_CORE_DONE_CONFIRM_US) {
+				C->StaleUs = 0U;
+			}
+			C->StaleUs += Slice;
+			Pending++;
+			if(First == XAIE_NULL) {
+				First = C;
+			}
+		}
+
+		if(Pending == 0U) {
+			return XAIE_OK;
+		}
+
+		if(TimeOut == 0U) {
+			return XAIE_CORE_STATUS_TIMEOUT;
+		}
+		TimeOut -= Slice;
+
+		TileType = _XAie_DevGetTTypefromLoc(DevInst,
+				First->CntRsc.Loc);
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
+		RegAddr = _XAie_GetTileAddr(DevInst, First->CntRsc.Loc.Row,
+				First->CntRsc.Loc.Col) +
+			PerfMod->PerfCounterBaseAddr +
+			First->CntRsc.RscId * PerfMod->PerfCounterOffsetAdd;
+		XAie_MaskPoll(DevInst, RegAddr, 0xFFFFFFFFU, First->NumCores,
+				Slice);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the broadcast and counter configuration of a core done group
+* and releases its broadcast channels and shim counters.
+*
+* @param	DevInst: Device Instance
+* @param	Group: Pointer to the armed group
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_CoreDoneGroupRelease(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group)
+{
+	if((DevInst == XAIE_NULL) || (Group == XAIE_NULL) ||
+			(Group->IsArmed != XAIE_ENABLE)) {
+		XAIE_ERROR("Invalid arguments or group is not armed\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	_XAie_CoreDoneGroupFree(DevInst, Group);
+	Group->IsArmed = XAIE_DISABLE;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes a performance counter handle. The tile, the module and
+* the counter are validated once and the absolute address of the counter
+* register is cached in the handle, so that XAie_PerfCounterHandleGet() and
+* XAie_PerfCounterHandleSet() only access the register.
+*
+* @param	DevInst: Device Instance
+* @param	Handle: Performance counter handle to initialize.
+* @param	Loc: Location of the tile
+* @param	Module: Module of tile.
+*			For AIE Tile - XAIE_MEM_MOD or XAIE_CORE_MOD,
+*			For Pl or Shim tile - XAIE_PL_MOD,
+*			For Mem tile - XAIE_MEM_MOD.
+* @param	Counter: Performance Counter
+*
+* @return	XAIE_OK on success
+*		XAIE_INVALID_ARGS if any argument is invalid
+*		XAIE_INVALID_TILE if tile type from Loc is invalid
+*
+* @note		The handle stays valid as long as the device instance does.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterHandleInit(XAie_DevInst *DevInst,
+		XAie_PerfCounterHandle *Handle, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 Counter)
+{
+	u8 TileType;
+	AieRC RC;
+	const XAie_PerfMod *PerfMod;
+
+	if((DevInst == XAIE_NULL) || (Handle == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance or Handle\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		XAIE_ERROR("Invalid Tile Type\n");
+		return XAIE_INVALID_TILE;
+	}
+
+	RC = _XAie_CheckModule(DevInst, Loc, Module);
+	if(RC != XAIE_OK) {
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Module == XAIE_PL_MOD) {
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
+	} else {
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Module];
+	}
+
+	if(Counter >= PerfMod->MaxCounterVal) {
+		XAIE_ERROR("Invalid Counter number: %d\n", Counter);
+		return XAIE_INVALID_ARGS;
+	}
+
+	Handle->DevInst = DevInst;
+	Handle->CounterRegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
+		PerfMod->PerfCounterBaseAddr +
+		(Counter * PerfMod->PerfCounterOffsetAdd);
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the counter of a performance counter handle.
+*
+* @param	Handle: Performance counter handle initialized with
+*		XAie_PerfCounterHandleInit().
+* @param	CounterVal: Pointer to store the counter value.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterHandleGet(const XAie_PerfCounterHandle *Handle,
+		u32 *CounterVal)
+{
+	return XAie_Read32(Handle->DevInst, Handle->CounterRegAddr, CounterVal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the counter of a performance counter handle.
+*
+* @param	Handle: Performance counter handle initialized with
+*		XAie_PerfCounterHandleInit().
+* @param	CounterVal: Counter value to write.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		None.
+*
+******************************************************************************/
+AieRC XAie_PerfCounterHandleSet(const XAie_PerfCounterHandle *Handle,
+		u32 CounterVal)
+{
+	return XAie_Write32(Handle->DevInst, Handle->CounterRegAddr,
+			CounterVal);
+}
+
 #endif /* XAIE_FEATURE_PERFCOUNT_ENABLE */
@@ -30,6 +30,81 @@
 #include "xaiegbl_defs.h"
 #include "xaiegbl_defs.h"
 
+/***************************** Macro Definitions *****************************/
+/* Longest wait between two sweeps of XAie_CoreDoneGroupWait() */
+#define XAIE_CORE_DONE_POLL_US		200U
+/*
+ * Time after which a column whose counter did not reach its number of cores is
+ * confirmed from the done bits of its cores.
+ */
+#define XAIE_CORE_DONE_CONFIRM_US	1000U
+
+/**************************** Type Definitions *******************************/
+/* Broadcast network reserved while a snapshot or a group is armed */
+struct XAie_BcastNetwork;
+
+/*
+ * This structure captures a performance counter that is part of a snapshot.
+ * Loc, Module and Counter are provided by the user, CounterVal is populated by
+ * XAie_PerfCounterSnapshotRead(). The remaining fields are internal.
+ */
+typedef struct {
+	XAie_LocType Loc;		/* Location of the tile */
+	XAie_ModuleType Module;		/* Module of the counter */
+	u8 Counter;			/* Performance counter number */
+	u32 CounterVal;			/* Latched counter value */
+	XAie_Events StartEvent;		/* Start event before arming */
+	XAie_Events StopEvent;		/* Stop event before arming */
+} XAie_PerfCounterSnapshotEntry;
+
+/*
+ * This structure captures a set of performance counters which are latched by
+ * a single partition wide broadcast event.
+ */
+typedef struct {
+	u32 NumCounters;			/* Number of counters */
+	XAie_PerfCounterSnapshotEntry *Counters;/* Array of counters */
+	struct XAie_BcastNetwork *BcastNet;	/* Internal broadcast network */
+	u8 IsArmed;				/* Snapshot armed status */
+} XAie_PerfCounterSnapshot;
+
+/*
+ * This structure captures a column of a core done group. The done events of
+ * the cores of the group in the column are counted by a performance counter
+ * of the shim tile of the column.
+ */
+typedef struct {
+	XAie_UserRsc CntRsc;		/* Counter of the shim tile */
+	u32 NumCores;			/* Cores of the group in the column */
+	u32 Count;			/* Last counter value read */
+	u32 StaleUs;			/* Time the counter did not change */
+	u8 IsDone;			/* All cores of the column are done */
+} XAie_CoreDoneCol;
+
+/*
+ * This structure captures a group of cores whose completion is detected from
+ * one counter per column instead of the status of every core. NumCores and
+ * Cores are provided by the user, Cores shall remain valid until the group is
+ * released. The remaining fields are internal.
+ */
+typedef struct {
+	u32 NumCores;				/* Number of cores */
+	const XAie_LocType *Cores;		/* Array of AIE tiles */
+	u32 NumCols;				/* Number of columns */
+	XAie_CoreDoneCol *Cols;			/* Array of columns */
+	struct XAie_BcastNetwork *BcastNet;	/* Internal broadcast network */
+	u8 IsArmed;				/* Group armed status */
+} XAie_CoreDoneGroup;
+
+/*
+ * Performance counter handle with the absolute address of the counter
+ * register. Initialized with XAie_PerfCounterHandleInit().
+ */
+typedef struct {
+	XAie_DevInst *DevInst;
+	u64 CounterRegAddr;
+} XAie_PerfCounterHandle;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_PerfCounterGet(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, u8 Counter, u32 *CounterVal);
@@ -55,4 +130,26 @@ AieRC XAie_PerfCounterGetControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_Events *StopEvent, XAie_Events *ResetEvent);
 AieRC XAie_PerfCounterGetEventBase(XAie_DevInst *DevInst, XAie_LocType Loc,
 		XAie_ModuleType Module, XAie_Events *Event);
+AieRC XAie_PerfCounterSnapshotArm(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot);
+AieRC XAie_PerfCounterSnapshotTrigger(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot);
+AieRC XAie_PerfCounterSnapshotRead(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot);
+AieRC XAie_PerfCounterSnapshotRelease(XAie_DevInst *DevInst,
+		XAie_PerfCounterSnapshot *Snapshot);
+AieRC XAie_CoreDoneGroupArm(XAie_DevInst *DevInst, XAie_CoreDoneGroup *Group);
+AieRC XAie_CoreDoneGroupReset(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group);
+AieRC XAie_CoreDoneGroupWait(XAie_DevInst *DevInst, XAie_CoreDoneGroup *Group,
+		u32 TimeOut);
+AieRC XAie_CoreDoneGroupRelease(XAie_DevInst *DevInst,
+		XAie_CoreDoneGroup *Group);
+AieRC XAie_PerfCounterHandleInit(XAie_DevInst *DevInst,
+		XAie_PerfCounterHandle *Handle, XAie_LocType Loc,
+		XAie_ModuleType Module, u8 Counter);
+AieRC XAie_PerfCounterHandleGet(const XAie_PerfCounterHandle *Handle,
+		u32 *CounterVal);
+AieRC XAie_PerfCounterHandleSet(const XAie_PerfCounterHandle *Handle,
+		u32 CounterVal);
 #endif		/* end of protection macro */
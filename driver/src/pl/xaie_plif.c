@@ -77,14 +77,14 @@ static AieRC _XAie_PlIfBliBypassConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 
 	/*
 	 * Ports 3 and 7 BLI Bypass is enabled in the hardware by default.
@@ -143,14 +143,14 @@ static AieRC _XAie_PlIfDownSzrPortEnableReg(XAie_DevInst *DevInst,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 	if((PortNum > PlIfMod->NumDownSzrPorts)) {
 		XAIE_ERROR("Invalid Port Number\n");
 		return XAIE_ERR_STREAM_PORT;
@@ -205,7 +205,7 @@ static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -219,7 +219,7 @@ static AieRC _XAie_AieToPlIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_PLIF_WIDTH;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 
 	/* Setup field mask and field value for aie to pl interface */
 	if(PortNum >= PlIfMod->NumDownSzrPorts) {
@@ -304,7 +304,7 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if((TileType != XAIEGBL_TILE_TYPE_SHIMNOC) &&
 			(TileType != XAIEGBL_TILE_TYPE_SHIMPL)) {
 		XAIE_ERROR("Invalid Tile Type\n");
@@ -318,7 +318,7 @@ static AieRC _XAie_PlToAieIntfConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_PLIF_WIDTH;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 
 	/* Setup field mask and field value for pl to aie interface */
 	if(PortNum >= PlIfMod->NumDownSzrPorts) {
@@ -609,7 +609,7 @@ static AieRC _XAie_ConfigShimNocMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -630,7 +630,7 @@ static AieRC _XAie_ConfigShimNocMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		PortNum -= 2U;
 	}
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 
 	FldVal = InputConnectionType << PlIfMod->ShimNocMux[PortNum].Lsb;
 	FldMask = PlIfMod->ShimNocMux[PortNum].Mask;
@@ -675,7 +675,7 @@ static AieRC _XAie_ConfigShimNocDeMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -692,7 +692,7 @@ static AieRC _XAie_ConfigShimNocDeMux(XAie_DevInst *DevInst, XAie_LocType Loc,
 	/* Map the port numbers to 0, 1, 2, 3 */
 	PortNum -= 2U;
 
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 
 	FldVal = OutputConnectionType << PlIfMod->ShimNocDeMux[PortNum].Lsb;
 	FldMask = PlIfMod->ShimNocDeMux[PortNum].Mask;
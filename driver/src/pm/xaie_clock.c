@@ -22,6 +22,13 @@
 *
 ******************************************************************************/
 /***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
 #include "xaie_clock.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
@@ -30,7 +37,21 @@
 
 /*****************************************************************************/
 /***************************** Macro Definitions *****************************/
+/****************************** Type Definitions *****************************/
+/* State of the lazy tile power up, see XAie_PmConfigLazyTiles() */
+struct XAie_PmLazy {
+	u32 *Accessed;	/* Tiles accessed since the last idle query */
+#ifdef __linux__
+	pthread_mutex_t Lock;	/* Serializes the tile requests */
+#endif
+};
+
 /************************** Function Definitions *****************************/
+static inline u32 _XAie_PmLazyNumWords(XAie_DevInst *DevInst)
+{
+	return (DevInst->NumCols * (DevInst->NumRows - 1U) + 31U) / 32U;
+}
+
 /*****************************************************************************/
 /**
 * This API enables clock for all the tiles passed as argument to this API.
@@ -84,6 +105,274 @@ AieRC XAie_PmRequestTiles(XAie_DevInst *DevInst, XAie_LocType *Loc,
 			(void *)&TilesArray);
 }
 
+/*****************************************************************************/
+/**
+* This API gates the clock of the tiles passed as argument to this API.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of AIE tiles. NULL to release all the tiles.
+* @param	NumTiles: Number of tiles to release.
+*
+* @return	XAIE_OK on success.
+*
+* @note		The clock of a tile is controlled from the tile below it for
+*		AIE, and from the shim tile of the column for AIE-ML. A tile is
+*		therefore gated only when no tile of its column segment is in
+*		use anymore, the tiles which remain ungated stay marked in use.
+*		The tiles must not be accessed after they are released, unless
+*		they are requested again or the lazy tile power up is enabled.
+*
+*******************************************************************************/
+AieRC XAie_PmReleaseTiles(XAie_DevInst *DevInst, XAie_LocType *Loc,
+		u32 NumTiles)
+{
+	XAie_BackendTilesArray TilesArray;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(NumTiles > (DevInst->NumRows * DevInst->NumCols)) {
+		XAIE_ERROR("Invalid NumTiles\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if (NumTiles != 0 && Loc == NULL) {
+		XAIE_ERROR("NumTiles is not 0, but Location array is empty.\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 j = 0; j < NumTiles; j++) {
+		if(Loc[j].Row >= DevInst->NumRows ||
+			Loc[j].Col >= DevInst->NumCols) {
+			XAIE_ERROR("Invalid Loc Col:%d Row:%d\n", Loc[j].Col,
+					Loc[j].Row);
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	TilesArray.NumTiles = NumTiles;
+	TilesArray.Locs = Loc;
+
+	return XAie_RunOp(DevInst, XAIE_BACKEND_OP_RELEASE_TILES,
+			(void *)&TilesArray);
+}
+
+/*****************************************************************************/
+/**
+* This API enables or disables the lazy tile power up of the device instance.
+* When enabled, the driver ungates a tile which is not in use the first time
+* an IO operation targets the tile, instead of failing or accessing a gated
+* tile. The whole column segment up to the tile is ungated by one request,
+* so the following accesses to the segment do not request tiles again.
+*
+* The driver also records the tiles accessed by the IO operations, see
+* XAie_PmGetIdleTiles().
+*
+* @param	DevInst: Device Instance
+* @param	Enable: XAIE_ENABLE to enable, XAIE_DISABLE to disable.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The tiles can still be requested up front with
+*		XAie_PmRequestTiles(), e.g. to ungate the tiles of a multi-tile
+*		operation with a single request. A tile can not be ungated
+*		within a transaction without auto flush which already has
+*		commands, such tiles shall be requested up front. The lazy
+*		tile power up shall not be enabled or disabled while other
+*		threads issue IO operations.
+*
+*******************************************************************************/
+AieRC XAie_PmConfigLazyTiles(XAie_DevInst *DevInst, u8 Enable)
+{
+	struct XAie_PmLazy *Lazy;
+
+	if((DevInst == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid Device Instance\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if(Enable == XAIE_DISABLE) {
+		_XAie_PmLazyFree(DevInst);
+		return XAIE_OK;
+	}
+
+	if(DevInst->PmLazy != NULL) {
+		return XAIE_OK;
+	}
+
+	Lazy = (struct XAie_PmLazy *)malloc(sizeof(*Lazy));
+	if(Lazy == NULL) {
+		XAIE_ERROR("Memory allocation for lazy power up failed\n");
+		return XAIE_ERR;
+	}
+
+	Lazy->Accessed = (u32 *)calloc(_XAie_PmLazyNumWords(DevInst),
+			sizeof(u32));
+	if(Lazy->Accessed == NULL) {
+		XAIE_ERROR("Memory allocation for lazy power up failed\n");
+		free(Lazy);
+		return XAIE_ERR;
+	}
+
+#ifdef __linux__
+	pthread_mutex_init(&Lazy->Lock, NULL);
+#endif
+	DevInst->PmLazy = Lazy;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API returns the tiles which are in use but were not accessed by any IO
+* operation since the lazy tile power up was enabled or since the previous
+* call to this API. A new observation window starts for all the tiles.
+*
+* @param	DevInst: Device Instance
+* @param	Locs: Array to return the locations of the idle tiles.
+* @param	NumTiles: Size of the Locs array as input, number of idle
+*			tiles returned as output.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		The lazy tile power up shall be enabled. If there are more
+*		idle tiles than the size of the array, the first ones are
+*		returned. The idle tiles can be gated with
+*		XAie_PmReleaseTiles().
+*
+*******************************************************************************/
+AieRC XAie_PmGetIdleTiles(XAie_DevInst *DevInst, XAie_LocType *Locs,
+		u32 *NumTiles)
+{
+	struct XAie_PmLazy *Lazy;
+	u32 Num = 0U;
+
+	if((DevInst == XAIE_NULL) || (Locs == XAIE_NULL) ||
+		(NumTiles == XAIE_NULL) ||
+		(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	Lazy = DevInst->PmLazy;
+	if(Lazy == NULL) {
+		XAIE_ERROR("Lazy tile power up is not enabled\n");
+		return XAIE_ERR;
+	}
+
+	/*
+	 * Each word is read and cleared at once, an access recorded
+	 * concurrently falls either in this window or in the next one.
+	 */
+	for(u32 i = 0U; i < _XAie_PmLazyNumWords(DevInst); i++) {
+		u32 Accessed = __atomic_exchange_n(&Lazy->Accessed[i], 0U,
+				__ATOMIC_RELAXED);
+
+		for(u32 Bit = i * 32U; (Bit < (i + 1U) * 32U) &&
+				(Bit < DevInst->NumCols *
+				 (DevInst->NumRows - 1U)); Bit++) {
+			if((Num < *NumTiles) &&
+				CheckBit(DevInst->DevOps->TilesInUse, Bit) &&
+				!(Accessed & (1U << (Bit % 32U)))) {
+				Locs[Num++] = XAie_TileLoc(
+					(u8)(Bit / (DevInst->NumRows - 1U)),
+					(u8)(Bit % (DevInst->NumRows - 1U) +
+						1U));
+			}
+		}
+	}
+
+	*NumTiles = Num;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API records the access to the tile of a register offset and requests
+* the tile if it is not in use yet.
+*
+* @param	DevInst: Device Instance
+* @param	RegOff: Register offset accessed
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		Internal only. Called by the IO operations when the lazy tile
+*		power up is enabled. Threads which access the same tile
+*		first request it once, the others wait for the request.
+*
+*******************************************************************************/
+AieRC _XAie_PmLazyUngate(XAie_DevInst *DevInst, u64 RegOff)
+{
+	AieRC RC = XAIE_OK;
+	XAie_LocType Loc;
+	struct XAie_PmLazy *Lazy = DevInst->PmLazy;
+	u32 Bit, Col, Row;
+	u8 RowBits;
+
+	RowBits = DevInst->DevProp.ColShift - DevInst->DevProp.RowShift;
+	Col = (u32)(RegOff >> DevInst->DevProp.ColShift) & 0xFFU;
+	Row = (u32)(RegOff >> DevInst->DevProp.RowShift) &
+		((1U << RowBits) - 1U);
+	if((Row == 0U) || (Row >= DevInst->NumRows) ||
+			(Col >= DevInst->NumCols)) {
+		return XAIE_OK;
+	}
+
+	/* Same bit position as _XAie_GetTileBitPosFromLoc() */
+	Bit = Col * (DevInst->NumRows - 1U) + Row - 1U;
+	if(!(__atomic_load_n(&Lazy->Accessed[Bit / 32U], __ATOMIC_RELAXED) &
+				(1U << (Bit % 32U)))) {
+		__atomic_fetch_or(&Lazy->Accessed[Bit / 32U],
+				1U << (Bit % 32U), __ATOMIC_RELAXED);
+	}
+	if(CheckBit(DevInst->DevOps->TilesInUse, Bit)) {
+		return XAIE_OK;
+	}
+
+#ifdef __linux__
+	pthread_mutex_lock(&Lazy->Lock);
+#endif
+	if(!CheckBit(DevInst->DevOps->TilesInUse, Bit)) {
+		Loc = XAie_TileLoc((u8)Col, (u8)Row);
+		RC = XAie_PmRequestTiles(DevInst, &Loc, 1U);
+	}
+#ifdef __linux__
+	pthread_mutex_unlock(&Lazy->Lock);
+#endif
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+* This API frees the lazy tile power up state of the device instance.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_PmLazyFree(XAie_DevInst *DevInst)
+{
+	if(DevInst->PmLazy == NULL) {
+		return;
+	}
+
+#ifdef __linux__
+	pthread_mutex_destroy(&DevInst->PmLazy->Lock);
+#endif
+	free(DevInst->PmLazy->Accessed);
+	free(DevInst->PmLazy);
+	DevInst->PmLazy = NULL;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -125,5 +414,17 @@ u8 _XAie_PmIsTileRequested(XAie_DevInst *DevInst, XAie_LocType Loc)
 	return XAIE_DISABLE;
 }
 
+#else /* XAIE_FEATURE_PRIVILEGED_ENABLE */
+AieRC _XAie_PmLazyUngate(XAie_DevInst *DevInst, u64 RegOff)
+{
+	(void)DevInst;
+	(void)RegOff;
+	return XAIE_OK;
+}
+
+void _XAie_PmLazyFree(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
 #endif /* XAIE_FEATURE_PRIVILEGED_ENABLE */
 /** @} */
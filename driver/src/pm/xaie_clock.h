@@ -33,4 +33,9 @@ AieRC _XAie_PmSetPartitionClock(XAie_DevInst *DevInst, u8 Enable);
 AieRC XAie_PmRequestTiles(XAie_DevInst *DevInst, XAie_LocType *Loc,
 		u32 NumTiles);
 u8 _XAie_PmIsTileRequested(XAie_DevInst *DevInst, XAie_LocType Loc);
+AieRC XAie_PmReleaseTiles(XAie_DevInst *DevInst, XAie_LocType *Loc,
+		u32 NumTiles);
+AieRC XAie_PmConfigLazyTiles(XAie_DevInst *DevInst, u8 Enable);
+AieRC XAie_PmGetIdleTiles(XAie_DevInst *DevInst, XAie_LocType *Locs,
+		u32 *NumTiles);
 #endif		/* end of protection macro */
@@ -14,10 +14,12 @@
 ******************************************************************************/
 /***************************** Include Files *********************************/
 #include "xaie_clock.h"
+#include "xaie_dma.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_npi.h"
 #include "xaie_reset.h"
+#include "xaie_ss.h"
 #include "xaiegbl.h"
 
 #ifdef XAIE_FEATURE_PRIVILEGED_ENABLE
@@ -49,8 +51,8 @@ static void  _XAie_RstSetColumnReset(XAie_DevInst *DevInst,
 	u64 RegAddr;
 	const XAie_PlIfMod *PlIfMod;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 	RegAddr = PlIfMod->ColRstOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 	FldVal = XAie_SetField(RstEnable,
@@ -110,8 +112,8 @@ static void _XAie_RstSetBlockShimNocAxiMmNsuErr(XAie_DevInst *DevInst,
 	const XAie_PlIfMod *PlIfMod;
 	const XAie_ShimNocAxiMMConfig *ShimNocAxiMM;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	PlIfMod = DevInst->DevProp.DevMod[TileType].PlIfMod;
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	PlIfMod = _XAie_GetDevMod(DevInst)[TileType].PlIfMod;
 	ShimNocAxiMM = PlIfMod->ShimNocAxiMM;
 	RegAddr = ShimNocAxiMM->RegOff +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
@@ -157,7 +159,7 @@ static void  _XAie_RstSetBlockAllShimsNocAxiMmNsuErr(XAie_DevInst *DevInst,
 		XAie_LocType Loc = XAie_TileLoc(C, 0);
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		if (TileType != XAIEGBL_TILE_TYPE_SHIMNOC) {
 			continue;
 		}
@@ -188,8 +190,8 @@ static AieRC _XAie_RstAllShims(XAie_DevInst *DevInst)
 	const XAie_ShimRstMod *ShimTileRst;
 	XAie_LocType Loc = XAie_TileLoc(0, 0);
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	ShimTileRst = DevInst->DevProp.DevMod[TileType].PlIfMod->ShimTileRst;
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	ShimTileRst = _XAie_GetDevMod(DevInst)[TileType].PlIfMod->ShimTileRst;
 
 	return ShimTileRst->RstShims(DevInst, 0, DevInst->NumCols);
 }
@@ -269,8 +271,8 @@ static void _XAie_ClearDataMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 	u64 RegAddr;
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-	MemMod = DevInst->DevProp.DevMod[TileType].MemMod;
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	MemMod = _XAie_GetDevMod(DevInst)[TileType].MemMod;
 	RegAddr = MemMod->MemAddr +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 	XAie_BlockSet32(DevInst, RegAddr, 0, MemMod->Size / 4);
@@ -292,12 +294,224 @@ static void _XAie_ClearProgMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 	const XAie_CoreMod *CoreMod;
 	u64 RegAddr;
 
-	CoreMod = DevInst->DevProp.DevMod[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
+	CoreMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].CoreMod;
 	RegAddr = CoreMod->ProgMemHostOffset +
 		_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col);
 	XAie_BlockSet32(DevInst, RegAddr, 0, CoreMod->ProgMemSize / 4);
 }
 
+#if defined(XAIE_FEATURE_DMA_ENABLE) && defined(XAIE_FEATURE_SS_ENABLE)
+/*****************************************************************************/
+/**
+*
+* This API checks if the data memory of a tile is zeroized by
+* _XAie_RstDmaZeroDataMems().
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+*
+* @return	XAIE_ENABLE if the tile is zeroized with its DMA.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static u8 _XAie_RstIsDmaZeroTile(XAie_DevInst *DevInst, XAie_LocType Loc)
+{
+	if(_XAie_DevGetTTypefromLoc(DevInst, Loc) !=
+			XAIEGBL_TILE_TYPE_AIETILE) {
+		return XAIE_DISABLE;
+	}
+
+	return XAIE_ENABLE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts the zeroization of the data memory of an AIE tile with its
+* own DMA. The first 1/NumBds of the memory is cleared over AXI-MM. The other
+* BDs of MM2S channel 0 are chained to stream this zero buffer to S2MM channel
+* 0, which writes the rest of the memory with a single BD.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static AieRC _XAie_RstDmaZeroDataMemStart(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	AieRC RC;
+	u32 Chunk;
+	u8 SrcBds;
+	XAie_DmaDesc Desc;
+	const XAie_MemMod *MemMod;
+	const XAie_DmaMod *DmaMod;
+
+	MemMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].MemMod;
+	DmaMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].DmaMod;
+	SrcBds = DmaMod->NumBds - 1U;
+	Chunk = MemMod->Size / DmaMod->NumBds;
+
+	RC = XAie_BlockSet32(DevInst, MemMod->MemAddr +
+			_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col), 0U,
+			Chunk / 4U);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u8 Bd = 0U; Bd < SrcBds; Bd++) {
+		RC = XAie_DmaDescInit(DevInst, &Desc, Loc);
+		RC |= XAie_DmaSetAddrLen(&Desc, 0U, Chunk);
+		RC |= XAie_DmaSetNextBd(&Desc, (Bd + 1U) % SrcBds,
+				(Bd + 1U < SrcBds) ? XAIE_ENABLE : XAIE_DISABLE);
+		RC |= XAie_DmaEnableBd(&Desc);
+		RC |= XAie_DmaWriteBd(DevInst, &Desc, Loc, Bd);
+		if(RC != XAIE_OK) {
+			return XAIE_ERR;
+		}
+	}
+
+	RC = XAie_DmaDescInit(DevInst, &Desc, Loc);
+	RC |= XAie_DmaSetAddrLen(&Desc, Chunk, MemMod->Size - Chunk);
+	RC |= XAie_DmaEnableBd(&Desc);
+	RC |= XAie_DmaWriteBd(DevInst, &Desc, Loc, SrcBds);
+	RC |= XAie_StrmConnCctEnable(DevInst, Loc, DMA, 0U, DMA, 0U);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Loc, 0U, DMA_S2MM, SrcBds);
+	RC |= XAie_DmaChannelEnable(DevInst, Loc, 0U, DMA_S2MM);
+	RC |= XAie_DmaChannelPushBdToQueue(DevInst, Loc, 0U, DMA_MM2S, 0U);
+	RC |= XAie_DmaChannelEnable(DevInst, Loc, 0U, DMA_MM2S);
+	if(RC != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the DMA and stream switch of an AIE tile to their reset
+* state after the zeroization of its data memory.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the AIE tile.
+*
+* @return	XAIE_OK on success, error code on failure.
+*
+* @note		internal to this file.
+*******************************************************************************/
+static AieRC _XAie_RstDmaZeroDataMemEnd(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	AieRC RC;
+	const XAie_DmaMod *DmaMod;
+
+	DmaMod = _XAie_GetDevMod(DevInst)[XAIEGBL_TILE_TYPE_AIETILE].DmaMod;
+
+	RC = XAie_DmaChannelDisable(DevInst, Loc, 0U, DMA_MM2S);
+	RC |= XAie_DmaChannelDisable(DevInst, Loc, 0U, DMA_S2MM);
+	RC |= XAie_DmaChannelResetAll(DevInst, Loc, DMA_CHANNEL_RESET);
+	RC |= XAie_DmaChannelResetAll(DevInst, Loc, DMA_CHANNEL_UNRESET);
+	RC |= XAie_StrmConnCctDisable(DevInst, Loc, DMA, 0U, DMA, 0U);
+	RC |= XAie_BlockSet32(DevInst, DmaMod->BaseAddr +
+			_XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col), 0U,
+			DmaMod->NumBds * DmaMod->IdxOffset / 4U);
+	if(RC != XAIE_OK) {
+		return XAIE_ERR;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API zeroizes the data memories of the AIE tiles of the partition with
+* their own DMAs. The DMAs of all the tiles are started first, so that the
+* memories are cleared in parallel, and the completion is then checked for all
+* the tiles in a single pass. Compared to clearing the memories over AXI-MM,
+* only 1/NumBds of each memory is transferred from the host.
+*
+* @param	DevInst: Device Instance
+*
+* @return	XAIE_OK on success, error code on failure. On failure, the
+*		caller shall clear the data memories with the AXI-MM path.
+*
+* @note		Only AIE tiles of the first generation devices are supported.
+*		The other devices have a memory zeroization control. The API
+*		uses the DMAs and stream switches of all the AIE tiles without
+*		going through the resource manager. It shall only be called
+*		right after the partition reset, when none of them can be in
+*		use, i.e. from the memory zeroization of the partition
+*		initialization. Tile DMA channel 0, its BDs and the DMA to DMA
+*		stream switch connection are left in their reset state.
+*		Internal only.
+*******************************************************************************/
+AieRC _XAie_RstDmaZeroDataMems(XAie_DevInst *DevInst)
+{
+	AieRC RC = XAIE_OK;
+
+	if(DevInst->DevProp.DevGen != XAIE_DEV_GEN_AIE) {
+		return XAIE_FEATURE_NOT_SUPPORTED;
+	}
+
+	for(u8 C = 0U; C < DevInst->NumCols; C++) {
+		for(u8 R = 1U; R < DevInst->NumRows; R++) {
+			XAie_LocType Loc = XAie_TileLoc(C, R);
+
+			if(_XAie_RstIsDmaZeroTile(DevInst, Loc) ==
+					XAIE_DISABLE) {
+				continue;
+			}
+
+			RC = _XAie_RstDmaZeroDataMemStart(DevInst, Loc);
+			if(RC != XAIE_OK) {
+				break;
+			}
+		}
+		if(RC != XAIE_OK) {
+			break;
+		}
+	}
+
+	/* Bulk completion check, then back to reset state */
+	for(u8 C = 0U; C < DevInst->NumCols; C++) {
+		for(u8 R = 1U; R < DevInst->NumRows; R++) {
+			XAie_LocType Loc = XAie_TileLoc(C, R);
+
+			if(_XAie_RstIsDmaZeroTile(DevInst, Loc) ==
+					XAIE_DISABLE) {
+				continue;
+			}
+
+			if(RC == XAIE_OK) {
+				RC = XAie_DmaWaitForDone(DevInst, Loc, 0U,
+						DMA_S2MM, 0U);
+			}
+
+			if(_XAie_RstDmaZeroDataMemEnd(DevInst, Loc) !=
+					XAIE_OK) {
+				RC = XAIE_ERR;
+			}
+		}
+	}
+
+	if(RC != XAIE_OK) {
+		XAIE_WARN("Failed to zeroize data memories with DMA\n");
+	}
+
+	return RC;
+}
+#else
+AieRC _XAie_RstDmaZeroDataMems(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+	return XAIE_FEATURE_NOT_SUPPORTED;
+}
+#endif /* XAIE_FEATURE_DMA_ENABLE && XAIE_FEATURE_SS_ENABLE */
+
 /*****************************************************************************/
 /**
 *
@@ -309,7 +523,9 @@ static void _XAie_ClearProgMem(XAie_DevInst *DevInst, XAie_LocType Loc)
 * @return	XAIE_OK on success.
 *		XAIE_INVALID_ARGS if any argument is invalid
 *
-* @note		None.
+* @note		The memories are cleared over AXI-MM. The tile DMAs are not
+*		used, as their BDs, channels and stream switch routes may be in
+*		use by the application.
 *******************************************************************************/
 AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst)
 {
@@ -319,12 +535,14 @@ AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst)
 		return XAIE_INVALID_ARGS;
 	}
 
+	_XAie_ElfLoadRecsInvalidate(DevInst);
+
 	for(u32 C = 0; C < DevInst->NumCols; C++) {
 		for(u32 R = 0; R < DevInst->NumRows; R++) {
 			XAie_LocType Loc = XAie_TileLoc(C, R);
 			u8 TileType;
 
-			TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+			TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 			if(TileType == XAIEGBL_TILE_TYPE_SHIMNOC ||
 			   TileType == XAIEGBL_TILE_TYPE_SHIMPL) {
 				continue;
@@ -21,6 +21,7 @@
 /************************** Function Prototypes  *****************************/
 AieRC XAie_ResetPartition(XAie_DevInst *DevInst);
 AieRC XAie_ClearPartitionMems(XAie_DevInst *DevInst);
+AieRC _XAie_RstDmaZeroDataMems(XAie_DevInst *DevInst);
 #endif		/* end of protection macro */
 
 /** @} */
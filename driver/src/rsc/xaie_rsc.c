@@ -37,6 +37,7 @@
 /***************************** Macro Definitions *****************************/
 #define XAIE_TRACE_CTRL_RSCS_PER_MOD	1U
 #define XAIE_COMBO_EVENTS_PER_MOD	4U
+#define XAIE_RSC_MGR_BATCH_SIZE		32U /* Requests per backend operation */
 
 #define XAIE_RSC_HEADER_TILE_TYPE_SHIFT	0U
 #define XAIE_RSC_HEADER_TILE_TYPE_MASK	0xF
@@ -92,14 +93,15 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	 * TODO: Replace the below case statement with a data structure that
 	 * can be indexed using tile type and resource type.
 	 */
-	NumMods = DevInst->DevProp.DevMod[TileType].NumModules;
+	NumMods = _XAie_GetDevMod(DevInst)[TileType].NumModules;
 	switch(RscType) {
 	case XAIE_PERFCNT_RSC:
 	{
 		const XAie_PerfMod *PerfMod;
 
 		for(u8 i = 0U; i < NumMods; i++) {
-			PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[i];
+			PerfMod =
+				&_XAie_GetDevMod(DevInst)[TileType].PerfMod[i];
 			NumRscs += PerfMod->MaxCounterVal;
 		}
 		return NumRscs;
@@ -108,7 +110,7 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_EvntMod *EventMod;
 		for(u8 i = 0U; i < NumMods; i++) {
-			EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[i];
+			EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[i];
 			NumRscs += EventMod->NumUserEvents;
 		}
 		return NumRscs;
@@ -117,7 +119,7 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_EvntMod *EventMod;
 		for(u8 i = 0U; i < NumMods; i++) {
-			EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[i];
+			EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[i];
 			NumRscs += EventMod->NumPCEvents;
 		}
 		return NumRscs;
@@ -133,7 +135,7 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_EvntMod *EventMod;
 		for(u8 i = 0U; i < NumMods; i++) {
-			EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[i];
+			EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[i];
 			NumRscs += EventMod->NumStrmPortSelectIds;
 		}
 		return NumRscs;
@@ -142,7 +144,7 @@ u32 _XAie_GetTotalNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_EvntMod *EventMod;
 		for(u8 i = 0U; i < NumMods; i++) {
-			EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[i];
+			EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[i];
 			NumRscs += EventMod->NumGroupEvents;
 		}
 		return NumRscs;
@@ -325,7 +327,7 @@ u32 _XAie_GetStartBit(XAie_DevInst *DevInst, XAie_LocType Loc, u32 MaxRscVal)
 	u8 TileType;
 	u32 StartRow, BitmapNumRows;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	StartRow = _XAie_GetStartRow(DevInst, TileType);
 	BitmapNumRows = _XAie_GetNumRows(DevInst, TileType);
 
@@ -356,7 +358,7 @@ void _XAie_MarkChannelBitmapAndRscId(XAie_DevInst *DevInst,
 	XAie_BitmapOffsets Offsets;
 
 	for(u32 i = 0; i < UserRscNum; i++) {
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
 		Bitmap = DevInst->RscMapping[TileType].
 				Bitmaps[XAIE_BCAST_CHANNEL_RSC];
 		_XAie_RscMgr_GetBitmapOffsets(DevInst, XAIE_BCAST_CHANNEL_RSC,
@@ -516,9 +518,9 @@ static const XAie_PerfMod *_XAie_GetPerfMod(XAie_DevInst *DevInst, u8 TileType,
 		XAie_ModuleType Mod)
 {
 	if(Mod == XAIE_PL_MOD)
-		return &DevInst->DevProp.DevMod[TileType].PerfMod[0U];
+		return &_XAie_GetDevMod(DevInst)[TileType].PerfMod[0U];
 	else
-		return &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+		return &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Mod];
 }
 
 /*****************************************************************************/
@@ -538,9 +540,9 @@ static const XAie_EvntMod *_XAie_GetEventMod(XAie_DevInst *DevInst, u8 TileType,
 		XAie_ModuleType Mod)
 {
 	if(Mod == XAIE_PL_MOD)
-		return &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		return &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	else
-		return &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		return &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Mod];
 }
 
 /*****************************************************************************/
@@ -566,7 +568,7 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 	{
 		const XAie_PerfMod *PerfMod;
 		u8 TileType;
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		PerfMod = _XAie_GetPerfMod(DevInst, TileType, Mod);
 		return PerfMod->MaxCounterVal;
 	}
@@ -575,7 +577,7 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 		const XAie_EvntMod *EventMod;
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumUserEvents;
 	}
@@ -584,7 +586,7 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 		const XAie_EvntMod *EventMod;
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumPCEvents;
 	}
@@ -597,7 +599,7 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 		const XAie_EvntMod *EventMod;
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumStrmPortSelectIds;
 	}
@@ -606,7 +608,7 @@ u32 _XAie_RscMgr_GetMaxRscVal(XAie_DevInst *DevInst, XAie_RscType RscType,
 		const XAie_EvntMod *EventMod;
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 		EventMod = _XAie_GetEventMod(DevInst, TileType, Mod);
 		return EventMod->NumGroupEvents;
 	}
@@ -646,7 +648,7 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 	u32 MaxRscVal;
 	u8 TileType;
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	MaxRscVal = _XAie_RscMgr_GetMaxRscVal(DevInst, RscType, Loc, Mod);
 	if(Mod == XAIE_CORE_MOD)
 		BitmapOffset = _XAie_GetCoreBitmapOffset(DevInst,
@@ -665,119 +667,267 @@ void _XAie_RscMgr_GetBitmapOffsets(XAie_DevInst *DevInst, XAie_RscType RscType,
 
 /*****************************************************************************/
 /**
-* This API shall be used to request a resource from the backend based on the
-* resource type.
+* This API populates the backend arguments of a resource of a tile module.
 *
 * @param	DevInst: Device Instance
+* @param	Loc: Location of the tile
+* @param	Mod: Module type
+* @param	RscType: Resource type
+* @param	TilesRsc: Backend arguments to populate
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAie_RscMgr_SetTilesRsc(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_ModuleType Mod, XAie_RscType RscType,
+		XAie_BackendTilesRsc *TilesRsc)
+{
+	XAie_BitmapOffsets Offsets;
+	u8 TileType;
+
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
+	_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType, Loc, Mod, &Offsets);
+
+	memset((void *)TilesRsc, 0, sizeof(*TilesRsc));
+	TilesRsc->Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
+	TilesRsc->RscType = RscType;
+	TilesRsc->MaxRscVal = Offsets.MaxRscVal;
+	TilesRsc->BitmapOffset = Offsets.BitmapOffset;
+	TilesRsc->StartBit = Offsets.StartBit;
+	TilesRsc->StaticBitmapOffset = Offsets.StaticBitmapOffset;
+	TilesRsc->Loc = Loc;
+	TilesRsc->Mod = Mod;
+}
+
+/*****************************************************************************/
+/**
+* This API requests the resources of an array of requests from the backend
+* with one backend operation per request. It is used with the backends which do
+* not support the resource array operations.
+*
+* @param	DevInst: Device Instance
+* @param	TilesRscArray: Backend arguments of the requests
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only. The resources granted to the previous requests
+*		of the array are freed if a request fails.
+*
+*******************************************************************************/
+static AieRC _XAie_RscMgr_RequestRscPerTile(XAie_DevInst *DevInst,
+		XAie_BackendTilesRscArray *TilesRscArray)
+{
+	AieRC RC;
+
+	for(u32 i = 0U; i < TilesRscArray->NumTilesRsc; i++) {
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
+				(void *)&TilesRscArray->TilesRsc[i]);
+		if(RC != XAIE_OK) {
+			/* Clear resource marking for all previous requests */
+			for(u32 j = 0U; j < i; j++) {
+				XAie_BackendTilesRsc TilesRsc =
+					TilesRscArray->TilesRsc[j];
+
+				for(u32 k = 0U; k < TilesRsc.NumRscPerTile;
+						k++) {
+					TilesRsc.RscId = TilesRsc.Rscs[k].RscId;
+					XAie_RunOp(DevInst,
+						XAIE_BACKEND_OP_FREE_RESOURCE,
+						(void *)&TilesRsc);
+				}
+			}
+			return RC;
+		}
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+* This API requests the resources of all the requests from the backend. The
+* requests are passed to the backend in batches of up to
+* XAIE_RSC_MGR_BATCH_SIZE requests, each with a single backend operation.
+* Backends which do not support the operation are served with one operation per
+* request.
+*
+* @param	DevInst: Device Instance
+* @param	NumReq: Number of requests
 * @param	RscReq: Contains parameters related to resource request.
 * 			tile loc, module, no. of resource request per tile.
-* @param	NumReq: Number of requests
-* @param	UserRscNum: Size of Rscs array. Must be NumReq * NumRscPerTile
-* @param	Rscs: Contains parameters to return reource such as counter ids,
-* 		      Location, Module, resource type.
-* 		      It needs to be allocated from user application.
+* @param	Rscs: Array to return the granted resources.
 * @param	RscType: Resource type
+* @param	Contig: XAIE_ENABLE to request contiguous resources per tile.
 *
 * @return	XAIE_OK on success.
 *
-* @note		If any request out of pool requests fails, it returns failure.
-* 		The pool request allocation checks static as well as runtime
-* 		bitmaps for availibity and marks runtime bitmap for any
-* 		granted resource. Internal only.
+* @note		Internal only. Either all the requests are granted or none.
 *
 *******************************************************************************/
-AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
+static AieRC _XAie_RscMgr_RequestRscArray(XAie_DevInst *DevInst, u32 NumReq,
 		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
-		XAie_RscType RscType)
+		XAie_RscType RscType, u8 Contig)
 {
-	AieRC RC;
+	AieRC RC = XAIE_OK;
 	u32 UserRscIndex = 0U;
+	XAie_BackendTilesRsc TilesRscs[XAIE_RSC_MGR_BATCH_SIZE];
+	XAie_BackendTilesRscArray TilesRscArray;
 
-	for(u32 i = 0U; i < NumReq; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
+	TilesRscArray.TilesRsc = TilesRscs;
+	for(u32 Base = 0U; Base < NumReq; Base += TilesRscArray.NumTilesRsc) {
+		u32 BatchRscIndex = UserRscIndex;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+		TilesRscArray.NumTilesRsc = NumReq - Base;
+		if(TilesRscArray.NumTilesRsc > XAIE_RSC_MGR_BATCH_SIZE) {
+			TilesRscArray.NumTilesRsc = XAIE_RSC_MGR_BATCH_SIZE;
+		}
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = RscReq[i].Loc;
-		TilesRsc.Mod = RscReq[i].Mod;
-		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
-		TilesRsc.Rscs = &Rscs[UserRscIndex];
+		for(u32 i = 0U; i < TilesRscArray.NumTilesRsc; i++) {
+			XAie_UserRscReq *Req = &RscReq[Base + i];
+			XAie_BackendTilesRsc *TilesRsc = &TilesRscs[i];
+
+			_XAie_RscMgr_SetTilesRsc(DevInst, Req->Loc, Req->Mod,
+					RscType, TilesRsc);
+			TilesRsc->NumRscPerTile = Req->NumRscPerTile;
+			TilesRsc->Rscs = &Rscs[BatchRscIndex];
+			if(Contig == XAIE_ENABLE) {
+				TilesRsc->Flags = XAIE_RSC_MGR_CONTIG_FLAG;
+				TilesRsc->NumContigRscs = Req->NumRscPerTile;
+			}
 
-		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
-				(void *)&TilesRsc);
+			BatchRscIndex += Req->NumRscPerTile;
+		}
+
+		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE_ARRAY,
+				(void *)&TilesRscArray);
+		if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+			RC = _XAie_RscMgr_RequestRscPerTile(DevInst,
+					&TilesRscArray);
+		}
 		if(RC != XAIE_OK) {
-			/* Clear resource marking for all previous requests */
+			/* Clear resource marking for all previous batches */
 			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
 					RscType);
 			XAIE_WARN("Unable to request resources. RscType: %d\n",
 					RscType);
 			return XAIE_INVALID_ARGS;
 		}
-		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
-			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
-			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
-			Rscs[UserRscIndex].RscType = RscType;
-			UserRscIndex++;
+
+		for(u32 i = 0U; i < TilesRscArray.NumTilesRsc; i++) {
+			XAie_UserRscReq *Req = &RscReq[Base + i];
+
+			for(u32 j = 0U; j < Req->NumRscPerTile; j++) {
+				Rscs[UserRscIndex].Loc = Req->Loc;
+				Rscs[UserRscIndex].Mod = Req->Mod;
+				Rscs[UserRscIndex].RscType = RscType;
+				UserRscIndex++;
+			}
 		}
 	}
 
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+* This API shall be used to request a resource from the backend based on the
+* resource type.
+*
+* @param	DevInst: Device Instance
+* @param	RscReq: Contains parameters related to resource request.
+* 			tile loc, module, no. of resource request per tile.
+* @param	NumReq: Number of requests
+* @param	UserRscNum: Size of Rscs array. Must be NumReq * NumRscPerTile
+* @param	Rscs: Contains parameters to return reource such as counter ids,
+* 		      Location, Module, resource type.
+* 		      It needs to be allocated from user application.
+* @param	RscType: Resource type
+*
+* @return	XAIE_OK on success.
+*
+* @note		If any request out of pool requests fails, it returns failure.
+* 		The pool request allocation checks static as well as runtime
+* 		bitmaps for availibity and marks runtime bitmap for any
+* 		granted resource. The requests are passed to the backend in
+* 		batches. Internal only.
+*
+*******************************************************************************/
+AieRC _XAie_RscMgr_RequestRsc(XAie_DevInst *DevInst, u32 NumReq,
+		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
+		XAie_RscType RscType)
+{
+	return _XAie_RscMgr_RequestRscArray(DevInst, NumReq, RscReq, Rscs,
+			RscType, XAIE_DISABLE);
+}
+
 AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 		XAie_UserRscReq *RscReq, XAie_UserRsc *Rscs,
 		XAie_RscType RscType)
+{
+	return _XAie_RscMgr_RequestRscArray(DevInst, NumReq, RscReq, Rscs,
+			RscType, XAIE_ENABLE);
+}
+
+/*****************************************************************************/
+/**
+* This API passes an array of resources to the backend in batches of up to
+* XAIE_RSC_MGR_BATCH_SIZE resources, each with a single free or release
+* operation. Backends which do not support the operation are served with one
+* operation per resource.
+*
+* @param	DevInst: Device Instance
+* @param	RscNum: Size of Rscs array.
+* @param	Rscs: Contains parameters to release resource such as
+*		      counter ids, Location, Module, resource type.
+* @param	RscType: Resource type
+* @param	Op: XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY or
+*		    XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY
+*
+* @return	XAIE_OK on success.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_RscMgr_PutRscArray(XAie_DevInst *DevInst, u32 RscNum,
+		XAie_UserRsc *Rscs, XAie_RscType RscType,
+		XAie_BackendOpCode Op)
 {
 	AieRC RC;
-	u32 UserRscIndex = 0U;
+	XAie_BackendTilesRsc TilesRscs[XAIE_RSC_MGR_BATCH_SIZE];
+	XAie_BackendTilesRscArray TilesRscArray;
+	XAie_BackendOpCode TileOp = XAIE_BACKEND_OP_FREE_RESOURCE;
 
-	for(u32 i = 0U; i < NumReq; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
+	if(Op == XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY) {
+		TileOp = XAIE_BACKEND_OP_RELEASE_RESOURCE;
+	}
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscReq[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				RscReq[i].Loc, RscReq[i].Mod, &Offsets);
+	TilesRscArray.TilesRsc = TilesRscs;
+	for(u32 Base = 0U; Base < RscNum; Base += TilesRscArray.NumTilesRsc) {
+		TilesRscArray.NumTilesRsc = RscNum - Base;
+		if(TilesRscArray.NumTilesRsc > XAIE_RSC_MGR_BATCH_SIZE) {
+			TilesRscArray.NumTilesRsc = XAIE_RSC_MGR_BATCH_SIZE;
+		}
 
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = RscReq[i].Loc;
-		TilesRsc.Mod = RscReq[i].Mod;
-		TilesRsc.NumRscPerTile = RscReq[i].NumRscPerTile;
-		TilesRsc.Flags = XAIE_RSC_MGR_CONTIG_FLAG;
-		TilesRsc.NumContigRscs = RscReq[i].NumRscPerTile;
-		TilesRsc.Rscs = &Rscs[UserRscIndex];
+		for(u32 i = 0U; i < TilesRscArray.NumTilesRsc; i++) {
+			XAie_UserRsc *Rsc = &Rscs[Base + i];
 
-		RC = XAie_RunOp(DevInst, XAIE_BACKEND_OP_REQUEST_RESOURCE,
-				(void *)&TilesRsc);
-		if(RC != XAIE_OK) {
-			/* Clear resource marking for all previous requests */
-			_XAie_RscMgr_FreeRscs(DevInst, UserRscIndex, Rscs,
-					RscType);
-			XAIE_WARN("Unable to request resources. RscType: %d\n",
-					RscType);
-			return XAIE_INVALID_ARGS;
+			_XAie_RscMgr_SetTilesRsc(DevInst, Rsc->Loc, Rsc->Mod,
+					RscType, &TilesRscs[i]);
+			TilesRscs[i].RscId = Rsc->RscId;
 		}
-		for(u32 j = 0U; j < RscReq[i].NumRscPerTile; j++) {
-			Rscs[UserRscIndex].Loc = RscReq[i].Loc;
-			Rscs[UserRscIndex].Mod = RscReq[i].Mod;
-			Rscs[UserRscIndex].RscType = RscType;
-			UserRscIndex++;
+
+		/*
+		 * NOTE: No need to check the return value from run op function
+		 * as free resource is always successful.
+		 */
+		RC = XAie_RunOp(DevInst, Op, (void *)&TilesRscArray);
+		if(RC == XAIE_FEATURE_NOT_SUPPORTED) {
+			for(u32 i = 0U; i < TilesRscArray.NumTilesRsc; i++) {
+				XAie_RunOp(DevInst, TileOp,
+						(void *)&TilesRscs[i]);
+			}
 		}
 	}
 
@@ -805,32 +955,8 @@ AieRC _XAie_RscMgr_RequestRscContiguous(XAie_DevInst *DevInst, u32 NumReq,
 AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
 		XAie_UserRsc *Rscs, XAie_RscType RscType)
 {
-	for(u32 i =0U; i < RscNum; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
-
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
-
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.Loc = Rscs[i].Loc;
-		TilesRsc.Mod = Rscs[i].Mod;
-		TilesRsc.RscId = Rscs[i].RscId;
-		/*
-		 * NOTE: No need to check the return value from run op function
-		 * as free resource is always successful.
-		 */
-		XAie_RunOp(DevInst, XAIE_BACKEND_OP_FREE_RESOURCE,
-				(void *)&TilesRsc);
-	}
-
-	return XAIE_OK;
+	return _XAie_RscMgr_PutRscArray(DevInst, RscNum, Rscs, RscType,
+			XAIE_BACKEND_OP_FREE_RESOURCE_ARRAY);
 }
 
 /*****************************************************************************/
@@ -854,33 +980,8 @@ AieRC _XAie_RscMgr_FreeRscs(XAie_DevInst *DevInst, u32 RscNum,
 AieRC _XAie_RscMgr_ReleaseRscs(XAie_DevInst *DevInst, u32 RscNum,
 		XAie_UserRsc *Rscs, XAie_RscType RscType)
 {
-	for(u32 i =0U; i < RscNum; i++) {
-		XAie_BackendTilesRsc TilesRsc = {0};
-		XAie_BitmapOffsets Offsets;
-		u8 TileType;
-
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
-		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
-				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
-
-		TilesRsc.Bitmap = DevInst->RscMapping[TileType].Bitmaps[RscType];
-		TilesRsc.RscType = RscType;
-		TilesRsc.MaxRscVal = Offsets.MaxRscVal;
-		TilesRsc.BitmapOffset = Offsets.BitmapOffset;
-		TilesRsc.StartBit = Offsets.StartBit;
-		TilesRsc.StaticBitmapOffset = Offsets.StaticBitmapOffset;
-		TilesRsc.Loc = Rscs[i].Loc;
-		TilesRsc.Mod = Rscs[i].Mod;
-		TilesRsc.RscId = Rscs[i].RscId;
-		/*
-		 * NOTE: No need to check the return value from run op function
-		 * as free resource is always successful.
-		 */
-		XAie_RunOp(DevInst, XAIE_BACKEND_OP_RELEASE_RESOURCE,
-				(void *)&TilesRsc);
-	}
-
-	return XAIE_OK;
+	return _XAie_RscMgr_PutRscArray(DevInst, RscNum, Rscs, RscType,
+			XAIE_BACKEND_OP_RELEASE_RESOURCE_ARRAY);
 }
 
 /*****************************************************************************/
@@ -914,7 +1015,7 @@ AieRC _XAie_RscMgr_RequestAllocatedRsc(XAie_DevInst *DevInst, u32 NumReq,
 		XAie_BitmapOffsets Offsets;
 		u8 TileType;
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Rscs[i].Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, Rscs[i].Loc);
 		_XAie_RscMgr_GetBitmapOffsets(DevInst, RscType,
 				Rscs[i].Loc, Rscs[i].Mod, &Offsets);
 
@@ -1003,21 +1104,21 @@ static u32 _XAie_GetNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_PerfMod *PerfMod;
 
-		PerfMod = &DevInst->DevProp.DevMod[TileType].PerfMod[Mod];
+		PerfMod = &_XAie_GetDevMod(DevInst)[TileType].PerfMod[Mod];
 		return PerfMod->MaxCounterVal;
 	}
 	case XAIE_USER_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Mod];
 		return EventMod->NumUserEvents;
 	}
 	case XAIE_PC_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Mod];
 		return EventMod->NumPCEvents;
 	}
 	case XAIE_TRACE_CTRL_RSC:
@@ -1028,14 +1129,14 @@ static u32 _XAie_GetNumRscs(XAie_DevInst *DevInst, u8 TileType,
 	{
 		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Mod];
 		return EventMod->NumStrmPortSelectIds;
 	}
 	case XAIE_GROUP_EVENTS_RSC:
 	{
 		const XAie_EvntMod *EventMod;
 
-		EventMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
+		EventMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Mod];
 		return EventMod->NumGroupEvents;
 	}
 	case XAIE_COMBO_EVENTS_RSC:
@@ -1159,7 +1260,7 @@ AieRC XAie_SaveAllocatedRscsToFile(XAie_DevInst *DevInst, const char *File)
 			u8 NumMods;
 
 			Bitmap = RscMap->Bitmaps[j];
-			NumMods = DevInst->DevProp.DevMod[i].NumModules;
+			NumMods = _XAie_GetDevMod(DevInst)[i].NumModules;
 			for(u8 k = 0U; k < NumMods; k++) {
 				u32 NumRscs;
 				u32 BitmapSize;
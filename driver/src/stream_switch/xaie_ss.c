@@ -162,6 +162,61 @@ static AieRC _StrmConfigMstr(const XAie_StrmMod *StrmMod,
 	return XAIE_OK;
 }
 
+/*****************************************************************************/
+/**
+*
+* This API computes the register offsets and values of the master and slave
+* ports of a circuit switch connection. The connection itself is not verified.
+*
+* @param	StrmMod - Stream switch module of the tile.
+* @param	Slave - Slave port type.
+* @param	SlvPortNum - Slave port number.
+* @param	Master - Master port type.
+* @param	MstrPortNum - Master port number.
+* @param	Enable - Enable/Disable the connection.
+* @param	MstrOff - Pointer to return the master port register offset.
+* @param	MstrVal - Pointer to return the master port register value.
+* @param	SlvOff - Pointer to return the slave port register offset.
+* @param	SlvVal - Pointer to return the slave port register value.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal API.
+*
+*******************************************************************************/
+AieRC _XAie_StrmSwCctRegs(const XAie_StrmMod *StrmMod, StrmSwPortType Slave,
+		u8 SlvPortNum, StrmSwPortType Master, u8 MstrPortNum,
+		u8 Enable, u32 *MstrOff, u32 *MstrVal, u32 *SlvOff,
+		u32 *SlvVal)
+{
+	AieRC RC;
+	u8 SlaveIdx;
+
+	RC = _XAie_GetSlaveIdx(StrmMod, Slave, SlvPortNum, &SlaveIdx);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Unable to compute Slave Index\n");
+		return RC;
+	}
+
+	/* Compute the register value and register address for the master port*/
+	RC = _StrmConfigMstr(StrmMod, Master, MstrPortNum, Enable, XAIE_DISABLE,
+			SlaveIdx, MstrVal, MstrOff);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Master config error\n");
+		return RC;
+	}
+
+	/* Compute the register value and register address for slave port */
+	RC = _XAie_StrmConfigSlv(StrmMod, Slave, SlvPortNum, Enable,
+			XAIE_DISABLE, SlvVal, SlvOff);
+	if(RC != XAIE_OK) {
+		XAIE_ERROR("Slave config error\n");
+		return RC;
+	}
+
+	return XAIE_OK;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -194,7 +249,6 @@ static AieRC _XAie_StreamSwitchConfigureCct(XAie_DevInst *DevInst,
 	u32 MstrVal;
 	u32 SlvOff;
 	u32 SlvVal;
-	u8 SlaveIdx;
 	u8 TileType;
 	const XAie_StrmMod *StrmMod;
 
@@ -225,25 +279,10 @@ static AieRC _XAie_StreamSwitchConfigureCct(XAie_DevInst *DevInst,
                 return RC;
         }
 
-	RC = _XAie_GetSlaveIdx(StrmMod, Slave, SlvPortNum, &SlaveIdx);
+	RC = _XAie_StrmSwCctRegs(StrmMod, Slave, SlvPortNum, Master,
+			MstrPortNum, Enable, &MstrOff, &MstrVal, &SlvOff,
+			&SlvVal);
 	if(RC != XAIE_OK) {
-		XAIE_ERROR("Unable to compute Slave Index\n");
-		return RC;
-	}
-
-	/* Compute the register value and register address for the master port*/
-	RC = _StrmConfigMstr(StrmMod, Master, MstrPortNum, Enable, XAIE_DISABLE,
-			SlaveIdx, &MstrVal, &MstrOff);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Master config error\n");
-		return RC;
-	}
-
-	/* Compute the register value and register address for slave port */
-	RC = _XAie_StrmConfigSlv(StrmMod, Slave, SlvPortNum, Enable,
-			XAIE_DISABLE, &SlvVal, &SlvOff);
-	if(RC != XAIE_OK) {
-		XAIE_ERROR("Slave config error\n");
 		return RC;
 	}
 
@@ -256,7 +295,17 @@ static AieRC _XAie_StreamSwitchConfigureCct(XAie_DevInst *DevInst,
 		return RC;
 	}
 
-	return XAie_Write32(DevInst, SlvAddr, SlvVal);
+	RC = XAie_Write32(DevInst, SlvAddr, SlvVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	_XAie_StrmPortMapUpdate(DevInst, Loc, XAIE_STRMSW_MASTER, Master,
+			MstrPortNum, Enable);
+	_XAie_StrmPortMapUpdate(DevInst, Loc, XAIE_STRMSW_SLAVE, Slave,
+			SlvPortNum, Enable);
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
@@ -377,7 +426,15 @@ static AieRC _XAie_StrmSlavePortConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 
 	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
 
-	return XAie_Write32(DevInst, Addr, RegVal);
+	RC = XAie_Write32(DevInst, Addr, RegVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	_XAie_StrmPortMapUpdate(DevInst, Loc, XAIE_STRMSW_SLAVE, Slave,
+			SlvPortNum, Enable);
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
@@ -517,7 +574,15 @@ static AieRC _XAie_StrmPktSwMstrPortConfig(XAie_DevInst *DevInst,
 
 	Addr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOff;
 
-	return XAie_Write32(DevInst, Addr, RegVal);
+	RC = XAie_Write32(DevInst, Addr, RegVal);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	_XAie_StrmPortMapUpdate(DevInst, Loc, XAIE_STRMSW_MASTER, Master,
+			MstrPortNum, Enable);
+
+	return XAIE_OK;
 }
 
 /*****************************************************************************/
@@ -38,6 +38,15 @@ typedef enum {
 	XAIE_SS_PKT_DROP_HEADER
 } XAie_StrmSwPktHeader;
 
+/* Typedef to capture a circuit switch connection of a stream route */
+typedef struct {
+	XAie_LocType Loc;
+	StrmSwPortType Slave;
+	u8 SlvPortNum;
+	StrmSwPortType Master;
+	u8 MstrPortNum;
+} XAie_StrmHop;
+
 /************************** Function Prototypes  *****************************/
 AieRC XAie_StrmConnCctEnable(XAie_DevInst *DevInst, XAie_LocType Loc,
 		StrmSwPortType Slave, u8 SlvPortNum, StrmSwPortType Master,
@@ -79,5 +88,20 @@ AieRC XAie_StrmSwDeterministicMergeEnable(XAie_DevInst *DevInst,
 		XAie_LocType Loc, u8 Arbitor);
 AieRC XAie_StrmSwDeterministicMergeDisable(XAie_DevInst *DevInst,
 		XAie_LocType Loc, u8 Arbitor);
+AieRC XAie_StrmRouteCct(XAie_DevInst *DevInst, XAie_LocType SrcLoc,
+		StrmSwPortType Slave, u8 SlvPortNum, XAie_LocType DstLoc,
+		StrmSwPortType Master, u8 MstrPortNum, XAie_StrmHop *Hops,
+		u32 *NumHops);
+AieRC XAie_StrmRouteCctRelease(XAie_DevInst *DevInst, const XAie_StrmHop *Hops,
+		u32 NumHops);
+
+/* Internal APIs */
+AieRC _XAie_StrmSwCctRegs(const XAie_StrmMod *StrmMod, StrmSwPortType Slave,
+		u8 SlvPortNum, StrmSwPortType Master, u8 MstrPortNum,
+		u8 Enable, u32 *MstrOff, u32 *MstrVal, u32 *SlvOff,
+		u32 *SlvVal);
+void _XAie_StrmPortMapUpdate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_StrmPortIntf PortIntf, StrmSwPortType PortType,
+		u8 PortNum, u8 Used);
 
 #endif		/* end of protection macro */
@@ -0,0 +1,814 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_ss_route.c
+* @{
+*
+* This file contains routines to track the stream switch port occupancy and to
+* route circuit switch streams across the tiles of a partition.
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "xaie_clock.h"
+#include "xaie_events.h"
+#include "xaie_feature_config.h"
+#include "xaie_helper.h"
+#include "xaie_ss.h"
+
+#ifdef XAIE_FEATURE_SS_ENABLE
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SS_ROUTE_NUM_DIRS		4U
+#define XAIE_SS_ROUTE_MAX_PORTS		8U
+#define XAIE_SS_ROUTE_STATES		(XAIE_SS_ROUTE_NUM_DIRS * \
+					 XAIE_SS_ROUTE_MAX_PORTS)
+/* Cost of a hop, larger than the congestion cost of any route */
+#define XAIE_SS_ROUTE_HOP_COST		4096U
+#define XAIE_SS_ROUTE_INF		0xFFFFFFFFU
+
+/****************************** Type Definitions *****************************/
+/* Used ports of a tile, one bit per port number */
+typedef struct {
+	u8 Mstr[SS_PORT_TYPE_MAX];
+	u8 Slv[SS_PORT_TYPE_MAX];
+} XAie_StrmTilePorts;
+
+struct XAie_StrmPortMap {
+	u32 NumTiles;
+	XAie_StrmTilePorts Tiles[];	/* Column major */
+};
+
+typedef struct {
+	u32 Cost;
+	u32 State;
+} XAie_StrmRouteNode;
+
+/* Binary min heap of the route search */
+typedef struct {
+	u32 Num;
+	u32 Max;
+	XAie_StrmRouteNode *Nodes;
+} XAie_StrmRouteHeap;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API returns the used ports of a tile, allocating the port occupancy map
+* of the partition if needed.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+*
+* @return	Used ports of the tile, NULL on failure.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_StrmTilePorts *_XAie_StrmPortMapGet(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	struct XAie_StrmPortMap *Map = DevInst->StrmPortMap;
+
+	if(Map == NULL) {
+		u32 NumTiles = (u32)DevInst->NumCols * DevInst->NumRows;
+
+		Map = calloc(1U, sizeof(*Map) + NumTiles * sizeof(Map->Tiles[0]));
+		if(Map == NULL) {
+			XAIE_WARN("Unable to allocate stream port map\n");
+			return NULL;
+		}
+
+		Map->NumTiles = NumTiles;
+		DevInst->StrmPortMap = Map;
+	}
+
+	return &Map->Tiles[Loc.Col * DevInst->NumRows + Loc.Row];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records a stream switch port as used or free in the port occupancy
+* map.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	PortIntf: XAIE_STRMSW_SLAVE or XAIE_STRMSW_MASTER.
+* @param	PortType: Port type.
+* @param	PortNum: Port number.
+* @param	Used: XAIE_ENABLE if the port is used, XAIE_DISABLE otherwise.
+*
+* @return	None.
+*
+* @note		Internal only. The stream switch APIs call it once the port is
+*		configured.
+*
+*******************************************************************************/
+void _XAie_StrmPortMapUpdate(XAie_DevInst *DevInst, XAie_LocType Loc,
+		XAie_StrmPortIntf PortIntf, StrmSwPortType PortType,
+		u8 PortNum, u8 Used)
+{
+	XAie_StrmTilePorts *Ports;
+	u8 *Mask;
+
+	if(PortNum >= XAIE_SS_ROUTE_MAX_PORTS) {
+		return;
+	}
+
+	Ports = _XAie_StrmPortMapGet(DevInst, Loc);
+	if(Ports == NULL) {
+		return;
+	}
+
+	Mask = (PortIntf == XAIE_STRMSW_SLAVE) ? &Ports->Slv[PortType] :
+		&Ports->Mstr[PortType];
+	if(Used == XAIE_ENABLE) {
+		*Mask |= (u8)(1U << PortNum);
+	} else {
+		*Mask &= (u8)~(1U << PortNum);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API marks all the stream switch ports of the partition as free. It is
+* called by the operations which reset the tiles.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_StrmPortMapReset(XAie_DevInst *DevInst)
+{
+	struct XAie_StrmPortMap *Map = DevInst->StrmPortMap;
+
+	if(Map == NULL) {
+		return;
+	}
+
+	memset(Map->Tiles, 0, Map->NumTiles * sizeof(Map->Tiles[0]));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the port occupancy map of the partition.
+*
+* @param	DevInst: Device Instance
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+void _XAie_StrmPortMapFree(XAie_DevInst *DevInst)
+{
+	free(DevInst->StrmPortMap);
+	DevInst->StrmPortMap = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of set bits of a port mask.
+*
+* @param	Mask: Port mask.
+*
+* @return	Number of used ports.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static inline u32 _XAie_StrmNumUsed(u8 Mask)
+{
+	u32 Num = 0U;
+
+	for(; Mask != 0U; Mask &= (u8)(Mask - 1U)) {
+		Num++;
+	}
+
+	return Num;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the neighbouring tile reached through a master port
+* direction, and the slave port type it is received on.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+* @param	Dir: SOUTH, WEST, NORTH or EAST master port.
+* @param	NextLoc: Pointer to return the neighbouring tile.
+* @param	NextSlave: Pointer to return the slave port type.
+*
+* @return	XAIE_OK if the neighbour is within the partition, XAIE_ERR
+*		otherwise.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmNeighbour(XAie_DevInst *DevInst, XAie_LocType Loc,
+		StrmSwPortType Dir, XAie_LocType *NextLoc,
+		StrmSwPortType *NextSlave)
+{
+	*NextLoc = Loc;
+
+	switch(Dir) {
+	case SOUTH:
+		if(Loc.Row == 0U) {
+			return XAIE_ERR;
+		}
+		NextLoc->Row--;
+		*NextSlave = NORTH;
+		break;
+	case NORTH:
+		if(Loc.Row + 1U >= DevInst->NumRows) {
+			return XAIE_ERR;
+		}
+		NextLoc->Row++;
+		*NextSlave = SOUTH;
+		break;
+	case WEST:
+		if(Loc.Col == 0U) {
+			return XAIE_ERR;
+		}
+		NextLoc->Col--;
+		*NextSlave = EAST;
+		break;
+	default:
+		if(Loc.Col + 1U >= DevInst->NumCols) {
+			return XAIE_ERR;
+		}
+		NextLoc->Col++;
+		*NextSlave = WEST;
+		break;
+	}
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API inserts a node in the heap of the route search.
+*
+* @param	Heap: Heap.
+* @param	Cost: Cost of the node.
+* @param	State: Search state of the node.
+*
+* @return	XAIE_OK on success, XAIE_ERR if the allocation fails.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmHeapPush(XAie_StrmRouteHeap *Heap, u32 Cost, u32 State)
+{
+	u32 i;
+
+	if(Heap->Num == Heap->Max) {
+		u32 Max = (Heap->Max == 0U) ? 64U : Heap->Max * 2U;
+		XAie_StrmRouteNode *Nodes;
+
+		Nodes = realloc(Heap->Nodes, Max * sizeof(*Nodes));
+		if(Nodes == NULL) {
+			return XAIE_ERR;
+		}
+
+		Heap->Nodes = Nodes;
+		Heap->Max = Max;
+	}
+
+	for(i = Heap->Num++; i > 0U; i = (i - 1U) / 2U) {
+		if(Heap->Nodes[(i - 1U) / 2U].Cost <= Cost) {
+			break;
+		}
+		Heap->Nodes[i] = Heap->Nodes[(i - 1U) / 2U];
+	}
+
+	Heap->Nodes[i].Cost = Cost;
+	Heap->Nodes[i].State = State;
+
+	return XAIE_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API removes the node with the lowest cost from the heap of the route
+* search.
+*
+* @param	Heap: Heap, not empty.
+*
+* @return	Node with the lowest cost.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static XAie_StrmRouteNode _XAie_StrmHeapPop(XAie_StrmRouteHeap *Heap)
+{
+	XAie_StrmRouteNode Top = Heap->Nodes[0];
+	XAie_StrmRouteNode Last = Heap->Nodes[--Heap->Num];
+	u32 i = 0U;
+
+	while(2U * i + 1U < Heap->Num) {
+		u32 Child = 2U * i + 1U;
+
+		if((Child + 1U < Heap->Num) &&
+				(Heap->Nodes[Child + 1U].Cost <
+				 Heap->Nodes[Child].Cost)) {
+			Child++;
+		}
+
+		if(Last.Cost <= Heap->Nodes[Child].Cost) {
+			break;
+		}
+
+		Heap->Nodes[i] = Heap->Nodes[Child];
+		i = Child;
+	}
+
+	if(Heap->Num != 0U) {
+		Heap->Nodes[i] = Last;
+	}
+
+	return Top;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks if a tile can be used by a route.
+*
+* @param	DevInst: Device Instance
+* @param	Loc: Location of the tile.
+*
+* @return	Stream switch module of the tile, NULL if the tile can't be
+*		used.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static const XAie_StrmMod *_XAie_StrmRouteTileMod(XAie_DevInst *DevInst,
+		XAie_LocType Loc)
+{
+	u8 TileType;
+
+	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
+		return NULL;
+	}
+
+	if(_XAie_PmIsTileRequested(DevInst, Loc) == XAIE_DISABLE) {
+		return NULL;
+	}
+
+	return DevInst->DevProp.DevMod[TileType].StrmSw;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the circuit switch connections of a route in a single
+* transaction and updates the port occupancy map.
+*
+* @param	DevInst: Device Instance
+* @param	Hops: Connections of the route, from the source to the
+*		destination.
+* @param	NumHops: Number of connections.
+* @param	Enable: XAIE_ENABLE to connect, XAIE_DISABLE to disconnect.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		Internal only. The connections are enabled from the
+*		destination to the source, so that no data is forwarded to a
+*		port which is not configured yet, and disabled from the source
+*		to the destination.
+*
+*******************************************************************************/
+static AieRC _XAie_StrmRouteConfig(XAie_DevInst *DevInst,
+		const XAie_StrmHop *Hops, u32 NumHops, u8 Enable)
+{
+	AieRC RC, TxnRC;
+
+	RC = XAie_StartTransaction(DevInst,
+			XAIE_TRANSACTION_DISABLE_AUTO_FLUSH);
+	if(RC != XAIE_OK) {
+		return RC;
+	}
+
+	for(u32 i = 0U; i < NumHops; i++) {
+		const XAie_StrmHop *Hop;
+		const XAie_StrmMod *StrmMod;
+		u32 MstrOff, MstrVal, SlvOff, SlvVal;
+		u64 TileAddr;
+		u8 TileType;
+
+		Hop = (Enable == XAIE_ENABLE) ? &Hops[NumHops - 1U - i] :
+			&Hops[i];
+		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Hop->Loc);
+		StrmMod = DevInst->DevProp.DevMod[TileType].StrmSw;
+
+		RC = _XAie_StrmSwCctRegs(StrmMod, Hop->Slave, Hop->SlvPortNum,
+				Hop->Master, Hop->MstrPortNum, Enable,
+				&MstrOff, &MstrVal, &SlvOff, &SlvVal);
+		if(RC != XAIE_OK) {
+			break;
+		}
+
+		TileAddr = _XAie_GetTileAddr(DevInst, Hop->Loc.Row,
+				Hop->Loc.Col);
+		RC = XAie_Write32(DevInst, TileAddr + MstrOff, MstrVal);
+		RC |= XAie_Write32(DevInst, TileAddr + SlvOff, SlvVal);
+		if(RC != XAIE_OK) {
+			RC = XAIE_ERR;
+			break;
+		}
+
+		_XAie_StrmPortMapUpdate(DevInst, Hop->Loc, XAIE_STRMSW_MASTER,
+				Hop->Master, Hop->MstrPortNum, Enable);
+		_XAie_StrmPortMapUpdate(DevInst, Hop->Loc, XAIE_STRMSW_SLAVE,
+				Hop->Slave, Hop->SlvPortNum, Enable);
+	}
+
+	TxnRC = XAie_SubmitTransaction(DevInst, NULL);
+	if(RC == XAIE_OK) {
+		RC = TxnRC;
+	}
+
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API routes a circuit switch stream from a slave port of a tile to a
+* master port of another tile, and configures all the connections of the route
+* in a single transaction.
+*
+* The route is searched with a shortest path search over the stream switches
+* of the requested tiles of the partition. The ports which are used, by the
+* previous routes or by the stream switch APIs, are not used. Among the routes
+* with the least hops, the route going through the links with the fewest used
+* ports is selected, which spreads the streams across the parallel links of the
+* array.
+*
+* @param	DevInst: Device Instance
+* @param	SrcLoc: Location of the source tile.
+* @param	Slave: Slave port type of the source.
+* @param	SlvPortNum: Slave port number of the source.
+* @param	DstLoc: Location of the destination tile.
+* @param	Master: Master port type of the destination.
+* @param	MstrPortNum: Master port number of the destination.
+* @param	Hops: Pointer to return the connections of the route, from the
+*		source to the destination. Can be NULL.
+* @param	NumHops: Pointer to the capacity of Hops, in number of
+*		connections, to return the number of connections of the route.
+*		Can be NULL if Hops is NULL.
+*
+* @return	XAIE_OK on success, XAIE_ERR_STREAM_PORT if there is no route,
+*		Error code on failure.
+*
+* @note		The API starts and submits its own transaction, it shall not
+*		be called while the calling thread has a transaction started.
+*		The route can be torn down with XAie_StrmRouteCctRelease().
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteCct(XAie_DevInst *DevInst, XAie_LocType SrcLoc,
+		StrmSwPortType Slave, u8 SlvPortNum, XAie_LocType DstLoc,
+		StrmSwPortType Master, u8 MstrPortNum, XAie_StrmHop *Hops,
+		u32 *NumHops)
+{
+	AieRC RC = XAIE_ERR_STREAM_PORT;
+	u32 NumStates, SrcState, Final = XAIE_SS_ROUTE_INF;
+	u32 *Dist, *Prev;
+	u32 Num = 0U;
+	StrmSwPortType OutType = Master;
+	u8 OutNum = MstrPortNum;
+	XAie_StrmHop *Route;
+	XAie_StrmRouteHeap Heap = {0U, 0U, NULL};
+	const XAie_StrmMod *StrmMod;
+	const XAie_StrmTilePorts *Ports;
+
+	if((DevInst == XAIE_NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY) ||
+			((Hops != NULL) && (NumHops == NULL))) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	if((Slave >= SS_PORT_TYPE_MAX) || (Master >= SS_PORT_TYPE_MAX) ||
+			(SrcLoc.Col >= DevInst->NumCols) ||
+			(SrcLoc.Row >= DevInst->NumRows) ||
+			(DstLoc.Col >= DevInst->NumCols) ||
+			(DstLoc.Row >= DevInst->NumRows)) {
+		XAIE_ERROR("Invalid route endpoints\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	StrmMod = _XAie_StrmRouteTileMod(DevInst, SrcLoc);
+	if((StrmMod == NULL) || (SlvPortNum >= XAIE_SS_ROUTE_MAX_PORTS) ||
+			(SlvPortNum >= StrmMod->SlvConfig[Slave].NumPorts)) {
+		XAIE_ERROR("Invalid source port\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	StrmMod = _XAie_StrmRouteTileMod(DevInst, DstLoc);
+	if((StrmMod == NULL) || (MstrPortNum >= XAIE_SS_ROUTE_MAX_PORTS) ||
+			(MstrPortNum >= StrmMod->MstrConfig[Master].NumPorts)) {
+		XAIE_ERROR("Invalid destination port\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	if(_XAie_StrmPortMapGet(DevInst, SrcLoc) == NULL) {
+		return XAIE_ERR;
+	}
+
+	Ports = _XAie_StrmPortMapGet(DevInst, SrcLoc);
+	if((Ports->Slv[Slave] & (1U << SlvPortNum)) != 0U) {
+		XAIE_ERROR("Source port is in use\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	Ports = _XAie_StrmPortMapGet(DevInst, DstLoc);
+	if((Ports->Mstr[Master] & (1U << MstrPortNum)) != 0U) {
+		XAIE_ERROR("Destination port is in use\n");
+		return XAIE_ERR_STREAM_PORT;
+	}
+
+	/*
+	 * A search state is a tile and the slave port the stream enters it
+	 * on. The stream enters intermediate tiles on a SOUTH, WEST, NORTH or
+	 * EAST slave port, the last state is the source slave port.
+	 */
+	NumStates = DevInst->StrmPortMap->NumTiles * XAIE_SS_ROUTE_STATES;
+	SrcState = NumStates;
+	Dist = malloc((NumStates + 1U) * sizeof(*Dist));
+	Prev = malloc((NumStates + 1U) * sizeof(*Prev));
+	if((Dist == NULL) || (Prev == NULL)) {
+		XAIE_ERROR("Memory allocation failed for route search\n");
+		free(Dist);
+		free(Prev);
+		return XAIE_ERR;
+	}
+
+	memset(Dist, 0xFF, (NumStates + 1U) * sizeof(*Dist));
+	Dist[SrcState] = 0U;
+	Prev[SrcState] = XAIE_SS_ROUTE_INF;
+	if(_XAie_StrmHeapPush(&Heap, 0U, SrcState) != XAIE_OK) {
+		RC = XAIE_ERR;
+	}
+
+	while((Heap.Num != 0U) && (RC != XAIE_ERR)) {
+		XAie_StrmRouteNode Node = _XAie_StrmHeapPop(&Heap);
+		XAie_LocType Loc;
+		StrmSwPortType InType;
+		u8 InNum;
+
+		if(Node.Cost != Dist[Node.State]) {
+			continue;
+		}
+
+		if(Node.State == SrcState) {
+			Loc = SrcLoc;
+			InType = Slave;
+			InNum = SlvPortNum;
+		} else {
+			u32 Tile = Node.State / XAIE_SS_ROUTE_STATES;
+			u32 Port = Node.State % XAIE_SS_ROUTE_STATES;
+
+			Loc = XAie_TileLoc(Tile / DevInst->NumRows,
+					Tile % DevInst->NumRows);
+			InType = (StrmSwPortType)(SOUTH +
+					Port / XAIE_SS_ROUTE_MAX_PORTS);
+			InNum = Port % XAIE_SS_ROUTE_MAX_PORTS;
+		}
+
+		StrmMod = _XAie_StrmRouteTileMod(DevInst, Loc);
+		Ports = _XAie_StrmPortMapGet(DevInst, Loc);
+
+		/* Destination reached */
+		if((Loc.Col == DstLoc.Col) && (Loc.Row == DstLoc.Row) &&
+				((Ports->Mstr[Master] & (1U << MstrPortNum))
+				 == 0U) &&
+				(StrmMod->PortVerify(InType, InNum, Master,
+					MstrPortNum) == XAIE_OK)) {
+			Final = Node.State;
+			RC = XAIE_OK;
+			break;
+		}
+
+		for(u32 d = 0U; d < XAIE_SS_ROUTE_NUM_DIRS; d++) {
+			StrmSwPortType Dir = (StrmSwPortType)(SOUTH + d);
+			StrmSwPortType NextType;
+			const XAie_StrmMod *NextMod;
+			const XAie_StrmTilePorts *NextPorts;
+			XAie_LocType NextLoc;
+			u32 NumPorts, Cost;
+
+			if(_XAie_StrmNeighbour(DevInst, Loc, Dir, &NextLoc,
+						&NextType) != XAIE_OK) {
+				continue;
+			}
+
+			NextMod = _XAie_StrmRouteTileMod(DevInst, NextLoc);
+			if(NextMod == NULL) {
+				continue;
+			}
+
+			NextPorts = _XAie_StrmPortMapGet(DevInst, NextLoc);
+			NumPorts = StrmMod->MstrConfig[Dir].NumPorts;
+			if(NumPorts > NextMod->SlvConfig[NextType].NumPorts) {
+				NumPorts = NextMod->SlvConfig[NextType].NumPorts;
+			}
+			if(NumPorts > XAIE_SS_ROUTE_MAX_PORTS) {
+				NumPorts = XAIE_SS_ROUTE_MAX_PORTS;
+			}
+
+			/* Congestion of the link between the two tiles */
+			Cost = Node.Cost + XAIE_SS_ROUTE_HOP_COST +
+				_XAie_StrmNumUsed(Ports->Mstr[Dir]) +
+				_XAie_StrmNumUsed(NextPorts->Slv[NextType]);
+
+			for(u8 p = 0U; p < NumPorts; p++) {
+				u32 State;
+
+				if(((Ports->Mstr[Dir] & (1U << p)) != 0U) ||
+						((NextPorts->Slv[NextType] &
+						  (1U << p)) != 0U) ||
+						(StrmMod->PortVerify(InType,
+							InNum, Dir, p) !=
+						 XAIE_OK)) {
+					continue;
+				}
+
+				State = (NextLoc.Col * DevInst->NumRows +
+						NextLoc.Row) *
+					XAIE_SS_ROUTE_STATES +
+					(NextType - SOUTH) *
+					XAIE_SS_ROUTE_MAX_PORTS + p;
+				if(Cost >= Dist[State]) {
+					continue;
+				}
+
+				Dist[State] = Cost;
+				Prev[State] = Node.State;
+				if(_XAie_StrmHeapPush(&Heap, Cost, State) !=
+						XAIE_OK) {
+					RC = XAIE_ERR;
+					break;
+				}
+			}
+		}
+	}
+
+	free(Heap.Nodes);
+	free(Dist);
+	if(RC != XAIE_OK) {
+		if(RC == XAIE_ERR_STREAM_PORT) {
+			XAIE_ERROR("No route from tile (%u, %u) to tile (%u, %u)\n",
+					SrcLoc.Col, SrcLoc.Row, DstLoc.Col,
+					DstLoc.Row);
+		}
+		free(Prev);
+		return RC;
+	}
+
+	for(u32 State = Final; State != XAIE_SS_ROUTE_INF;
+			State = Prev[State]) {
+		Num++;
+	}
+
+	if((Hops != NULL) && (*NumHops < Num)) {
+		XAIE_ERROR("Route needs %u connections\n", Num);
+		*NumHops = Num;
+		free(Prev);
+		return XAIE_INVALID_ARGS;
+	}
+
+	Route = malloc(Num * sizeof(*Route));
+	if(Route == NULL) {
+		XAIE_ERROR("Memory allocation failed for route\n");
+		free(Prev);
+		return XAIE_ERR;
+	}
+
+	/* Walk back from the destination */
+	for(u32 State = Final, i = Num; State != XAIE_SS_ROUTE_INF;
+			State = Prev[State]) {
+		XAie_StrmHop *Hop = &Route[--i];
+
+		if(State == SrcState) {
+			Hop->Loc = SrcLoc;
+			Hop->Slave = Slave;
+			Hop->SlvPortNum = SlvPortNum;
+		} else {
+			u32 Tile = State / XAIE_SS_ROUTE_STATES;
+			u32 Port = State % XAIE_SS_ROUTE_STATES;
+
+			Hop->Loc = XAie_TileLoc(Tile / DevInst->NumRows,
+					Tile % DevInst->NumRows);
+			Hop->Slave = (StrmSwPortType)(SOUTH +
+					Port / XAIE_SS_ROUTE_MAX_PORTS);
+			Hop->SlvPortNum = Port % XAIE_SS_ROUTE_MAX_PORTS;
+		}
+		Hop->Master = OutType;
+		Hop->MstrPortNum = OutNum;
+
+		/* The previous tile forwards on the opposite port */
+		switch(Hop->Slave) {
+		case SOUTH:
+			OutType = NORTH;
+			break;
+		case NORTH:
+			OutType = SOUTH;
+			break;
+		case WEST:
+			OutType = EAST;
+			break;
+		default:
+			OutType = WEST;
+			break;
+		}
+		OutNum = Hop->SlvPortNum;
+	}
+	free(Prev);
+
+	RC = _XAie_StrmRouteConfig(DevInst, Route, Num, XAIE_ENABLE);
+	if((RC == XAIE_OK) && (Hops != NULL)) {
+		memcpy(Hops, Route, Num * sizeof(*Route));
+		*NumHops = Num;
+	} else if((RC == XAIE_OK) && (NumHops != NULL)) {
+		*NumHops = Num;
+	}
+
+	free(Route);
+	return RC;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disables the circuit switch connections of a route returned by
+* XAie_StrmRouteCct(), in a single transaction.
+*
+* @param	DevInst: Device Instance
+* @param	Hops: Connections of the route.
+* @param	NumHops: Number of connections.
+*
+* @return	XAIE_OK on success, Error code on failure.
+*
+* @note		The API starts and submits its own transaction, it shall not
+*		be called while the calling thread has a transaction started.
+*
+*******************************************************************************/
+AieRC XAie_StrmRouteCctRelease(XAie_DevInst *DevInst, const XAie_StrmHop *Hops,
+		u32 NumHops)
+{
+	if((DevInst == XAIE_NULL) || (Hops == NULL) ||
+			(DevInst->IsReady != XAIE_COMPONENT_IS_READY)) {
+		XAIE_ERROR("Invalid arguments\n");
+		return XAIE_INVALID_ARGS;
+	}
+
+	for(u32 i = 0U; i < NumHops; i++) {
+		const XAie_StrmMod *StrmMod;
+
+		StrmMod = _XAie_StrmRouteTileMod(DevInst, Hops[i].Loc);
+		if((StrmMod == NULL) || (Hops[i].Slave >= SS_PORT_TYPE_MAX) ||
+				(Hops[i].Master >= SS_PORT_TYPE_MAX)) {
+			XAIE_ERROR("Invalid route connection\n");
+			return XAIE_INVALID_ARGS;
+		}
+	}
+
+	return _XAie_StrmRouteConfig(DevInst, Hops, NumHops, XAIE_DISABLE);
+}
+
+#else /* XAIE_FEATURE_SS_ENABLE */
+
+void _XAie_StrmPortMapReset(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+void _XAie_StrmPortMapFree(XAie_DevInst *DevInst)
+{
+	(void)DevInst;
+}
+
+#endif /* XAIE_FEATURE_SS_ENABLE */
+/** @} */
@@ -29,6 +29,7 @@
 #include <stdlib.h>
 
 #include "xaie_events.h"
+#include "xaie_events_internal.h"
 #include "xaie_feature_config.h"
 #include "xaie_helper.h"
 #include "xaie_timer.h"
@@ -82,7 +83,7 @@ AieRC XAie_SetTimerTrigEventVal(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -95,11 +96,11 @@ AieRC XAie_SetTimerTrigEventVal(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[0U];
 	}
 
 	else {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[Module];
 	}
 
 	/* Set up Timer low event value */
@@ -149,7 +150,7 @@ AieRC XAie_ResetTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -162,11 +163,11 @@ AieRC XAie_ResetTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[0U];
 	}
 
 	else {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[Module];
 	}
 
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
@@ -221,7 +222,7 @@ AieRC XAie_SetTimerResetEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -234,13 +235,13 @@ AieRC XAie_SetTimerResetEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	}
 
 	else {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	/* check if the event passed as input is corresponding to the module */
@@ -307,7 +308,7 @@ AieRC XAie_ReadTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -320,11 +321,11 @@ AieRC XAie_ReadTimer(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[0U];
 	}
 
 	else {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[Module];
 	}
 
 	/* Read the timer high and low values before wait */
@@ -382,7 +383,7 @@ AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid Tile Type\n");
 		return XAIE_INVALID_TILE;
@@ -400,9 +401,9 @@ AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[0U];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[0U];
 	} else {
-		TimerMod = &DevInst->DevProp.DevMod[TileType].TimerMod[Module];
+		TimerMod = &_XAie_GetDevMod(DevInst)[TileType].TimerMod[Module];
 	}
 
 	/* Read the timer high and low values before wait */
@@ -443,64 +444,6 @@ AieRC XAie_WaitCycles(XAie_DevInst *DevInst, XAie_LocType Loc,
 	return XAIE_OK;
 }
 
-/*****************************************************************************/
-/**
-* This API returns the broadcast event enum given a resource id from the
-* event map.
-*
-* @param        DevInst: Device Instance
-* @param        Loc: Location of Tile
-* @param        Mod: Module type
-* @param        RscId: Specific resource to be requested
-*
-* @return       Event enum on success.
-*
-* @note         Internal only.
-*
-*******************************************************************************/
-static XAie_Events _XAie_GetBroadcastEventfromRscId(XAie_DevInst *DevInst,
-		XAie_LocType Loc, XAie_ModuleType Mod, u8 RscId)
-{
-	u8 TileType;
-	const XAie_EvntMod *EvntMod;
-
-	TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
-
-	if(Mod == XAIE_PL_MOD)
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
-	else
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Mod];
-
-	return EvntMod->BroadcastEventMap->Event + RscId;
-}
-
-/*****************************************************************************/
-/**
-* This API clears broadcast configuration for shim tiles till the mentioned
-* column.
-*
-*
-* @param        DevInst: Device Instance
-* @param        StartCol: Start column from where broadcast conf needs to be
-* 			  cleared
-* @param        EndCol: End column till where broadcast conf needs to be cleared
-* @param        BcastChannelId: ID of broadcast channel
-*
-* @return       None
-*
-* @note         Internal only.
-*
-*******************************************************************************/
-static void _XAie_ClearShimBroadcast(XAie_DevInst *DevInst, u8 StartCol,
-		u8 EndCol, u32 BcastChannelId)
-{
-	for(u32 i = StartCol; i < EndCol; i++) {
-		XAie_LocType Loc = XAie_TileLoc(i, 0);
-		XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-			BcastChannelId, XAIE_EVENT_NONE_PL);
-	}
-}
-
 /*****************************************************************************/
 /**
 * This API clears timer configuration for all the locations in Rscs list from
@@ -523,12 +466,12 @@ static void _XAie_ClearTimerConfig(XAie_DevInst *DevInst, u32 Index,
 
 	for(u32 k = 0; k < Index; k++) {
 
-		TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, RscsBC[k].Loc);
+		TileType = _XAie_DevGetTTypefromLoc(DevInst, RscsBC[k].Loc);
 		if(RscsBC[k].Mod == XAIE_PL_MOD)
-			EvntMod = &DevInst->DevProp.DevMod[TileType].
+			EvntMod = &_XAie_GetDevMod(DevInst)[TileType].
 				EvntMod[0U];
 		else
-			EvntMod = &DevInst->DevProp.DevMod[TileType].
+			EvntMod = &_XAie_GetDevMod(DevInst)[TileType].
 				EvntMod[RscsBC[k].Mod];
 
 		XAie_SetTimerResetEvent(DevInst, RscsBC[k].Loc,
@@ -552,207 +495,43 @@ static void _XAie_ClearTimerConfig(XAie_DevInst *DevInst, u32 Index,
 AieRC XAie_SyncTimer(XAie_DevInst *DevInst)
 {
 	AieRC RC;
-	u32 UserRscNum = 0, UserRscNumShim;
-	u32 BcastChannelId, BcastChannelIdShim;
-	XAie_Events BcastEvent, ShimBcastEvent;
-	XAie_UserRsc *RscsBC, *RscsBCShim;
-
-	for(u8 i = 0; i < XAIEGBL_TILE_TYPE_MAX; i++) {
-		if(i == XAIEGBL_TILE_TYPE_SHIMNOC)
-			continue;
-		UserRscNum += (DevInst->DevProp.DevMod[i].NumModules) *
-			_XAie_GetNumRows(DevInst, i) * DevInst->NumCols;
-	}
-
-	RscsBC = (XAie_UserRsc *)malloc(UserRscNum * sizeof(XAie_UserRsc));
-	if(RscsBC == NULL) {
-		XAIE_ERROR("Unable to allocate memory for resource\n");
-		return XAIE_ERR;
-	}
-
-	UserRscNumShim = DevInst->NumCols;
-	RscsBCShim = (XAie_UserRsc *)malloc(DevInst->NumCols *
-			sizeof(XAie_UserRsc));
-	if(RscsBCShim == NULL) {
-		XAIE_ERROR("Unable to allocate memory for resource\n");
-		free(RscsBC);
-		return XAIE_ERR;
-	}
-	/* Reserve a free BC across partition */
-	RC = XAie_RequestBroadcastChannel(DevInst, &UserRscNum, RscsBC, 1U);
-	if(RC != XAIE_OK) {
-		free(RscsBC);
-		free(RscsBCShim);
-		return RC;
-	}
-	BcastChannelId = RscsBC[0].RscId;
+	XAie_Events BcastEvent;
+	XAie_BcastNetwork Net;
 
-	/* Reserve a free BC across partition */
-	for(u32 i = 0; i < UserRscNumShim; i++) {
-		RscsBCShim[i].Loc = XAie_TileLoc(i, 0);
-		RscsBCShim[i].Mod = XAIE_PL_MOD;
-		RscsBCShim[i].RscType = XAIE_BCAST_CHANNEL_RSC;
-	}
-	RC = XAie_RequestBroadcastChannel(DevInst, &UserRscNumShim,
-			RscsBCShim, 0U);
+	RC = _XAie_EventBcastNetworkSetup(DevInst, &Net);
 	if(RC != XAIE_OK) {
-		free(RscsBC);
-		free(RscsBCShim);
+		XAIE_ERROR("Unable to setup broadcast for timer sync.\n");
 		return RC;
 	}
-	BcastChannelIdShim = RscsBCShim[0].RscId;
-
-	ShimBcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
-		XAie_TileLoc(0, 0), XAIE_PL_MOD, BcastChannelIdShim);
-
-	for(u32 j = 0; j < UserRscNum; j++) {
-		u8 TileType =  DevInst->DevOps->GetTTypefromLoc(DevInst,
-				RscsBC[j].Loc);
-		AieRC lRC = XAIE_OK;
-
-		/* Blocking unncessary broadcasting */
-		if(TileType == XAIEGBL_TILE_TYPE_AIETILE) {
-			if(DevInst->DevProp.DevGen == XAIE_DEV_GEN_AIE) {
-				/* Checker board structure */
-				if((RscsBC[j].Loc.Row % 2) == 0) {
-					if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_WEST);
-					} else {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_EAST);
-					}
-				} else {
-					if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_EAST);
-					} else {
-						lRC |= XAie_EventBroadcastBlockDir(
-							DevInst, RscsBC[j].Loc,
-							RscsBC[j].Mod,
-							XAIE_EVENT_SWITCH_A,
-							BcastChannelId,
-							XAIE_EVENT_BROADCAST_WEST);
-					}
-				}
-			} else {
-				if(RscsBC[j].Mod == XAIE_MEM_MOD) {
-					lRC |= XAie_EventBroadcastBlockDir(
-						DevInst, RscsBC[j].Loc,
-						RscsBC[j].Mod,
-						XAIE_EVENT_SWITCH_A,
-						BcastChannelId,
-						XAIE_EVENT_BROADCAST_EAST);
-				} else {
-					lRC |= XAie_EventBroadcastBlockDir(
-						DevInst, RscsBC[j].Loc,
-						RscsBC[j].Mod,
-						XAIE_EVENT_SWITCH_A,
-						BcastChannelId,
-						XAIE_EVENT_BROADCAST_WEST);
-				}
-			}
-		} else if(RscsBC[j].Loc.Row != 0) {
-			lRC |= XAie_EventBroadcastBlockDir(
-				DevInst, RscsBC[j].Loc,
-				RscsBC[j].Mod,
-				XAIE_EVENT_SWITCH_A,
-				BcastChannelId,
-				XAIE_EVENT_BROADCAST_WEST |
-				XAIE_EVENT_BROADCAST_EAST);
-		}
-		if (lRC != XAIE_OK) {
-			XAIE_ERROR("Unable to setup broadcast for timer sync.\n");
-			free(RscsBC);
-			free(RscsBCShim);
-			return RC;
-		}
-	}
-
-	for(u32 i = 0; i < DevInst->NumCols; i++) {
-		XAie_LocType Loc = XAie_TileLoc(i, 0);
-
-		RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-				BcastChannelId, ShimBcastEvent);
-		if(i == 0) {
-			RC = XAie_EventBroadcast(DevInst, Loc, XAIE_PL_MOD,
-				BcastChannelIdShim, ShimBcastEvent);
-		}
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Unable to configure broadcast event for timer sync\n");
-			free(RscsBC);
-			free(RscsBCShim);
-			return RC;
-		}
-	}
 
 	/* Configure the timer control with the trigger event */
-	for(u32 j = 0; j < UserRscNum; j++) {
-		BcastEvent = _XAie_GetBroadcastEventfromRscId(DevInst,
-				RscsBC[j].Loc, RscsBC[j].Mod, BcastChannelId);
-		RC = XAie_SetTimerResetEvent(DevInst, RscsBC[j].Loc,
-			RscsBC[j].Mod, BcastEvent, XAIE_RESETDISABLE);
+	for(u32 j = 0; j < Net.NumRscs; j++) {
+		BcastEvent = _XAie_EventGetBroadcastEvent(DevInst,
+				Net.Rscs[j].Loc, Net.Rscs[j].Mod,
+				Net.BcastChannelId);
+		RC = XAie_SetTimerResetEvent(DevInst, Net.Rscs[j].Loc,
+			Net.Rscs[j].Mod, BcastEvent, XAIE_RESETDISABLE);
 		if(RC != XAIE_OK) {
 			XAIE_ERROR("Unable to set timer control\n");
-			free(RscsBC);
-			free(RscsBCShim);
+			_XAie_ClearTimerConfig(DevInst, j, Net.Rscs);
+			_XAie_EventBcastNetworkTeardown(DevInst, &Net);
 			return RC;
 		}
 	}
 
 	/* Trigger Event */
 	RC = XAie_EventGenerate(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
-			ShimBcastEvent);
+			Net.ShimBcastEvent);
 	if(RC != XAIE_OK) {
 		XAIE_ERROR("Unable to trigger event\n");
-		free(RscsBC);
-		free(RscsBCShim);
-		return RC;
 	}
 
 	/* Clear timer reset event register */
-	_XAie_ClearTimerConfig(DevInst, UserRscNum, RscsBC);
+	_XAie_ClearTimerConfig(DevInst, Net.NumRscs, Net.Rscs);
 
-	/* Clear broadcast setting */
-	for(u32 j = 0; j < UserRscNum; j++) {
-		if(RscsBC[j].Loc.Row == 0) {
-			/* If it is SHIM tile, skip */
-			continue;
-		}
-		RC = XAie_EventBroadcastUnblockDir(DevInst,
-			RscsBC[j].Loc, RscsBC[j].Mod,
-			XAIE_EVENT_SWITCH_A, BcastChannelId,
-			XAIE_EVENT_BROADCAST_WEST | XAIE_EVENT_BROADCAST_EAST);
-		if(RC != XAIE_OK) {
-			XAIE_ERROR("Failed to clear broadcast setting for timer sync.\n");
-			/* Will continue clearning even if it failes */
-		}
-	}
+	_XAie_EventBcastNetworkTeardown(DevInst, &Net);
 
-	/* Clear shim broadcast configuration */
-	_XAie_ClearShimBroadcast(DevInst, 0, DevInst->NumCols, BcastChannelId);
-	XAie_EventBroadcast(DevInst, XAie_TileLoc(0, 0), XAIE_PL_MOD,
-		BcastChannelIdShim, XAIE_EVENT_NONE_PL);
-
-	/* Release broadcast channel across partition */
-	XAie_ReleaseBroadcastChannel(DevInst, UserRscNum, RscsBC);
-	XAie_ReleaseBroadcastChannel(DevInst, UserRscNumShim, RscsBCShim);
-	free(RscsBC);
-	free(RscsBCShim);
-
-	return XAIE_OK;
+	return RC;
 }
 
 #endif /* XAIE_FEATURE_TIMER_ENABLE */
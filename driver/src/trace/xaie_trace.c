@@ -67,7 +67,7 @@ AieRC XAie_TraceEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -79,11 +79,11 @@ AieRC XAie_TraceEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	if(Event < EvntMod->EventMin || Event > EvntMod->EventMax) {
@@ -149,7 +149,7 @@ AieRC XAie_TraceStartEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -161,11 +161,11 @@ AieRC XAie_TraceStartEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	if(StartEvent < EvntMod->EventMin || StartEvent > EvntMod->EventMax) {
@@ -224,7 +224,7 @@ AieRC XAie_TraceStopEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -236,11 +236,11 @@ AieRC XAie_TraceStopEvent(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	if(StopEvent < EvntMod->EventMin || StopEvent > EvntMod->EventMax) {
@@ -298,7 +298,7 @@ AieRC XAie_TracePktConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -310,9 +310,9 @@ AieRC XAie_TracePktConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	if(Pkt.PktId > XAIE_PACKET_ID_MAX || Pkt.PktType > XAIE_PACKET_TYPE_MAX)
 	{
@@ -367,7 +367,7 @@ AieRC XAie_TraceModeConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -379,9 +379,9 @@ AieRC XAie_TraceModeConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	if(Mode > XAIE_TRACE_INST_EXEC ||
 			TraceMod->ModeConfig.Mask == XAIE_FEATURE_UNAVAILABLE) {
@@ -431,7 +431,7 @@ AieRC XAie_TraceGetState(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -443,9 +443,9 @@ AieRC XAie_TraceGetState(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	RegOffset = TraceMod->StatusRegOff;
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOffset;
@@ -496,7 +496,7 @@ AieRC XAie_TraceGetMode(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -508,9 +508,9 @@ AieRC XAie_TraceGetMode(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	RegOffset = TraceMod->StatusRegOff;
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) + RegOffset;
@@ -565,7 +565,7 @@ AieRC XAie_TraceControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -577,11 +577,11 @@ AieRC XAie_TraceControlConfig(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD) {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[0U];
 	} else {
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
-		EvntMod = &DevInst->DevProp.DevMod[TileType].EvntMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
+		EvntMod = &_XAie_GetDevMod(DevInst)[TileType].EvntMod[Module];
 	}
 
 	if((StopEvent < EvntMod->EventMin || StopEvent > EvntMod->EventMax) ||
@@ -649,7 +649,7 @@ AieRC XAie_TraceControlConfigReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -661,9 +661,9 @@ AieRC XAie_TraceControlConfigReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
 		TraceMod->CtrlRegOff;
@@ -702,7 +702,7 @@ AieRC XAie_TracePktConfigReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -714,9 +714,9 @@ AieRC XAie_TracePktConfigReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
 		TraceMod->PktConfigRegOff;
@@ -805,7 +805,7 @@ AieRC XAie_TraceEventReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 		return XAIE_INVALID_ARGS;
 	}
 
-	TileType = DevInst->DevOps->GetTTypefromLoc(DevInst, Loc);
+	TileType = _XAie_DevGetTTypefromLoc(DevInst, Loc);
 	if(TileType == XAIEGBL_TILE_TYPE_MAX) {
 		XAIE_ERROR("Invalid tile type\n");
 		return XAIE_INVALID_TILE;
@@ -817,9 +817,9 @@ AieRC XAie_TraceEventReset(XAie_DevInst *DevInst, XAie_LocType Loc,
 	}
 
 	if(Module == XAIE_PL_MOD)
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[0U];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[0U];
 	else
-		TraceMod = &DevInst->DevProp.DevMod[TileType].TraceMod[Module];
+		TraceMod = &_XAie_GetDevMod(DevInst)[TileType].TraceMod[Module];
 
 	EventRegOffId = SlotId / TraceMod->NumEventsPerSlot;
 	RegAddr = _XAie_GetTileAddr(DevInst, Loc.Row, Loc.Col) +
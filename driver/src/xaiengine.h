@@ -9,17 +9,21 @@ extern "C" {
 #endif
 
 #include <xaiengine/xaie_clock.h>
+#include <xaiengine/xaie_context.h>
 #include <xaiengine/xaie_core.h>
 #include <xaiengine/xaie_dma.h>
 #include <xaiengine/xaie_elfloader.h>
 #include <xaiengine/xaie_events.h>
 #include <xaiengine/xaie_interrupt.h>
+#include <xaiengine/xaie_io_stats.h>
 #include <xaiengine/xaie_locks.h>
 #include <xaiengine/xaie_mem.h>
+#include <xaiengine/xaie_mem_chan.h>
 #include <xaiengine/xaie_perfcnt.h>
 #include <xaiengine/xaie_plif.h>
 #include <xaiengine/xaie_reset.h>
 #include <xaiengine/xaie_rsc.h>
+#include <xaiengine/xaie_rtp.h>
 #include <xaiengine/xaie_ss.h>
 #include <xaiengine/xaie_timer.h>
 #include <xaiengine/xaie_trace.h>